@@ -9,6 +9,7 @@
 #include "algorithms/create_algorithm.h"
 #include "algorithms/pipelines/typo_miner/typo_miner.h"
 #include "config/names.h"
+#include "parser/csv_parser/create_csv_parser.h"
 #include "tabular_data/input_tables_type.h"
 
 namespace algos {
@@ -47,7 +48,7 @@ void LoadAlgorithm(Algorithm& algorithm, StdParamsMap const& options) {
     ConfigureFromFunction(algorithm, [&options](std::string_view option_name) {
         using namespace config::names;
         auto create_input_table = [](CSVConfig const& csv_config) -> config::InputTable {
-            return std::make_shared<CSVParser>(csv_config);
+            return CreateCSVParser(csv_config);
         };
 
         if (option_name == kTable && options.find(std::string{kTable}) == options.end()) {
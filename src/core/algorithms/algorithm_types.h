@@ -8,10 +8,10 @@ namespace algos {
 
 using AlgorithmTypes =
         std::tuple<Depminer, DFD, FastFDs, FDep, FdMine, Pyro, Tane, PFDTane, FUN, hyfd::HyFD, Aid,
-                   Apriori, metric::MetricVerifier, DataStats, fd_verifier::FDVerifier, HyUCC,
-                   PyroUCC, cfd::FDFirstAlgorithm, ACAlgorithm, UCCVerifier, Faida, Spider, Mind,
-                   Fastod, GfdValidation, EGfdValidation, NaiveGfdValidation, order::Order,
-                   dd::Split>;
+                   Apriori, Eclat, metric::MetricVerifier, DataStats, fd_verifier::FDVerifier,
+                   fd_verifier::BatchVerifier, HyUCC, PyroUCC, cfd::FDFirstAlgorithm, ACAlgorithm,
+                   UCCVerifier, Faida, Spider, Mind, Fastod, GfdValidation, EGfdValidation,
+                   NaiveGfdValidation, order::Order, dd::Split>;
 
 // clang-format off
 /* Enumeration of all supported non-pipeline algorithms. If you implement a new
@@ -36,6 +36,7 @@ BETTER_ENUM(AlgorithmType, char,
 
 /* Association rules mining algorithms */
     apriori,
+    eclat,
 
 /* Metric verifier algorithm */
     metric,
@@ -43,8 +44,9 @@ BETTER_ENUM(AlgorithmType, char,
 /* Statistic algorithms */
     stats,
 
-/* FD verifier algorithm */
+/* FD verifier algorithms */
     fd_verifier,
+    batch_verifier,
 
 /* Unique Column Combination mining algorithms */
     hyucc,
@@ -42,6 +42,7 @@ void ARAlgorithm::ResetState() {
 void ARAlgorithm::MakeExecuteOptsAvailable() {
     using namespace config::names;
     MakeOptionsAvailable({kMinimumSupport, kMinimumConfidence});
+    MakeExecuteOptsAvailableArInternal();
 }
 
 void ARAlgorithm::LoadDataInternal() {
@@ -0,0 +1,252 @@
+#include "algorithms/association_rules/eclat.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <chrono>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <easylogging++.h>
+
+#include "config/thread_number/option.h"
+
+namespace algos {
+
+namespace {
+
+/* Number of 64-bit words in an AVX2 register, tid-lists are padded to a multiple of it */
+constexpr size_t kWordsPerVector = 4;
+
+/* Writes the intersection of two tid-lists to out and returns the number of transactions in it */
+size_t IntersectAndCount(uint64_t const* a, uint64_t const* b, uint64_t* out, size_t num_words) {
+    assert(num_words % kWordsPerVector == 0);
+#ifdef __AVX2__
+    // popcount of every byte through a nibble lookup table, the byte counts are summed into the
+    // 64-bit lanes with sad
+    __m256i const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1,
+                                            1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i const low_mask = _mm256_set1_epi8(0x0f);
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i total = zero;
+    for (size_t i = 0; i < num_words; i += kWordsPerVector) {
+        __m256i const v =
+                _mm256_and_si256(_mm256_load_si256(reinterpret_cast<__m256i const*>(a + i)),
+                                 _mm256_load_si256(reinterpret_cast<__m256i const*>(b + i)));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(out + i), v);
+        __m256i const low = _mm256_and_si256(v, low_mask);
+        __m256i const high = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+        __m256i const counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                                               _mm256_shuffle_epi8(lookup, high));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, zero));
+    }
+    return _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+           _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3);
+#elif defined(__SSE2__)
+    size_t count = 0;
+    for (size_t i = 0; i < num_words; i += 2) {
+        __m128i const v = _mm_and_si128(_mm_load_si128(reinterpret_cast<__m128i const*>(a + i)),
+                                        _mm_load_si128(reinterpret_cast<__m128i const*>(b + i)));
+        _mm_store_si128(reinterpret_cast<__m128i*>(out + i), v);
+        count += std::popcount(out[i]) + std::popcount(out[i + 1]);
+    }
+    return count;
+#else
+    size_t count = 0;
+    for (size_t i = 0; i < num_words; ++i) {
+        out[i] = a[i] & b[i];
+        count += std::popcount(out[i]);
+    }
+    return count;
+#endif
+}
+
+}  // namespace
+
+Eclat::Eclat() : ARAlgorithm({}) {
+    RegisterOption(config::kThreadNumberOpt(&threads_num_));
+}
+
+void Eclat::MakeExecuteOptsAvailableArInternal() {
+    MakeOptionsAvailable({config::kThreadNumberOpt.GetName()});
+}
+
+void Eclat::ResetStateAr() {
+    root_ = Node();
+    num_words_ = 0;
+}
+
+Eclat::TidLists Eclat::CreateFirstLevel() {
+    auto const& transactions = transactional_data_->GetTransactions();
+    size_t const num_transactions = transactions.size();
+    num_words_ = (num_transactions + 63) / 64;
+    num_words_ = (num_words_ + kWordsPerVector - 1) / kWordsPerVector * kWordsPerVector;
+
+    // only the frequent items get a tid-list, so the infrequent ones cost no memory
+    std::vector<size_t> item_counts(transactional_data_->GetUniverseSize(), 0);
+    // an item may be repeated in a transaction, it is counted once
+    std::vector<size_t> last_seen(item_counts.size(), 0);
+    size_t transaction_number = 0;
+    for (auto const& [tid, itemset] : transactions) {
+        ++transaction_number;
+        for (unsigned item_id : itemset.GetItemsIDs()) {
+            if (last_seen[item_id] == transaction_number) continue;
+            last_seen[item_id] = transaction_number;
+            ++item_counts[item_id];
+        }
+    }
+    constexpr unsigned kInfrequent = -1;
+    std::vector<unsigned> item_slots(item_counts.size(), kInfrequent);
+    for (unsigned item_id = 0; item_id < item_counts.size(); ++item_id) {
+        if (!IsFrequent(item_counts[item_id])) continue;
+        item_slots[item_id] = root_.children.size();
+        root_.children.emplace_back(item_id);
+        root_.children.back().support =
+                static_cast<double>(item_counts[item_id]) / num_transactions;
+    }
+
+    TidLists tid_lists(root_.children.size() * num_words_, 0);
+    size_t transaction_index = 0;
+    for (auto const& [tid, itemset] : transactions) {
+        uint64_t const bit = uint64_t{1} << (transaction_index % 64);
+        size_t const word = transaction_index / 64;
+        for (unsigned item_id : itemset.GetItemsIDs()) {
+            unsigned const slot = item_slots[item_id];
+            if (slot != kInfrequent) tid_lists[slot * num_words_ + word] |= bit;
+        }
+        ++transaction_index;
+    }
+    return tid_lists;
+}
+
+void Eclat::ExtendNode(std::vector<Node>& extensions, uint64_t const* tid_lists, size_t index,
+                       TidLists& class_tid_lists) {
+    Node& node = extensions[index];
+    uint64_t const* node_tid_list = tid_lists + index * num_words_;
+    size_t const num_transactions = transactional_data_->GetNumTransactions();
+    class_tid_lists.resize((extensions.size() - index - 1) * num_words_);
+    for (size_t j = index + 1; j < extensions.size(); ++j) {
+        uint64_t* out = class_tid_lists.data() + node.children.size() * num_words_;
+        size_t const count =
+                IntersectAndCount(node_tid_list, tid_lists + j * num_words_, out, num_words_);
+        if (!IsFrequent(count)) continue;
+
+        std::vector<unsigned> items = node.items;
+        items.push_back(extensions[j].items.back());
+        node.children.emplace_back(std::move(items));
+        node.children.back().support = static_cast<double>(count) / num_transactions;
+    }
+    MineClass(node, class_tid_lists.data());
+}
+
+void Eclat::MineClass(Node& prefix_node, uint64_t const* tid_lists) {
+    std::vector<Node>& extensions = prefix_node.children;
+    // the tid-lists of a class are only needed while it is mined, so one buffer is reused for
+    // the classes of all extensions
+    TidLists class_tid_lists;
+    for (size_t i = 0; i + 1 < extensions.size(); ++i) {
+        ExtendNode(extensions, tid_lists, i, class_tid_lists);
+    }
+}
+
+unsigned long long Eclat::FindFrequent() {
+    auto start_time = std::chrono::system_clock::now();
+
+    TidLists const tid_lists = CreateFirstLevel();
+    std::vector<Node>& first_level = root_.children;
+    if (threads_num_ > 1) {
+        // the class of a single item prefix only reads the tid-lists of the items following it
+        // and builds the subtree of that prefix, so the classes are mined independently
+        boost::asio::thread_pool pool(threads_num_);
+        for (size_t i = 0; i + 1 < first_level.size(); ++i) {
+            boost::asio::post(pool, [this, &first_level, &tid_lists, i]() {
+                TidLists class_tid_lists;
+                ExtendNode(first_level, tid_lists.data(), i, class_tid_lists);
+            });
+        }
+        pool.join();
+    } else {
+        MineClass(root_, tid_lists.data());
+    }
+
+    auto elapsed_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now() - start_time);
+    return elapsed_milliseconds.count();
+}
+
+unsigned long long Eclat::GenerateAllRules() {
+    auto start_time = std::chrono::system_clock::now();
+
+    std::queue<Node const*> path;
+    UpdatePath(path, root_.children);
+    unsigned long long frequent_count = 0;
+
+    while (!path.empty()) {
+        auto curr_node = path.front();
+        path.pop();
+
+        ++frequent_count;
+        if (curr_node->items.size() >= 2) {
+            GenerateRulesFrom(curr_node->items, curr_node->support);
+        }
+        UpdatePath(path, curr_node->children);
+    }
+
+    auto elapsed_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now() - start_time);
+
+    LOG(INFO) << "> Count of frequent itemsets: " << frequent_count;
+    return elapsed_milliseconds.count();
+}
+
+void Eclat::UpdatePath(std::queue<Node const*>& path, std::vector<Node> const& vertices) {
+    for (auto const& vertex : vertices) {
+        path.push(&vertex);
+    }
+}
+
+std::list<std::set<std::string>> Eclat::GetFrequentList() const {
+    std::list<std::set<std::string>> frequent_itemsets;
+
+    std::queue<Node const*> path;
+    UpdatePath(path, root_.children);
+
+    while (!path.empty()) {
+        auto const curr_node = path.front();
+        path.pop();
+
+        std::set<std::string> item_names;
+        for (unsigned item : curr_node->items) {
+            item_names.insert(transactional_data_->GetItemUniverse()[item]);
+        }
+
+        frequent_itemsets.push_back(std::move(item_names));
+        UpdatePath(path, curr_node->children);
+    }
+
+    return frequent_itemsets;
+}
+
+double Eclat::GetSupport(std::vector<unsigned> const& frequent_itemset) const {
+    std::vector<Node> const* nodes = &root_.children;
+    Node const* node = nullptr;
+    for (size_t item_index = 0; item_index < frequent_itemset.size(); ++item_index) {
+        unsigned const item = frequent_itemset[item_index];
+        auto it = std::lower_bound(nodes->begin(), nodes->end(), item,
+                                   [item_index](Node const& vertex, unsigned value) {
+                                       return vertex.items[item_index] < value;
+                                   });
+        if (it == nodes->end() || it->items[item_index] != item) return -1;
+        node = &*it;
+        nodes = &node->children;
+    }
+    return node == nullptr ? -1 : node->support;
+}
+
+}  // namespace algos
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <boost/align/aligned_allocator.hpp>
+
+#include "algorithms/association_rules/node.h"
+#include "ar_algorithm.h"
+#include "config/thread_number/type.h"
+
+namespace algos {
+
+/* Mines frequent itemsets depth-first over the vertical layout of the data: every item gets a
+ * tid-list, a bitset of the transactions containing it, and the support of an extended itemset is
+ * the popcount of the intersection of two tid-lists. Equivalence classes of the first level
+ * prefixes are independent and are processed in parallel.
+ */
+class Eclat : public ARAlgorithm {
+private:
+    using TidLists = std::vector<uint64_t, boost::alignment::aligned_allocator<uint64_t, 32>>;
+
+    config::ThreadNumType threads_num_;
+
+    /* Frequent itemsets as a prefix tree, children are sorted by item */
+    Node root_;
+    /* Number of 64-bit words in a tid-list, padded to a whole number of AVX2 registers */
+    size_t num_words_ = 0;
+
+    bool IsFrequent(size_t transaction_count) const noexcept {
+        return static_cast<double>(transaction_count) /
+                       transactional_data_->GetNumTransactions() >=
+               minsup_;
+    }
+
+    /* Builds the tid-lists of the frequent items and the first level of the tree */
+    TidLists CreateFirstLevel();
+    /* prefix_node's children are the extensions of its itemset, tid_lists holds their tid-lists
+     * in the same order */
+    void MineClass(Node& prefix_node, uint64_t const* tid_lists);
+    /* Builds the subtree of extensions[index] from the extensions following it */
+    void ExtendNode(std::vector<Node>& extensions, uint64_t const* tid_lists, size_t index,
+                    TidLists& class_tid_lists);
+
+    static void UpdatePath(std::queue<Node const*>& path, std::vector<Node> const& vertices);
+
+    double GetSupport(std::vector<unsigned> const& frequent_itemset) const override;
+    unsigned long long GenerateAllRules() override;
+    unsigned long long FindFrequent() override;
+    void MakeExecuteOptsAvailableArInternal() override;
+
+    void ResetStateAr() final;
+
+public:
+    Eclat();
+
+    std::list<std::set<std::string>> GetFrequentList() const override;
+};
+
+}  // namespace algos
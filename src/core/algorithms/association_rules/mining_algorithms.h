@@ -1,3 +1,4 @@
 #pragma once
 
 #include "algorithms/association_rules/apriori.h"
+#include "algorithms/association_rules/eclat.h"
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace algos::dd {
+
+/* Distances between the values of a single column. Every row is mapped to the identifier of
+ * its value, rows of one PLI cluster sharing an identifier, and a distance is stored once per
+ * unordered pair of distinct identifiers in a packed strict upper triangle. The memory used is
+ * therefore quadratic in the number of distinct values rather than in the number of rows.
+ */
+class ColumnDistances {
+private:
+    std::vector<unsigned> value_ids_;
+    unsigned num_values_ = 0;
+    std::vector<double> distances_;
+
+    std::size_t GetPairIndex(std::size_t first_value, std::size_t second_value) const noexcept {
+        return first_value * (2 * num_values_ - first_value - 1) / 2 + second_value -
+               first_value - 1;
+    }
+
+public:
+    ColumnDistances() = default;
+
+    /* value_ids[row] is the identifier of the value in the row, identifiers are below
+     * num_values */
+    ColumnDistances(std::vector<unsigned> value_ids, unsigned num_values)
+        : value_ids_(std::move(value_ids)),
+          num_values_(num_values),
+          distances_(static_cast<std::size_t>(num_values) * (num_values - 1) / 2) {}
+
+    unsigned GetNumValues() const noexcept {
+        return num_values_;
+    }
+
+    /* first_value must be less than second_value */
+    void Set(unsigned first_value, unsigned second_value, double dif) noexcept {
+        distances_[GetPairIndex(first_value, second_value)] = dif;
+    }
+
+    double Get(std::size_t first_row, std::size_t second_row) const noexcept {
+        unsigned first_value = value_ids_[first_row];
+        unsigned second_value = value_ids_[second_row];
+        if (first_value == second_value) return 0;
+        if (first_value > second_value) std::swap(first_value, second_value);
+        return distances_[GetPairIndex(first_value, second_value)];
+    }
+};
+
+}  // namespace algos::dd
@@ -3,7 +3,6 @@
 #include <cassert>
 #include <chrono>
 #include <cstddef>
-#include <deque>
 #include <limits>
 #include <list>
 #include <regex>
@@ -11,11 +10,14 @@
 #include <utility>
 #include <vector>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <easylogging++.h>
 
 #include "config/names_and_descriptions.h"
 #include "config/option_using.h"
 #include "config/tabular_data/input_table/option.h"
+#include "config/thread_number/option.h"
 #include "model/table/column_index.h"
 #include "model/types/numeric_type.h"
 #include "util/levenshtein_distance.h"
@@ -36,12 +38,13 @@ void Split::RegisterOptions() {
     RegisterOption(Option{&difference_table_, kDifferenceTable, kDDifferenceTable, default_table});
     RegisterOption(Option{&num_rows_, kNumRows, kDNumRows, 0U});
     RegisterOption(Option{&num_columns_, kNumColumns, kDNUmColumns, 0U});
+    RegisterOption(config::kThreadNumberOpt(&threads_num_));
 }
 
 void Split::MakeExecuteOptsAvailable() {
     using namespace config::names;
 
-    MakeOptionsAvailable({kDifferenceTable, kNumRows, kNumColumns});
+    MakeOptionsAvailable({kDifferenceTable, kNumRows, kNumColumns, kThreads});
 }
 
 void Split::LoadDataInternal() {
@@ -221,8 +224,7 @@ unsigned Split::RemoveTransitiveDDs() {
     return num_cycles;
 }
 
-double Split::CalculateDistance(model::ColumnIndex column_index,
-                                std::pair<std::size_t, std::size_t> tuple_pair) {
+void Split::CheckValues(model::ColumnIndex column_index, std::vector<std::size_t> const& rows) {
     model::TypedColumnData const& column = typed_relation_->GetColumnData(column_index);
     model::TypeId type_id = column.GetTypeId();
 
@@ -234,12 +236,20 @@ double Split::CalculateDistance(model::ColumnIndex column_index,
         throw std::invalid_argument("Column with index \"" + std::to_string(column_index) +
                                     "\" contains values of different types.");
     }
-    if (column.IsNull(tuple_pair.first) || column.IsNull(tuple_pair.second)) {
-        throw std::runtime_error("Some of the value coordinates are nulls.");
-    }
-    if (column.IsEmpty(tuple_pair.first) || column.IsEmpty(tuple_pair.second)) {
-        throw std::runtime_error("Some of the value coordinates are empty.");
+    for (std::size_t row : rows) {
+        if (column.IsNull(row)) {
+            throw std::runtime_error("Some of the value coordinates are nulls.");
+        }
+        if (column.IsEmpty(row)) {
+            throw std::runtime_error("Some of the value coordinates are empty.");
+        }
     }
+}
+
+/* The values must be checked with CheckValues beforehand */
+double Split::CalculateDistance(model::ColumnIndex column_index,
+                                std::pair<std::size_t, std::size_t> tuple_pair) {
+    model::TypedColumnData const& column = typed_relation_->GetColumnData(column_index);
     double dif = 0;
     if (column.GetType().IsMetrizable()) {
         std::byte const* first_value = column.GetValue(tuple_pair.first);
@@ -253,7 +263,7 @@ double Split::CalculateDistance(model::ColumnIndex column_index,
 // must be inline for optimization (gcc 11.4.0)
 inline bool Split::CheckDF(DF const& dif_func, std::pair<std::size_t, std::size_t> tuple_pair) {
     for (model::ColumnIndex column_index = 0; column_index < num_columns_; column_index++) {
-        double const dif = distances_[column_index][tuple_pair.first][tuple_pair.second];
+        double const dif = distances_[column_index].Get(tuple_pair.first, tuple_pair.second);
         if (dif < dif_func[column_index].lower_bound || dif > dif_func[column_index].upper_bound) {
             return false;
         }
@@ -270,58 +280,85 @@ bool Split::VerifyDD(DD const& dep) {
     return true;
 }
 
-void Split::InsertDistance(model::ColumnIndex column_index, std::size_t first_index,
-                           std::size_t second_index, double& min_dif, double& max_dif) {
-    if (first_index < second_index) {
-        double const dif = CalculateDistance(column_index, {first_index, second_index});
-        max_dif = std::max(max_dif, dif);
-        min_dif = std::min(min_dif, dif);
-        distances_[column_index][first_index][second_index] = dif;
-    } else if (first_index == second_index) {
-        distances_[column_index][first_index][second_index] = 0;
-    } else {
-        distances_[column_index][first_index][second_index] =
-                distances_[column_index][second_index][first_index];
+ColumnDistances Split::CalculateColumnDistances(model::ColumnIndex column_index,
+                                                model::DFConstraint& min_max_dif) {
+    std::shared_ptr<model::PLI const> pli =
+            relation_->GetColumnData(column_index).GetPliOwnership();
+    std::shared_ptr<std::vector<int> const> probing_table = pli->CalculateAndGetProbingTable();
+    model::PLI::Cluster const& pt = *probing_table.get();
+
+    /* Rows of a PLI cluster share the identifier of the cluster, every other row gets an
+     * identifier of its own. representatives[id] is the first row with the value. */
+    std::vector<int> cluster_value_ids(pli->GetIndex().size(), -1);
+    std::vector<unsigned> value_ids(num_rows_);
+    std::vector<std::size_t> representatives;
+    bool has_equal_values = false;
+    for (std::size_t row = 0; row < num_rows_; row++) {
+        if (pt[row] == 0) {
+            value_ids[row] = representatives.size();
+            representatives.push_back(row);
+            continue;
+        }
+        int& cluster_value_id = cluster_value_ids[pt[row] - 1];
+        if (cluster_value_id == -1) {
+            cluster_value_id = representatives.size();
+            representatives.push_back(row);
+        } else {
+            has_equal_values = true;
+        }
+        value_ids[row] = cluster_value_id;
+    }
+
+    unsigned const num_values = representatives.size();
+    ColumnDistances distances(std::move(value_ids), num_values);
+    double min_dif = std::numeric_limits<double>::max();
+    double max_dif = 0;
+    if (num_values > 1) {
+        CheckValues(column_index, representatives);
+
+        /* Rows of the triangle get shorter, so they are dealt to the tasks round-robin */
+        std::size_t const num_tasks = std::min<std::size_t>(threads_num_, num_values);
+        std::vector<model::DFConstraint> task_min_max(num_tasks,
+                                                      {std::numeric_limits<double>::max(), 0});
+        auto calculate = [&](std::size_t task) {
+            double& task_min = task_min_max[task].lower_bound;
+            double& task_max = task_min_max[task].upper_bound;
+            for (unsigned i = task; i < num_values; i += num_tasks) {
+                for (unsigned j = i + 1; j < num_values; j++) {
+                    double const dif = CalculateDistance(
+                            column_index, {representatives[i], representatives[j]});
+                    task_min = std::min(task_min, dif);
+                    task_max = std::max(task_max, dif);
+                    distances.Set(i, j, dif);
+                }
+            }
+        };
+        if (num_tasks > 1) {
+            boost::asio::thread_pool pool(num_tasks);
+            for (std::size_t task = 0; task < num_tasks; task++) {
+                boost::asio::post(pool, [&calculate, task]() { calculate(task); });
+            }
+            pool.join();
+        } else {
+            calculate(0);
+        }
+        for (model::DFConstraint const& task_dif : task_min_max) {
+            min_dif = std::min(min_dif, task_dif.lower_bound);
+            max_dif = std::max(max_dif, task_dif.upper_bound);
+        }
     }
+    if (has_equal_values) min_dif = 0;
+    min_max_dif = {min_dif, max_dif};
+    return distances;
 }
 
 void Split::CalculateAllDistances() {
-    distances_ = std::vector<std::vector<std::vector<double>>>(
-            num_columns_,
-            std::vector<std::vector<double>>(num_rows_, std::vector<double>(num_rows_, 0)));
+    distances_.clear();
+    distances_.reserve(num_columns_);
     min_max_dif_ = std::vector<model::DFConstraint>(num_columns_, {0, 0});
 
     for (model::ColumnIndex column_index = 0; column_index < num_columns_; column_index++) {
-        std::shared_ptr<model::PLI const> pli =
-                relation_->GetColumnData(column_index).GetPliOwnership();
-        std::deque<model::PLI::Cluster> const& index = pli->GetIndex();
-        std::shared_ptr<std::vector<int> const> probing_table = pli->CalculateAndGetProbingTable();
-        model::PLI::Cluster const& pt = *probing_table.get();
-
-        double max_dif = 0, min_dif = std::numeric_limits<double>::max();
-        for (std::size_t i = 0; i < index.size(); i++) {
-            for (std::size_t j = 0; j < index.size(); j++) {
-                std::size_t const first_index = index[i][0];
-                std::size_t const second_index = index[j][0];
-                if (first_index < num_rows_ && second_index < num_rows_) {
-                    InsertDistance(column_index, first_index, second_index, min_dif, max_dif);
-                }
-            }
-        }
-        for (std::size_t i = 0; i < num_rows_; i++) {
-            for (std::size_t j = 0; j < num_rows_; j++) {
-                if (pt[i] != 0 && pt[j] != 0) {
-                    distances_[column_index][i][j] =
-                            distances_[column_index][index[pt[i] - 1][0]][index[pt[j] - 1][0]];
-                    if (i != j && pt[i] == pt[j]) {
-                        min_dif = 0;
-                    }
-                } else {
-                    InsertDistance(column_index, i, j, min_dif, max_dif);
-                }
-            }
-        }
-        min_max_dif_[column_index] = {min_dif, max_dif};
+        distances_.push_back(CalculateColumnDistances(column_index, min_max_dif_[column_index]));
     }
 }
 
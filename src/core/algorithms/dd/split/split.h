@@ -9,7 +9,9 @@
 
 #include "algorithms/algorithm.h"
 #include "algorithms/dd/dd.h"
+#include "column_distances.h"
 #include "config/tabular_data/input_table_type.h"
+#include "config/thread_number/type.h"
 #include "enums.h"
 #include "model/table/column_index.h"
 #include "model/table/column_layout_relation_data.h"
@@ -30,6 +32,7 @@ private:
     model::ColumnIndex num_columns_;
 
     bool has_dif_table_;
+    config::ThreadNumType threads_num_ = 1;
 
     config::InputTable difference_table_;
     std::unique_ptr<model::ColumnLayoutTypedRelationData> difference_typed_relation_;
@@ -38,7 +41,7 @@ private:
     unsigned const num_dfs_per_column_ = 5;
 
     std::vector<model::DFConstraint> min_max_dif_;
-    std::vector<std::vector<std::vector<double>>> distances_;
+    std::vector<ColumnDistances> distances_;
     std::vector<std::pair<std::size_t, std::size_t>> tuple_pairs_;
     std::list<DD> dd_collection_;
 
@@ -50,10 +53,11 @@ private:
         dd_collection_.clear();
     }
 
+    void CheckValues(model::ColumnIndex column_index, std::vector<std::size_t> const& rows);
     double CalculateDistance(model::ColumnIndex column_index,
                              std::pair<std::size_t, std::size_t> tuple_pair);
-    void InsertDistance(model::ColumnIndex column_index, std::size_t first_index,
-                        std::size_t second_index, double& min_dif, double& max_dif);
+    ColumnDistances CalculateColumnDistances(model::ColumnIndex column_index,
+                                             model::DFConstraint& min_max_dif);
     bool CheckDF(DF const& dep, std::pair<std::size_t, std::size_t> tuple_pair);
     bool VerifyDD(DD const& dep);
     void CalculateAllDistances();
@@ -6,6 +6,7 @@
 
 #include <easylogging++.h>
 
+#include "config/thread_number/option.h"
 #include "model/table/agree_set_factory.h"
 #include "model/table/relational_schema.h"
 
@@ -15,6 +16,10 @@ Depminer::Depminer(std::optional<ColumnLayoutRelationDataManager> relation_manag
     : PliBasedFDAlgorithm({"AgreeSets generation", "Finding CMAXSets", "Finding LHS"},
                           relation_manager) {}
 
+void Depminer::MakeExecuteOptsAvailableFDInternal() {
+    MakeOptionsAvailable({config::kThreadNumberOpt.GetName()});
+}
+
 using boost::dynamic_bitset, std::make_shared, std::shared_ptr, std::setw, std::vector, std::list,
         std::dynamic_pointer_cast;
 
@@ -26,8 +31,9 @@ unsigned long long Depminer::ExecuteInternal() {
     progress_step_ = kTotalProgressPercent / schema_->GetNumColumns();
 
     // Agree sets
-    model::AgreeSetFactory const agree_set_factory =
-            model::AgreeSetFactory(relation_.get(), model::AgreeSetFactory::Configuration(), this);
+    model::AgreeSetFactory::Configuration c(model::AgreeSetsGenMethod::kUsingTupleBlocks);
+    c.threads_num = threads_num_;
+    model::AgreeSetFactory const agree_set_factory(relation_.get(), c, this);
     auto const agree_sets = agree_set_factory.GenAgreeSets();
     ToNextProgressPhase();
 
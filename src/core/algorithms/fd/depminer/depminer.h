@@ -19,6 +19,7 @@ private:
     double progress_step_ = 0;
     RelationalSchema const* schema_ = nullptr;
 
+    void MakeExecuteOptsAvailableFDInternal() final;
     void ResetStateFd() final {}
 
     unsigned long long ExecuteInternal() final;
@@ -1,12 +1,15 @@
 #include "dfd.h"
 
 #include <boost/asio.hpp>
+#include <boost/format.hpp>
 #include <easylogging++.h>
 
 #include "config/max_lhs/option.h"
+#include "config/mem_limit/option.h"
 #include "config/thread_number/option.h"
 #include "lattice_traversal/lattice_traversal.h"
 #include "model/table/column_layout_relation_data.h"
+#include "model/table/pli_cache.h"
 #include "model/table/position_list_index.h"
 #include "model/table/relational_schema.h"
 
@@ -14,15 +17,11 @@ namespace algos {
 
 DFD::DFD(std::optional<ColumnLayoutRelationDataManager> relation_manager)
     : PliBasedFDAlgorithm({kDefaultPhaseName}, relation_manager) {
-    RegisterOptions();
-}
-
-void DFD::RegisterOptions() {
-    RegisterOption(config::kThreadNumberOpt(&number_of_threads_));
+    RegisterOption(config::kMemLimitMbOpt(&mem_limit_mb_));
 }
 
 void DFD::MakeExecuteOptsAvailableFDInternal() {
-    MakeOptionsAvailable({config::kThreadNumberOpt.GetName()});
+    MakeOptionsAvailable({config::kThreadNumberOpt.GetName(), config::kMemLimitMbOpt.GetName()});
 }
 
 void DFD::ResetStateFd() {
@@ -30,8 +29,8 @@ void DFD::ResetStateFd() {
 }
 
 unsigned long long DFD::ExecuteInternal() {
-    auto partition_storage = std::make_unique<PartitionStorage>(
-            relation_.get(), CachingMethod::kAllCaching, CacheEvictionMethod::kMedainUsage);
+    auto pli_cache =
+            std::make_unique<model::PLICache>(relation_.get(), std::size_t{mem_limit_mb_} << 20);
     RelationalSchema const* const schema = relation_->GetSchema();
 
     auto start_time = std::chrono::system_clock::now();
@@ -49,11 +48,11 @@ unsigned long long DFD::ExecuteInternal() {
     }
 
     double progress_step = 100.0 / schema->GetNumColumns();
-    boost::asio::thread_pool search_space_pool(number_of_threads_);
+    boost::asio::thread_pool search_space_pool(threads_num_);
 
     for (auto& rhs : schema->GetColumns()) {
         boost::asio::post(
-                search_space_pool, [this, &rhs, schema, progress_step, &partition_storage]() {
+                search_space_pool, [this, &rhs, schema, progress_step, &pli_cache]() {
                     ColumnData const& rhs_data = relation_->GetColumnData(rhs->GetIndex());
                     model::PositionListIndex const* const rhs_pli = rhs_data.GetPositionListIndex();
 
@@ -68,7 +67,7 @@ unsigned long long DFD::ExecuteInternal() {
                     }
 
                     auto search_space = LatticeTraversal(rhs.get(), relation_.get(),
-                                                         unique_columns_, partition_storage.get());
+                                                         unique_columns_, pli_cache.get());
                     auto const minimal_deps = search_space.FindLHSs();
 
                     for (auto const& minimal_dependency_lhs : minimal_deps) {
@@ -87,6 +86,8 @@ unsigned long long DFD::ExecuteInternal() {
     long long apriori_millis = elapsed_milliseconds.count();
 
     LOG(INFO) << "> FD COUNT: " << fd_collection_.Size();
+    LOG(INFO) << boost::format{"> PLI cache: %1% hits, %2% misses, %3% evictions"} %
+                         pli_cache->GetHits() % pli_cache->GetMisses() % pli_cache->GetEvictions();
     LOG(INFO) << "> HASH: " << PliBasedFDAlgorithm::Fletcher16();
 
     return apriori_millis;
@@ -7,14 +7,14 @@
 LatticeTraversal::LatticeTraversal(Column const* const rhs,
                                    ColumnLayoutRelationData const* const relation,
                                    std::vector<Vertical> const& unique_verticals,
-                                   PartitionStorage* const partition_storage)
+                                   model::PLICache* const pli_cache)
     : rhs_(rhs),
       dependencies_map_(relation->GetSchema()),
       non_dependencies_map_(relation->GetSchema()),
       column_order_(relation),
       unique_columns_(unique_verticals),
       relation_(relation),
-      partition_storage_(partition_storage),
+      pli_cache_(pli_cache),
       gen_(rd_()) {}
 
 std::unordered_set<Vertical> LatticeTraversal::FindLHSs() {
@@ -71,22 +71,10 @@ std::unordered_set<Vertical> LatticeTraversal::FindLHSs() {
                     }
                 } else if (!InferCategory(node, rhs_->GetIndex())) {
                     // if we were not able to infer category, we calculate the partitions
-                    auto node_pli = partition_storage_->GetOrCreateFor(node);
-                    auto node_pli_pointer =
-                            std::holds_alternative<model::PositionListIndex*>(node_pli)
-                                    ? std::get<model::PositionListIndex*>(node_pli)
-                                    : std::get<std::unique_ptr<model::PositionListIndex>>(node_pli)
-                                              .get();
-                    auto intersected_pli = partition_storage_->GetOrCreateFor(node.Union(*rhs_));
-                    auto intersected_pli_pointer =
-                            std::holds_alternative<model::PositionListIndex*>(intersected_pli)
-                                    ? std::get<model::PositionListIndex*>(intersected_pli)
-                                    : std::get<std::unique_ptr<model::PositionListIndex>>(
-                                              intersected_pli)
-                                              .get();
-
-                    if (node_pli_pointer->GetNepAsLong() ==
-                        intersected_pli_pointer->GetNepAsLong()) {
+                    auto node_pli = pli_cache_->GetOrCreateFor(node);
+                    auto intersected_pli = pli_cache_->GetOrCreateFor(node.Union(*rhs_));
+
+                    if (node_pli->GetNepAsLong() == intersected_pli->GetNepAsLong()) {
                         observations_.UpdateDependencyCategory(node);
                         if (observations_[node] == NodeCategory::kMinimalDependency) {
                             minimal_deps_.insert(node);
@@ -5,9 +5,9 @@
 
 #include "../column_order/column_order.h"
 #include "../lattice_observations/lattice_observations.h"
-#include "../partition_storage/partition_storage.h"
 #include "../pruning_maps/dependencies_map.h"
 #include "../pruning_maps/non_dependencies_map.h"
+#include "model/table/pli_cache.h"
 #include "model/table/vertical.h"
 
 class LatticeTraversal {
@@ -24,7 +24,7 @@ private:
 
     std::vector<Vertical> const& unique_columns_;
     ColumnLayoutRelationData const* const relation_;
-    PartitionStorage* const partition_storage_;
+    model::PLICache* const pli_cache_;
 
     std::random_device rd_;
     std::mt19937 gen_;
@@ -41,7 +41,7 @@ private:
 public:
     LatticeTraversal(Column const* const rhs, ColumnLayoutRelationData const* const relation,
                      std::vector<Vertical> const& unique_verticals,
-                     PartitionStorage* const partition_storage);
+                     model::PLICache* const pli_cache);
 
     std::unordered_set<Vertical> FindLHSs();
 };
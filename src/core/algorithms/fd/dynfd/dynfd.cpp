@@ -0,0 +1,514 @@
+#include "algorithms/fd/dynfd/dynfd.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <deque>
+#include <set>
+#include <stdexcept>
+
+#include <boost/functional/hash.hpp>
+#include <easylogging++.h>
+
+#include "config/equal_nulls/option.h"
+#include "config/exceptions.h"
+#include "config/tabular_data/crud_operations/operations.h"
+#include "config/tabular_data/input_table/option.h"
+#include "model/table/column_layout_relation_data.h"
+
+namespace algos::dynfd {
+
+DynFD::DynFD() : FDAlgorithm({kDefaultPhaseName}) {
+    RegisterOptions();
+    MakeOptionsAvailable({config::kTableOpt.GetName(), config::kEqualNullsOpt.GetName()});
+}
+
+void DynFD::RegisterOptions() {
+    auto check_schema = [this](config::InputTable const& batch, size_t skipped_columns,
+                               std::string const& statements) {
+        if (batch->GetNumberOfColumns() != num_columns_ + skipped_columns) {
+            throw config::ConfigurationError("Schema mismatch: " + statements +
+                                             " statements have a wrong number of columns");
+        }
+        for (size_t i = 0; i < num_columns_; ++i) {
+            if (batch->GetColumnName(i + skipped_columns) != schema_->GetColumn(i)->GetName()) {
+                throw config::ConfigurationError("Schema mismatch: " + statements +
+                                                 " statements' column names must match the "
+                                                 "input table");
+            }
+        }
+    };
+
+    auto check_inserts = [check_schema](config::InputTable insert_batch) {
+        if (insert_batch == nullptr || !insert_batch->HasNextRow()) {
+            return;
+        }
+        check_schema(insert_batch, 0, "insert");
+    };
+
+    auto check_deletes = [this](std::unordered_set<size_t> const& delete_batch) {
+        for (size_t id : delete_batch) {
+            if (!IsRowAlive(id)) {
+                throw config::ConfigurationError("Attempt to delete a non-existing row");
+            }
+        }
+    };
+
+    auto check_updates = [this, check_schema](config::InputTable update_batch) {
+        if (update_batch == nullptr || !update_batch->HasNextRow()) {
+            return;
+        }
+        // the first column holds the ids of the rows to update
+        check_schema(update_batch, 1, "update");
+        std::unordered_set<size_t> rows_to_update;
+        while (update_batch->HasNextRow()) {
+            auto row = update_batch->GetNextRow();
+            size_t id = std::stoull(row.front());
+            if (!IsRowAlive(id)) {
+                throw config::ConfigurationError("Attempt to update a non-existing row");
+            }
+            if (!rows_to_update.emplace(id).second) {
+                throw config::ConfigurationError("Update statements have duplicates");
+            }
+        }
+        update_batch->Reset();
+    };
+
+    RegisterOption(config::kTableOpt(&input_table_));
+    RegisterOption(config::kEqualNullsOpt(&is_null_equal_null_));
+    RegisterOption(
+            config::kInsertStatementsOpt(&insert_statements_table_).SetValueCheck(check_inserts));
+    RegisterOption(
+            config::kDeleteStatementsOpt(&delete_statement_indices_).SetValueCheck(check_deletes));
+    RegisterOption(
+            config::kUpdateStatementsOpt(&update_statements_table_).SetValueCheck(check_updates));
+}
+
+void DynFD::MakeExecuteOptsAvailableFDInternal() {
+    MakeOptionsAvailable(kCrudOptions);
+}
+
+void DynFD::LoadDataInternal() {
+    num_columns_ = input_table_->GetNumberOfColumns();
+    if (num_columns_ == 0) {
+        throw std::runtime_error("Unable to work on an empty dataset.");
+    }
+    schema_ = std::make_unique<RelationalSchema>(input_table_->GetRelationName());
+    for (size_t i = 0; i < num_columns_; ++i) {
+        schema_->AppendColumn(input_table_->GetColumnName(i));
+    }
+
+    records_.clear();
+    num_rows_alive_ = 0;
+    value_dictionary_.clear();
+    next_value_id_ = 1;
+    next_null_id_ = ColumnLayoutRelationData::kNullValueId;
+
+    std::vector<model::DynPLI::ClusterValue> no_records;
+    plis_.clear();
+    for (size_t i = 0; i < num_columns_; ++i) {
+        plis_.push_back(model::DynPLI::CreateFor(no_records));
+    }
+    // every FD holds on an empty table, the initial rows are inserted as one batch
+    positive_cover_.assign(num_columns_, {Lhs(num_columns_)});
+    negative_cover_.assign(num_columns_, {});
+
+    std::vector<std::pair<std::optional<size_t>, std::vector<int>>> rows;
+    while (input_table_->HasNextRow()) {
+        std::vector<std::string> row = input_table_->GetNextRow();
+        if (row.size() != num_columns_) {
+            LOG(WARNING) << "Received row with size " << row.size() << ", but expected "
+                         << num_columns_;
+            continue;
+        }
+        rows.emplace_back(std::nullopt, EncodeRow(row.cbegin()));
+    }
+    ProcessInserts(ApplyInserts(std::move(rows)));
+}
+
+unsigned long long DynFD::ExecuteInternal() {
+    auto start_time = std::chrono::system_clock::now();
+
+    std::vector<std::pair<std::optional<size_t>, std::vector<int>>> inserted_rows;
+    std::unordered_set<size_t> deleted_rows = delete_statement_indices_;
+    if (insert_statements_table_ != nullptr) {
+        while (insert_statements_table_->HasNextRow()) {
+            std::vector<std::string> row = insert_statements_table_->GetNextRow();
+            if (row.size() != num_columns_) {
+                LOG(WARNING) << "Received row with size " << row.size() << ", but expected "
+                             << num_columns_;
+                continue;
+            }
+            inserted_rows.emplace_back(std::nullopt, EncodeRow(row.cbegin()));
+        }
+    }
+    if (update_statements_table_ != nullptr) {
+        while (update_statements_table_->HasNextRow()) {
+            std::vector<std::string> row = update_statements_table_->GetNextRow();
+            if (row.size() != num_columns_ + 1) {
+                LOG(WARNING) << "Received row with size " << row.size() << ", but expected "
+                             << num_columns_ + 1;
+                continue;
+            }
+            size_t const row_id = std::stoull(row.front());
+            inserted_rows.emplace_back(row_id, EncodeRow(row.cbegin() + 1));
+            deleted_rows.insert(row_id);
+        }
+    }
+
+    // an update is a delete followed by an insert with the same id, the covers are exact for the
+    // table without the deleted rows before the inserts are processed
+    ApplyDeletes(deleted_rows);
+    ProcessDeletes(deleted_rows);
+    ProcessInserts(ApplyInserts(std::move(inserted_rows)));
+
+    RegisterFds();
+
+    auto elapsed_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now() - start_time);
+    return elapsed_milliseconds.count();
+}
+
+std::vector<int> DynFD::EncodeRow(std::vector<std::string>::const_iterator row_begin) {
+    std::vector<int> record;
+    record.reserve(num_columns_);
+    for (auto it = row_begin; it != row_begin + num_columns_; ++it) {
+        if (it->empty()) {
+            record.push_back(is_null_equal_null_ ? ColumnLayoutRelationData::kNullValueId
+                                                 : next_null_id_--);
+            continue;
+        }
+        auto [value_it, is_value_new] = value_dictionary_.try_emplace(*it, next_value_id_);
+        if (is_value_new) {
+            next_value_id_++;
+        }
+        record.push_back(value_it->second);
+    }
+    return record;
+}
+
+void DynFD::ApplyDeletes(std::unordered_set<size_t> const& rows) {
+    for (size_t column = 0; column < num_columns_; ++column) {
+        std::vector<std::pair<size_t, model::DynPLI::ClusterValue>> deleted;
+        deleted.reserve(rows.size());
+        for (size_t row : rows) {
+            deleted.emplace_back(row, model::DynPLI::ClusterValue{records_[row][column]});
+        }
+        plis_[column]->UpdateClustersWith({}, deleted);
+    }
+    for (size_t row : rows) {
+        records_[row] = {};
+    }
+    num_rows_alive_ -= rows.size();
+}
+
+std::vector<size_t> DynFD::ApplyInserts(
+        std::vector<std::pair<std::optional<size_t>, std::vector<int>>> rows) {
+    for (size_t column = 0; column < num_columns_; ++column) {
+        std::vector<std::pair<std::optional<size_t>, model::DynPLI::ClusterValue>> inserted;
+        inserted.reserve(rows.size());
+        for (auto const& [row_id, record] : rows) {
+            inserted.emplace_back(row_id, model::DynPLI::ClusterValue{record[column]});
+        }
+        plis_[column]->UpdateClustersWith(inserted, {});
+    }
+
+    std::vector<size_t> row_ids;
+    row_ids.reserve(rows.size());
+    for (auto& [row_id, record] : rows) {
+        // the PLIs give new rows consecutive ids, the same as their positions in records_
+        if (!row_id.has_value()) {
+            row_id = records_.size();
+            records_.emplace_back();
+        }
+        records_[*row_id] = std::move(record);
+        row_ids.push_back(*row_id);
+    }
+    num_rows_alive_ += rows.size();
+    assert(plis_.front()->GetRelationSize() == records_.size());
+    return row_ids;
+}
+
+DynFD::Lhs DynFD::GetAgreeSet(size_t first_row, size_t second_row) const {
+    Lhs agree_set(num_columns_);
+    for (size_t column = 0; column < num_columns_; ++column) {
+        if (records_[first_row][column] == records_[second_row][column]) {
+            agree_set.set(column);
+        }
+    }
+    return agree_set;
+}
+
+bool DynFD::AgreeOn(Lhs const& lhs, size_t first_row, size_t second_row) const {
+    for (size_t column = lhs.find_first(); column != Lhs::npos; column = lhs.find_next(column)) {
+        if (records_[first_row][column] != records_[second_row][column]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<DynFD::RowPair> DynFD::FindViolation(Lhs const& lhs, size_t rhs,
+                                                   std::vector<size_t> const& rows_to_check) const {
+    if (lhs.none()) {
+        return FindViolation(lhs, rhs);
+    }
+
+    // rows agreeing with a checked row on lhs are in its smallest cluster among the lhs columns,
+    // scanning the whole table is cheaper when these clusters are large
+    std::vector<model::DynPLI::Cluster const*> clusters;
+    clusters.reserve(rows_to_check.size());
+    size_t num_comparisons = 0;
+    for (size_t row : rows_to_check) {
+        model::DynPLI::Cluster const* smallest = nullptr;
+        for (size_t column = lhs.find_first(); column != Lhs::npos;
+             column = lhs.find_next(column)) {
+            model::DynPLI::Cluster const* cluster =
+                    plis_[column]->FindCluster({records_[row][column]});
+            assert(cluster != nullptr);
+            if (smallest == nullptr || cluster->size() < smallest->size()) {
+                smallest = cluster;
+            }
+        }
+        num_comparisons += smallest->size();
+        if (num_comparisons > num_rows_alive_) {
+            return FindViolation(lhs, rhs);
+        }
+        clusters.push_back(smallest);
+    }
+
+    for (size_t i = 0; i < rows_to_check.size(); ++i) {
+        size_t const row = rows_to_check[i];
+        for (int other_row : *clusters[i]) {
+            if (records_[row][rhs] != records_[other_row][rhs] && AgreeOn(lhs, row, other_row)) {
+                return RowPair{row, other_row};
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<DynFD::RowPair> DynFD::FindViolation(Lhs const& lhs, size_t rhs) const {
+    if (lhs.none()) {
+        auto const& clusters = plis_[rhs]->GetClusters();
+        if (clusters.size() < 2) {
+            return std::nullopt;
+        }
+        auto it = clusters.begin();
+        size_t const first_row = it->second.front();
+        return RowPair{first_row, (++it)->second.front()};
+    }
+
+    // rows are grouped by the lhs column with the most clusters, the rest of lhs is hashed
+    size_t pivot = lhs.find_first();
+    for (size_t column = lhs.find_next(pivot); column != Lhs::npos;
+         column = lhs.find_next(column)) {
+        if (plis_[column]->GetNumCluster() > plis_[pivot]->GetNumCluster()) {
+            pivot = column;
+        }
+    }
+    std::vector<size_t> rest_columns;
+    for (size_t column = lhs.find_first(); column != Lhs::npos; column = lhs.find_next(column)) {
+        if (column != pivot) rest_columns.push_back(column);
+    }
+
+    std::unordered_map<std::vector<int>, size_t, boost::hash<std::vector<int>>> first_rows;
+    for (auto const& [value, cluster] : plis_[pivot]->GetClusters()) {
+        if (rest_columns.empty()) {
+            for (int row : cluster) {
+                if (records_[row][rhs] != records_[cluster.front()][rhs]) {
+                    return RowPair{cluster.front(), row};
+                }
+            }
+            continue;
+        }
+        first_rows.clear();
+        for (int row : cluster) {
+            std::vector<int> key;
+            key.reserve(rest_columns.size());
+            for (size_t column : rest_columns) {
+                key.push_back(records_[row][column]);
+            }
+            auto const [it, inserted] = first_rows.try_emplace(std::move(key), row);
+            if (!inserted && records_[it->second][rhs] != records_[row][rhs]) {
+                return RowPair{it->second, row};
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+bool DynFD::AddToNegativeCover(size_t rhs, Lhs const& lhs, RowPair witness) {
+    std::vector<NonFd>& non_fds = negative_cover_[rhs];
+    if (std::any_of(non_fds.begin(), non_fds.end(),
+                    [&lhs](NonFd const& non_fd) { return lhs.is_subset_of(non_fd.lhs); })) {
+        return false;
+    }
+    std::erase_if(non_fds, [&lhs](NonFd const& non_fd) { return non_fd.lhs.is_subset_of(lhs); });
+    non_fds.push_back({lhs, witness});
+    return true;
+}
+
+std::vector<DynFD::Lhs> DynFD::Specialize(size_t rhs, Lhs const& non_fd_lhs) {
+    std::vector<Lhs>& fds = positive_cover_[rhs];
+    std::vector<Lhs> invalid_lhss;
+    std::erase_if(fds, [&non_fd_lhs, &invalid_lhss](Lhs const& lhs) {
+        if (!lhs.is_subset_of(non_fd_lhs)) return false;
+        invalid_lhss.push_back(lhs);
+        return true;
+    });
+
+    std::vector<Lhs> added;
+    for (Lhs const& invalid_lhs : invalid_lhss) {
+        for (size_t attr = 0; attr < num_columns_; ++attr) {
+            if (attr == rhs || non_fd_lhs.test(attr)) continue;
+
+            Lhs specialization = invalid_lhs;
+            specialization.set(attr);
+            if (std::any_of(fds.begin(), fds.end(), [&specialization](Lhs const& lhs) {
+                    return lhs.is_subset_of(specialization);
+                })) {
+                continue;
+            }
+            // specializations of different invalid FDs may generalize each other
+            std::erase_if(fds, [&specialization](Lhs const& lhs) {
+                return specialization.is_proper_subset_of(lhs);
+            });
+            fds.push_back(specialization);
+            added.push_back(std::move(specialization));
+        }
+    }
+    return added;
+}
+
+void DynFD::Generalize(size_t rhs, std::vector<Lhs> const& valid_lhss) {
+    std::vector<NonFd> const& non_fds = negative_cover_[rhs];
+    auto is_non_fd = [&non_fds](Lhs const& lhs) {
+        return std::any_of(non_fds.begin(), non_fds.end(),
+                           [&lhs](NonFd const& non_fd) { return lhs.is_subset_of(non_fd.lhs); });
+    };
+
+    // the FDs of the positive cover still hold, only their generalizations that became valid can
+    // replace them, and these are the valid left-hand sides whose every generalization is a non-FD
+    std::vector<Lhs>& fds = positive_cover_[rhs];
+    for (Lhs const& lhs : valid_lhss) {
+        bool is_minimal = true;
+        for (size_t attr = lhs.find_first(); attr != Lhs::npos && is_minimal;
+             attr = lhs.find_next(attr)) {
+            Lhs generalization = lhs;
+            generalization.reset(attr);
+            is_minimal = is_non_fd(generalization);
+        }
+        if (!is_minimal) continue;
+
+        std::erase_if(fds, [&lhs](Lhs const& fd) { return lhs.is_proper_subset_of(fd); });
+        fds.push_back(lhs);
+    }
+}
+
+void DynFD::ProcessDeletes(std::unordered_set<size_t> const& deleted_rows) {
+    if (deleted_rows.empty()) {
+        return;
+    }
+
+    for (size_t rhs = 0; rhs < num_columns_; ++rhs) {
+        std::vector<Lhs> valid_lhss;
+        std::vector<NonFd>& non_fds = negative_cover_[rhs];
+        for (auto it = non_fds.begin(); it != non_fds.end();) {
+            auto const& [first_row, second_row] = it->witness;
+            if (!deleted_rows.contains(first_row) && !deleted_rows.contains(second_row)) {
+                ++it;
+                continue;
+            }
+            if (std::optional<RowPair> violation = FindViolation(it->lhs, rhs)) {
+                it->witness = *violation;
+                ++it;
+            } else {
+                valid_lhss.push_back(std::move(it->lhs));
+                it = non_fds.erase(it);
+            }
+        }
+
+        if (!valid_lhss.empty()) {
+            Generalize(rhs, FindMaximalNonFds(rhs, std::move(valid_lhss)));
+        }
+    }
+}
+
+std::vector<DynFD::Lhs> DynFD::FindMaximalNonFds(size_t rhs, std::vector<Lhs> valid_lhss) {
+    // the new maximal non-FDs are generalizations of the ones that now hold, they are searched
+    // top-down, descending only from the left-hand sides found valid
+    std::set<Lhs> visited;
+    size_t level_begin = 0;
+    while (level_begin != valid_lhss.size()) {
+        size_t const level_end = valid_lhss.size();
+        for (size_t i = level_begin; i < level_end; ++i) {
+            for (size_t attr = valid_lhss[i].find_first(); attr != Lhs::npos;
+                 attr = valid_lhss[i].find_next(attr)) {
+                Lhs lhs = valid_lhss[i];
+                lhs.reset(attr);
+                if (!visited.insert(lhs).second) continue;
+
+                std::vector<NonFd> const& non_fds = negative_cover_[rhs];
+                if (std::any_of(non_fds.begin(), non_fds.end(), [&lhs](NonFd const& non_fd) {
+                        return lhs.is_subset_of(non_fd.lhs);
+                    })) {
+                    continue;
+                }
+                if (std::optional<RowPair> violation = FindViolation(lhs, rhs)) {
+                    AddToNegativeCover(rhs, lhs, *violation);
+                } else {
+                    valid_lhss.push_back(std::move(lhs));
+                }
+            }
+        }
+        level_begin = level_end;
+    }
+    return valid_lhss;
+}
+
+void DynFD::ProcessInserts(std::vector<size_t> const& inserted_rows) {
+    if (inserted_rows.empty()) {
+        return;
+    }
+
+    // FDs of the positive cover held before the inserts, so only the pairs with an inserted row
+    // can violate them and their specializations
+    std::deque<std::pair<Lhs, size_t>> candidates;
+    for (size_t rhs = 0; rhs < num_columns_; ++rhs) {
+        for (Lhs const& lhs : positive_cover_[rhs]) {
+            candidates.emplace_back(lhs, rhs);
+        }
+    }
+
+    while (!candidates.empty()) {
+        auto [lhs, rhs] = std::move(candidates.front());
+        candidates.pop_front();
+        std::vector<Lhs> const& fds = positive_cover_[rhs];
+        if (std::find(fds.begin(), fds.end(), lhs) == fds.end()) continue;
+
+        std::optional<RowPair> violation = FindViolation(lhs, rhs, inserted_rows);
+        if (!violation) continue;
+
+        // the pair violates an FD for every attribute it disagrees on
+        Lhs const agree_set = GetAgreeSet(violation->first, violation->second);
+        for (size_t attr = 0; attr < num_columns_; ++attr) {
+            if (agree_set.test(attr) || !AddToNegativeCover(attr, agree_set, *violation)) {
+                continue;
+            }
+            for (Lhs& specialization : Specialize(attr, agree_set)) {
+                candidates.emplace_back(std::move(specialization), attr);
+            }
+        }
+    }
+}
+
+void DynFD::RegisterFds() {
+    for (size_t rhs = 0; rhs < num_columns_; ++rhs) {
+        for (Lhs const& lhs : positive_cover_[rhs]) {
+            RegisterFd(Vertical(schema_.get(), lhs), *schema_->GetColumn(rhs));
+        }
+    }
+}
+
+}  // namespace algos::dynfd
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "algorithms/fd/fd_algorithm.h"
+#include "config/equal_nulls/type.h"
+#include "config/tabular_data/input_table_type.h"
+#include "model/table/dynamic_position_list_index.h"
+#include "model/table/relational_schema.h"
+
+namespace algos::dynfd {
+
+/* Incremental FD discovery. The minimal FDs (positive cover), the maximal non-FDs (negative
+ * cover) and single column dynamic PLIs are kept between Execute() calls, every call applies a
+ * batch of insert, update and delete statements and updates the covers from the rows changed.
+ *
+ * Inserts can only invalidate FDs: the FDs of the positive cover are validated against the
+ * inserted rows only, violations become non-FDs that specialize the positive cover. Deletes can
+ * only turn non-FDs into FDs: every non-FD stores a pair of rows violating it, only the non-FDs
+ * whose pair was deleted are validated again. The generalizations of the ones that now hold are
+ * walked top-down to the new maximal non-FDs, and the valid left-hand sides met on the way whose
+ * generalizations are all non-FDs replace the FDs of the positive cover they generalize. A batch
+ * of deletes costs a pass over the table for every left-hand side walked, each also checked
+ * against the negative cover, the rest of the covers is not touched.
+ */
+class DynFD : public FDAlgorithm {
+private:
+    using Lhs = boost::dynamic_bitset<>;
+    using RowPair = std::pair<size_t, size_t>;
+
+    /* Maximal non-FD of the negative cover with a pair of rows violating it */
+    struct NonFd {
+        Lhs lhs;
+        RowPair witness;
+    };
+
+    config::InputTable input_table_;
+    config::EqNullsType is_null_equal_null_;
+    config::InputTable insert_statements_table_ = nullptr;
+    config::InputTable update_statements_table_ = nullptr;
+    std::unordered_set<size_t> delete_statement_indices_;
+
+    std::unique_ptr<RelationalSchema> schema_;
+    size_t num_columns_ = 0;
+
+    /* Dictionary encoded rows by row id, deleted rows are empty */
+    std::vector<std::vector<int>> records_;
+    size_t num_rows_alive_ = 0;
+    std::unordered_map<std::string, int> value_dictionary_;
+    int next_value_id_ = 1;
+    /* Nulls get negative ids, distinct ones if nulls are not equal */
+    int next_null_id_ = -1;
+    /* Clusters of every column by value */
+    std::vector<std::unique_ptr<model::DynPLI>> plis_;
+
+    /* Minimal left-hand sides of every right-hand side */
+    std::vector<std::vector<Lhs>> positive_cover_;
+    /* Maximal left-hand sides that don't determine every right-hand side */
+    std::vector<std::vector<NonFd>> negative_cover_;
+
+    void RegisterOptions();
+    void MakeExecuteOptsAvailableFDInternal() final;
+    void LoadDataInternal() final;
+    /* The covers are the state of the algorithm and are kept between executions */
+    void ResetStateFd() final {}
+    unsigned long long ExecuteInternal() final;
+
+    bool IsRowAlive(size_t row) const noexcept {
+        return row < records_.size() && !records_[row].empty();
+    }
+
+    std::vector<int> EncodeRow(std::vector<std::string>::const_iterator row_begin);
+    Lhs GetAgreeSet(size_t first_row, size_t second_row) const;
+    bool AgreeOn(Lhs const& lhs, size_t first_row, size_t second_row) const;
+
+    /* Pair of rows violating lhs -> rhs with one of the rows in rows_to_check */
+    std::optional<RowPair> FindViolation(Lhs const& lhs, size_t rhs,
+                                         std::vector<size_t> const& rows_to_check) const;
+    /* Pair of rows violating lhs -> rhs in the whole table */
+    std::optional<RowPair> FindViolation(Lhs const& lhs, size_t rhs) const;
+
+    /* Adds lhs -> rhs to the negative cover unless a more specific non-FD is there */
+    bool AddToNegativeCover(size_t rhs, Lhs const& lhs, RowPair witness);
+    /* Replaces the FDs of the positive cover that are generalizations of the non-FD with their
+     * minimal specializations, returns the left-hand sides added */
+    std::vector<Lhs> Specialize(size_t rhs, Lhs const& non_fd_lhs);
+    /* Adds the minimal ones of the left-hand sides that became valid to the positive cover and
+     * removes the FDs that specialize them */
+    void Generalize(size_t rhs, std::vector<Lhs> const& valid_lhss);
+
+    void ProcessDeletes(std::unordered_set<size_t> const& deleted_rows);
+    void ProcessInserts(std::vector<size_t> const& inserted_rows);
+    /* Updates the negative cover of rhs after non-FDs stopped being violated, returns these and
+     * every generalization of them found valid */
+    std::vector<Lhs> FindMaximalNonFds(size_t rhs, std::vector<Lhs> valid_lhss);
+
+    void ApplyDeletes(std::unordered_set<size_t> const& rows);
+    std::vector<size_t> ApplyInserts(
+            std::vector<std::pair<std::optional<size_t>, std::vector<int>>> rows);
+
+    void RegisterFds();
+
+public:
+    DynFD();
+};
+
+}  // namespace algos::dynfd
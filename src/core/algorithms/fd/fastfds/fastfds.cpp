@@ -20,13 +20,7 @@ namespace algos {
 using std::vector, std::set;
 
 FastFDs::FastFDs(std::optional<ColumnLayoutRelationDataManager> relation_manager)
-    : PliBasedFDAlgorithm({"Agree sets generation", "Finding minimal covers"}, relation_manager) {
-    RegisterOptions();
-}
-
-void FastFDs::RegisterOptions() {
-    RegisterOption(config::kThreadNumberOpt(&threads_num_));
-}
+    : PliBasedFDAlgorithm({"Agree sets generation", "Finding minimal covers"}, relation_manager) {}
 
 void FastFDs::MakeExecuteOptsAvailableFDInternal() {
     MakeOptionsAvailable({config::kThreadNumberOpt.GetName()});
@@ -266,12 +260,8 @@ vector<FastFDs::DiffSet> FastFDs::GetDiffSetsMod(Column const& col) const {
 }
 
 void FastFDs::GenDiffSets() {
-    model::AgreeSetFactory::Configuration c;
+    model::AgreeSetFactory::Configuration c(model::AgreeSetsGenMethod::kUsingTupleBlocks);
     c.threads_num = threads_num_;
-    if (threads_num_ > 1) {
-        // Not implemented properly, check the description of AgreeSetFactory::GenMcParallel()
-        // c.mc_gen_method = MCGenMethod::kParallel;
-    }
     model::AgreeSetFactory factory(relation_.get(), c, this);
     model::AgreeSetFactory::SetOfAgreeSets agree_sets = factory.GenAgreeSets();
 
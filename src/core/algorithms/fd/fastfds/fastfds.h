@@ -6,7 +6,6 @@
 #include <boost/thread/mutex.hpp>
 
 #include "algorithms/fd/pli_based_fd_algorithm.h"
-#include "config/thread_number/type.h"
 #include "model/table/column_layout_relation_data.h"
 #include "model/table/vertical.h"
 
@@ -20,7 +19,6 @@ private:
     using OrderingComparator = std::function<bool(Column const&, Column const&)>;
     using DiffSet = Vertical;
 
-    void RegisterOptions();
     void MakeExecuteOptsAvailableFDInternal() final;
 
     void ResetStateFd() final;
@@ -69,7 +67,6 @@ private:
 
     RelationalSchema const* schema_;
     std::vector<DiffSet> diff_sets_;
-    config::ThreadNumType threads_num_;
     double percent_per_col_;
 };
 
@@ -2,14 +2,13 @@
 
 #include <filesystem>
 #include <list>
-#include <mutex>
 
 #include <boost/any.hpp>
 
 #include "algorithms/algorithm.h"
 #include "algorithms/fd/fd.h"
+#include "algorithms/fd/fd_collection.h"
 #include "config/max_lhs/type.h"
-#include "util/primitive_collection.h"
 
 namespace model {
 class AgreeSetFactory;
@@ -38,18 +37,18 @@ protected:
      * Every FD mining algorithm should place discovered dependecies here. Don't add new FDs by
      * accessing this field directly, use RegisterFd methods instead
      */
-    util::PrimitiveCollection<FD> fd_collection_;
+    FDCollection fd_collection_;
 
     /* Registers new FD.
      * Should be overrided if custom behavior is needed
      */
     virtual void RegisterFd(Vertical lhs, Column rhs) {
-        if (lhs.GetArity() <= max_lhs_) fd_collection_.Register(std::move(lhs), std::move(rhs));
+        if (lhs.GetArity() <= max_lhs_) fd_collection_.Register(lhs, rhs);
     }
 
     virtual void RegisterFd(FD fd_to_register) {
         if (fd_to_register.GetLhs().GetArity() <= max_lhs_)
-            fd_collection_.Register(std::move(fd_to_register));
+            fd_collection_.Register(fd_to_register);
     }
 
 public:
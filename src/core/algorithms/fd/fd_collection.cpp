@@ -0,0 +1,63 @@
+#include "algorithms/fd/fd_collection.h"
+
+#include <cassert>
+
+namespace algos {
+
+size_t FDCollection::GetNumBlocks() const {
+    RelationalSchema const* schema = schema_.load(std::memory_order_relaxed);
+    return (schema->GetNumColumns() + boost::dynamic_bitset<>::bits_per_block - 1) /
+           boost::dynamic_bitset<>::bits_per_block;
+}
+
+void FDCollection::Register(Vertical const& lhs, Column const& rhs) {
+    RelationalSchema const* expected = nullptr;
+    schema_.compare_exchange_strong(expected, rhs.GetSchema(), std::memory_order_relaxed);
+    assert(expected == nullptr || expected == rhs.GetSchema());
+
+    Buffer& buffer = buffers_.Local();
+    size_t const num_blocks = GetNumBlocks();
+    boost::dynamic_bitset<> const& lhs_indices = lhs.GetColumnIndicesRef();
+    // an empty LHS may be passed as a default constructed Vertical without any blocks
+    assert(lhs_indices.num_blocks() <= num_blocks);
+    size_t const offset = buffer.lhs_blocks.size();
+    buffer.lhs_blocks.resize(offset + num_blocks);
+    boost::to_block_range(lhs_indices, buffer.lhs_blocks.begin() + offset);
+    buffer.rhs_indices.push_back(rhs.GetIndex());
+    buffer.size.store(buffer.rhs_indices.size(), std::memory_order_release);
+}
+
+void FDCollection::Gather() const {
+    RelationalSchema const* schema = schema_.load(std::memory_order_relaxed);
+    if (schema == nullptr) return;
+    size_t const num_blocks = GetNumBlocks();
+    buffers_.ForEach([this, schema, num_blocks](Buffer& buffer) {
+        auto blocks_it = buffer.lhs_blocks.begin();
+        for (model::ColumnIndex rhs_index : buffer.rhs_indices) {
+            boost::dynamic_bitset<> lhs_indices(schema->GetNumColumns());
+            boost::from_block_range(blocks_it, blocks_it + num_blocks, lhs_indices);
+            blocks_it += num_blocks;
+            collection_.emplace_back(Vertical(schema, std::move(lhs_indices)),
+                                     *schema->GetColumn(rhs_index));
+        }
+        buffer.lhs_blocks.clear();
+        buffer.rhs_indices.clear();
+        buffer.size.store(0, std::memory_order_relaxed);
+    });
+}
+
+void FDCollection::Clear() noexcept {
+    buffers_.Clear();
+    schema_.store(nullptr, std::memory_order_relaxed);
+    collection_.clear();
+}
+
+size_t FDCollection::Size() const {
+    size_t size = collection_.size();
+    buffers_.ForEach([&size](Buffer const& buffer) {
+        size += buffer.size.load(std::memory_order_acquire);
+    });
+    return size;
+}
+
+}  // namespace algos
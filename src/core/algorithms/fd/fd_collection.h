@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "algorithms/fd/fd.h"
+#include "model/table/column_index.h"
+#include "model/table/relational_schema.h"
+#include "util/per_thread_buffers.h"
+
+namespace algos {
+
+/* Collection of the discovered FDs. Registering is lock-free: every thread appends the blocks
+ * of the LHS bitset and the RHS index to its own buffer, FD objects are only built when the
+ * list is requested. All FDs must belong to the same schema.
+ */
+class FDCollection {
+private:
+    using Block = boost::dynamic_bitset<>::block_type;
+
+    struct Buffer {
+        /* LHS blocks of the FDs, GetNumBlocks() per FD */
+        std::vector<Block> lhs_blocks;
+        std::vector<model::ColumnIndex> rhs_indices;
+        /* Written by the owning thread only, read by Size() */
+        std::atomic<size_t> size = 0;
+    };
+
+    util::PerThreadBuffers<Buffer> mutable buffers_;
+    std::atomic<RelationalSchema const*> schema_ = nullptr;
+    std::list<FD> mutable collection_;
+
+    size_t GetNumBlocks() const;
+    void Gather() const;
+
+public:
+    void Register(Vertical const& lhs, Column const& rhs);
+
+    void Register(FD const& fd) {
+        Register(fd.GetLhs(), fd.GetRhs());
+    }
+
+    void Clear() noexcept;
+
+    /* Must not be called concurrently with AsList() */
+    size_t Size() const;
+
+    /* Calling code MUST guarantee that methods below won't interfere with the registering of
+     * new FDs or clearing (for the entire time the returned reference is held).
+     */
+    std::list<FD> const& AsList() const {
+        Gather();
+        return collection_;
+    }
+
+    std::list<FD>& AsList() {
+        Gather();
+        return collection_;
+    }
+};
+
+}  // namespace algos
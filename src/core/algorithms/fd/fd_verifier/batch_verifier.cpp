@@ -0,0 +1,249 @@
+#include "algorithms/fd/fd_verifier/batch_verifier.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+#include "config/equal_nulls/option.h"
+#include "config/exceptions.h"
+#include "config/indices/validate_index.h"
+#include "config/names_and_descriptions.h"
+#include "config/option_using.h"
+#include "config/tabular_data/input_table/option.h"
+#include "config/thread_number/option.h"
+
+namespace {
+
+void NormalizeIndices(config::IndicesType& indices) {
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+
+void ValidateIndices(config::IndicesType const& indices, size_t num_columns) {
+    if (indices.empty()) {
+        throw config::ConfigurationError("Indices cannot be empty");
+    }
+    config::ValidateIndex(indices.back(), num_columns);
+}
+
+/* Calls task(i) for every i < count, the calls are independent and run on a thread pool if more
+ * than one thread is used */
+template <typename Task>
+void ForEachIndex(size_t count, config::ThreadNumType threads_num, Task const& task) {
+    if (threads_num <= 1 || count <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+    boost::asio::thread_pool pool(threads_num);
+    for (size_t i = 0; i < count; ++i) {
+        boost::asio::post(pool, [&task, i]() { task(i); });
+    }
+    pool.join();
+}
+
+/* Returns true if every cluster of lhs lies inside one cluster of rhs, that is, lhs -> rhs holds */
+bool Refines(model::PLI const& lhs, model::PLI const& rhs) {
+    std::shared_ptr<std::vector<int> const> pt_shared = rhs.CalculateAndGetProbingTable();
+    std::vector<int> const& pt = *pt_shared;
+    for (model::PLI::ClusterView cluster : lhs.GetIndex()) {
+        int const value = pt[cluster.front()];
+        if (value == model::PLI::kSingletonValueId) {
+            return false;
+        }
+        for (int row : cluster) {
+            if (pt[row] != value) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+namespace algos::fd_verifier {
+
+BatchVerifier::BatchVerifier() : Algorithm({}) {
+    RegisterOptions();
+    MakeOptionsAvailable({config::kTableOpt.GetName(), config::kEqualNullsOpt.GetName()});
+}
+
+void BatchVerifier::RegisterOptions() {
+    DESBORDANTE_OPTION_USING;
+
+    auto get_num_columns = [this]() { return relation_->GetSchema()->GetNumColumns(); };
+    auto normalize_fds = [](std::vector<FdStatement>& fds) {
+        for (auto& [lhs, rhs] : fds) {
+            NormalizeIndices(lhs);
+            NormalizeIndices(rhs);
+        }
+    };
+    auto check_fds = [get_num_columns](std::vector<FdStatement> const& fds) {
+        for (auto const& [lhs, rhs] : fds) {
+            ValidateIndices(lhs, get_num_columns());
+            ValidateIndices(rhs, get_num_columns());
+        }
+    };
+    auto normalize_afds = [](std::vector<AfdStatement>& afds) {
+        for (auto& [lhs, rhs, error] : afds) {
+            NormalizeIndices(lhs);
+            NormalizeIndices(rhs);
+        }
+    };
+    auto check_afds = [get_num_columns](std::vector<AfdStatement> const& afds) {
+        for (auto const& [lhs, rhs, error] : afds) {
+            ValidateIndices(lhs, get_num_columns());
+            ValidateIndices(rhs, get_num_columns());
+            if (!(error >= 0 && error <= 1)) {
+                throw config::ConfigurationError("ERROR: error should be between 0 and 1.");
+            }
+        }
+    };
+    auto normalize_uccs = [](std::vector<UccStatement>& uccs) {
+        std::for_each(uccs.begin(), uccs.end(), NormalizeIndices);
+    };
+    auto check_uccs = [get_num_columns](std::vector<UccStatement> const& uccs) {
+        for (auto const& indices : uccs) {
+            ValidateIndices(indices, get_num_columns());
+        }
+    };
+
+    RegisterOption(config::kTableOpt(&input_table_));
+    RegisterOption(config::kEqualNullsOpt(&is_null_equal_null_));
+    RegisterOption(Option{&fds_, kFds, kDFds, std::vector<FdStatement>{}}
+                           .SetNormalizeFunc(normalize_fds)
+                           .SetValueCheck(check_fds));
+    RegisterOption(Option{&afds_, kAfds, kDAfds, std::vector<AfdStatement>{}}
+                           .SetNormalizeFunc(normalize_afds)
+                           .SetValueCheck(check_afds));
+    RegisterOption(Option{&uccs_, kUccs, kDUccs, std::vector<UccStatement>{}}
+                           .SetNormalizeFunc(normalize_uccs)
+                           .SetValueCheck(check_uccs));
+    RegisterOption(config::kThreadNumberOpt(&threads_num_));
+}
+
+void BatchVerifier::MakeExecuteOptsAvailable() {
+    using namespace config::names;
+
+    MakeOptionsAvailable({kFds, kAfds, kUccs, config::kThreadNumberOpt.GetName()});
+}
+
+void BatchVerifier::LoadDataInternal() {
+    relation_ = ColumnLayoutRelationData::CreateFrom(*input_table_, is_null_equal_null_);
+    input_table_->Reset();
+    if (relation_->GetColumnData().empty()) {
+        throw std::runtime_error("Got an empty dataset: verifying is meaningless.");
+    }
+    typed_relation_ =
+            model::ColumnLayoutTypedRelationData::CreateFrom(*input_table_, is_null_equal_null_);
+}
+
+unsigned long long BatchVerifier::ExecuteInternal() {
+    auto start_time = std::chrono::system_clock::now();
+
+    std::vector<config::IndicesType> column_sets;
+    for (auto const& [lhs, rhs] : fds_) {
+        column_sets.push_back(lhs);
+        column_sets.push_back(rhs);
+    }
+    for (auto const& [lhs, rhs, error] : afds_) {
+        column_sets.push_back(lhs);
+        column_sets.push_back(rhs);
+    }
+    column_sets.insert(column_sets.end(), uccs_.begin(), uccs_.end());
+    PLICache const plis = BuildPLIs(column_sets);
+
+    // the probing table of an RHS is calculated once for all dependencies sharing it
+    std::vector<model::PLI*> rhs_plis;
+    for (auto const& [lhs, rhs] : fds_) {
+        rhs_plis.push_back(plis.at(rhs).get());
+        fd_results_.emplace_back(relation_, typed_relation_, lhs, rhs);
+    }
+    for (auto const& [lhs, rhs, error] : afds_) {
+        rhs_plis.push_back(plis.at(rhs).get());
+        afd_results_.emplace_back(relation_, typed_relation_, lhs, rhs);
+    }
+    std::sort(rhs_plis.begin(), rhs_plis.end());
+    rhs_plis.erase(std::unique(rhs_plis.begin(), rhs_plis.end()), rhs_plis.end());
+    std::erase_if(rhs_plis,
+                  [](model::PLI* pli) { return pli->GetCachedProbingTable() != nullptr; });
+    ForEachIndex(rhs_plis.size(), threads_num_,
+                 [&rhs_plis](size_t i) { rhs_plis[i]->ForceCacheProbingTable(); });
+
+    ucc_results_.assign(uccs_.size(), UCCStatsCalculator(relation_->GetNumRows()));
+
+    // every dependency only reads the PLIs and writes its own result
+    size_t const num_fds = fds_.size();
+    size_t const num_afds = afds_.size();
+    ForEachIndex(num_fds + num_afds + uccs_.size(), threads_num_, [&](size_t i) {
+        if (i < num_fds) {
+            VerifyFd(fd_results_[i], plis, fds_[i].first, fds_[i].second);
+        } else if (i < num_fds + num_afds) {
+            auto const& [lhs, rhs, error] = afds_[i - num_fds];
+            VerifyFd(afd_results_[i - num_fds], plis, lhs, rhs);
+        } else {
+            size_t const index = i - num_fds - num_afds;
+            ucc_results_[index].CalculateStatistics(plis.at(uccs_[index])->GetIndex());
+        }
+    });
+
+    auto elapsed_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now() - start_time);
+    return elapsed_milliseconds.count();
+}
+
+auto BatchVerifier::BuildPLIs(std::vector<config::IndicesType> const& column_sets) const
+        -> PLICache {
+    PLICache plis;
+    size_t max_size = 0;
+    for (auto const& indices : column_sets) {
+        max_size = std::max(max_size, indices.size());
+    }
+
+    for (size_t length = 1; length <= max_size; ++length) {
+        // the prefixes of this length that are not built yet, every one of them is the prefix
+        // one column shorter intersected with the last column
+        std::vector<PLICache::iterator> level;
+        for (auto const& indices : column_sets) {
+            if (indices.size() < length) {
+                continue;
+            }
+            auto [it, inserted] = plis.try_emplace(
+                    config::IndicesType(indices.begin(), indices.begin() + length), nullptr);
+            if (inserted) {
+                level.push_back(it);
+            }
+        }
+
+        // the map is not modified while the level is built, only the values of the level are set
+        ForEachIndex(level.size(), threads_num_, [&](size_t i) {
+            config::IndicesType const& prefix = level[i]->first;
+            ColumnData& last_column = relation_->GetColumnData(prefix.back());
+            if (prefix.size() == 1) {
+                level[i]->second = last_column.GetPliOwnership();
+                return;
+            }
+            config::IndicesType const parent(prefix.begin(), prefix.end() - 1);
+            level[i]->second = plis.at(parent)->Intersect(last_column.GetPositionListIndex());
+        });
+    }
+    return plis;
+}
+
+void BatchVerifier::VerifyFd(StatsCalculator& result, PLICache const& plis,
+                             config::IndicesType const& lhs, config::IndicesType const& rhs) const {
+    model::PLI const* lhs_pli = plis.at(lhs).get();
+    model::PLI const* rhs_pli = plis.at(rhs).get();
+    if (Refines(*lhs_pli, *rhs_pli)) {
+        return;
+    }
+    result.CalculateStatistics(lhs_pli, rhs_pli);
+    result.SortHighlights(StatsCalculator::CompareHighlightsByProportionDescending());
+}
+
+}  // namespace algos::fd_verifier
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cassert>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "algorithms/algorithm.h"
+#include "algorithms/fd/fd_verifier/stats_calculator.h"
+#include "algorithms/ucc/ucc_verifier/ucc_stats_calculator.h"
+#include "config/equal_nulls/type.h"
+#include "config/error/type.h"
+#include "config/indices/type.h"
+#include "config/tabular_data/input_table_type.h"
+#include "config/thread_number/type.h"
+
+namespace algos::fd_verifier {
+
+/* Algorithm used for verifying a batch of FDs, AFDs and UCCs over one table. The PLI of every
+ * column set is intersected from the PLI of its prefix, so dependencies sharing columns share the
+ * intersections, and the dependencies are verified in parallel. The result of every dependency has
+ * the same semantics as the one of FDVerifier or UCCVerifier. */
+class BatchVerifier : public Algorithm {
+public:
+    /* LHS and RHS indices */
+    using FdStatement = std::pair<config::IndicesType, config::IndicesType>;
+    /* LHS and RHS indices and the maximal error the AFD holds with */
+    using AfdStatement = std::tuple<config::IndicesType, config::IndicesType, config::ErrorType>;
+    using UccStatement = config::IndicesType;
+
+private:
+    /* PLIs by sorted column indices */
+    using PLICache = std::map<config::IndicesType, std::shared_ptr<model::PLI>>;
+
+    config::InputTable input_table_;
+    config::EqNullsType is_null_equal_null_;
+    std::vector<FdStatement> fds_;
+    std::vector<AfdStatement> afds_;
+    std::vector<UccStatement> uccs_;
+    config::ThreadNumType threads_num_ = 1;
+
+    std::shared_ptr<ColumnLayoutRelationData> relation_;
+    std::shared_ptr<model::ColumnLayoutTypedRelationData> typed_relation_;
+
+    /* results of work, in the order of the statements */
+    std::vector<StatsCalculator> fd_results_;
+    std::vector<StatsCalculator> afd_results_;
+    std::vector<UCCStatsCalculator> ucc_results_;
+
+    void RegisterOptions();
+    void LoadDataInternal() override;
+    void MakeExecuteOptsAvailable() override;
+    unsigned long long ExecuteInternal() override;
+
+    void ResetState() final {
+        fd_results_.clear();
+        afd_results_.clear();
+        ucc_results_.clear();
+    }
+
+    /* Builds the PLIs of all column sets and of their prefixes, level by level */
+    PLICache BuildPLIs(std::vector<config::IndicesType> const& column_sets) const;
+    void VerifyFd(StatsCalculator& result, PLICache const& plis, config::IndicesType const& lhs,
+                  config::IndicesType const& rhs) const;
+
+public:
+    /* Results of the FDs, in the order they were given */
+    std::vector<StatsCalculator> const& GetFdResults() const {
+        return fd_results_;
+    }
+
+    /* Results of the AFDs, in the order they were given */
+    std::vector<StatsCalculator> const& GetAfdResults() const {
+        return afd_results_;
+    }
+
+    /* Returns true if the error of the AFD doesn't exceed its threshold */
+    bool AfdHolds(size_t index) const {
+        assert(index < afd_results_.size());
+        return afd_results_[index].GetError() <= std::get<2>(afds_[index]);
+    }
+
+    /* Results of the UCCs, in the order they were given */
+    std::vector<UCCStatsCalculator> const& GetUccResults() const {
+        return ucc_results_;
+    }
+
+    BatchVerifier();
+};
+
+}  // namespace algos::fd_verifier
@@ -0,0 +1,141 @@
+#include "compressed_records.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <limits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "model/table/position_list_index.h"
+
+namespace {
+
+// Sets the bit of every lane of the comparison mask, a lane spans lane_bits bits of the mask
+void SetMatchedLanes(boost::dynamic_bitset<>& attributes, size_t first_column, unsigned mask,
+                     unsigned lane_bits) {
+    unsigned const lane_mask = (1u << lane_bits) - 1;
+    while (mask != 0) {
+        unsigned const bit = std::countr_zero(mask);
+        attributes.set(first_column + bit / lane_bits);
+        mask &= ~(lane_mask << bit);
+    }
+}
+
+// Columns where both rows hold the same value other than singleton, returns the number of
+// columns compared, the rest is left to the scalar loop
+size_t MatchVectorized(boost::dynamic_bitset<>& attributes, uint16_t const* first,
+                       uint16_t const* second, size_t num_columns, uint16_t singleton) {
+    size_t column = 0;
+#ifdef __AVX2__
+    __m256i const singletons = _mm256_set1_epi16(static_cast<short>(singleton));
+    for (; column + 16 <= num_columns; column += 16) {
+        __m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + column));
+        __m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(second + column));
+        __m256i const matched = _mm256_andnot_si256(_mm256_cmpeq_epi16(a, singletons),
+                                                    _mm256_cmpeq_epi16(a, b));
+        SetMatchedLanes(attributes, column, _mm256_movemask_epi8(matched), 2);
+    }
+#elif defined(__SSE2__)
+    __m128i const singletons = _mm_set1_epi16(static_cast<short>(singleton));
+    for (; column + 8 <= num_columns; column += 8) {
+        __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first + column));
+        __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(second + column));
+        __m128i const matched =
+                _mm_andnot_si128(_mm_cmpeq_epi16(a, singletons), _mm_cmpeq_epi16(a, b));
+        SetMatchedLanes(attributes, column, _mm_movemask_epi8(matched), 2);
+    }
+#endif
+    return column;
+}
+
+size_t MatchVectorized(boost::dynamic_bitset<>& attributes, algos::hy::ClusterId const* first,
+                       algos::hy::ClusterId const* second, size_t num_columns,
+                       algos::hy::ClusterId singleton) {
+    size_t column = 0;
+#ifdef __AVX2__
+    __m256i const singletons = _mm256_set1_epi32(static_cast<int>(singleton));
+    for (; column + 8 <= num_columns; column += 8) {
+        __m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + column));
+        __m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(second + column));
+        __m256i const matched = _mm256_andnot_si256(_mm256_cmpeq_epi32(a, singletons),
+                                                    _mm256_cmpeq_epi32(a, b));
+        SetMatchedLanes(attributes, column,
+                        _mm256_movemask_ps(_mm256_castsi256_ps(matched)), 1);
+    }
+#elif defined(__SSE2__)
+    __m128i const singletons = _mm_set1_epi32(static_cast<int>(singleton));
+    for (; column + 4 <= num_columns; column += 4) {
+        __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first + column));
+        __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(second + column));
+        __m128i const matched =
+                _mm_andnot_si128(_mm_cmpeq_epi32(a, singletons), _mm_cmpeq_epi32(a, b));
+        SetMatchedLanes(attributes, column, _mm_movemask_ps(_mm_castsi128_ps(matched)), 1);
+    }
+#endif
+    return column;
+}
+
+template <typename T>
+void MatchRows(boost::dynamic_bitset<>& attributes, T const* first, T const* second,
+               size_t num_columns, T singleton) {
+    size_t column = MatchVectorized(attributes, first, second, num_columns, singleton);
+    for (; column < num_columns; ++column) {
+        if (first[column] != singleton && first[column] == second[column]) {
+            attributes.set(column);
+        }
+    }
+}
+
+}  // namespace
+
+namespace algos::hy {
+
+template <typename T>
+void CompressedRecords::Fill(std::vector<T>& records, PLIs const& plis) {
+    // singleton values are the maximum id of both widths
+    static_assert(PLIUtil::kSingletonClusterId == std::numeric_limits<ClusterId>::max());
+    records.assign(num_rows_ * num_columns_, std::numeric_limits<T>::max());
+    for (size_t column = 0; column < num_columns_; ++column) {
+        T cluster_id = 0;
+        for (auto const& cluster : plis[column]->GetIndex()) {
+            for (int row : cluster) {
+                records[row * num_columns_ + column] = cluster_id;
+            }
+            cluster_id++;
+        }
+    }
+}
+
+CompressedRecords::CompressedRecords(PLIs const& plis)
+    : num_rows_(plis.empty() ? 0 : plis.front()->GetRelationSize()), num_columns_(plis.size()) {
+    bool const fits_narrow = std::all_of(plis.begin(), plis.end(), [](auto const* pli) {
+        return pli->GetNumNonSingletonCluster() < kNarrowSingleton;
+    });
+    if (fits_narrow) {
+        Fill(narrow_records_, plis);
+    } else {
+        Fill(wide_records_, plis);
+    }
+}
+
+void CompressedRecords::Match(boost::dynamic_bitset<>& attributes, size_t first_row,
+                              size_t second_row) const {
+    assert(first_row < num_rows_ && second_row < num_rows_);
+    assert(attributes.size() == num_columns_);
+    if (IsNarrow()) {
+        MatchRows(attributes, narrow_records_.data() + first_row * num_columns_,
+                  narrow_records_.data() + second_row * num_columns_, num_columns_,
+                  kNarrowSingleton);
+    } else {
+        MatchRows(attributes, wide_records_.data() + first_row * num_columns_,
+                  wide_records_.data() + second_row * num_columns_, num_columns_,
+                  PLIUtil::kSingletonClusterId);
+    }
+}
+
+}  // namespace algos::hy
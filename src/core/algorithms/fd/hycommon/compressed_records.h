@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "types.h"
+#include "util/pli_util.h"
+
+namespace algos::hy {
+
+// Represents a relation as a row-major matrix of cluster identifiers: the value of a row in a
+// column is the id of the PLI cluster the row belongs to. The matrix is stored in one contiguous
+// buffer, with 16-bit ids when every column has few enough clusters and 32-bit ids otherwise.
+class CompressedRecords {
+private:
+    static constexpr uint16_t kNarrowSingleton = std::numeric_limits<uint16_t>::max();
+
+    size_t num_rows_ = 0;
+    size_t num_columns_ = 0;
+    // Exactly one of the buffers is used, singleton values are stored as the maximum id
+    std::vector<uint16_t> narrow_records_;
+    std::vector<ClusterId> wide_records_;
+
+    template <typename T>
+    void Fill(std::vector<T>& records, PLIs const& plis);
+
+public:
+    CompressedRecords() = default;
+    // i-th column of the matrix is built from the i-th PLI
+    explicit CompressedRecords(PLIs const& plis);
+
+    // Cluster id of the row in the column, PLIUtil::kSingletonClusterId for singleton values
+    ClusterId Get(size_t row, size_t column) const noexcept {
+        size_t const index = row * num_columns_ + column;
+        if (IsNarrow()) {
+            uint16_t const value = narrow_records_[index];
+            return value == kNarrowSingleton ? PLIUtil::kSingletonClusterId : value;
+        }
+        return wide_records_[index];
+    }
+
+    // Sets the bits of the columns where both records belong to the same non-singleton cluster
+    void Match(boost::dynamic_bitset<>& attributes, size_t first_row, size_t second_row) const;
+
+    bool IsNarrow() const noexcept {
+        return wide_records_.empty();
+    }
+
+    size_t GetNumRows() const noexcept {
+        return num_rows_;
+    }
+
+    size_t GetNumColumns() const noexcept {
+        return num_columns_;
+    }
+};
+
+}  // namespace algos::hy
@@ -3,8 +3,6 @@
 #include <algorithm>
 #include <vector>
 
-#include "algorithms/fd/hycommon/util/pli_util.h"
-
 namespace {
 
 std::vector<algos::hy::ClusterId> SortAndGetMapping(algos::hy::PLIs& plis) {
@@ -27,44 +25,12 @@ std::vector<algos::hy::ClusterId> SortAndGetMapping(algos::hy::PLIs& plis) {
     return og_mapping;
 }
 
-algos::hy::Columns BuildInvertedPlis(algos::hy::PLIs const& plis) {
-    algos::hy::Columns inverted_plis;
-
-    for (auto const& pli : plis) {
-        algos::hy::ClusterId cluster_id = 0;
-        std::vector<algos::hy::ClusterId> current(pli->GetRelationSize(),
-                                                  algos::hy::PLIUtil::kSingletonClusterId);
-        for (auto const& cluster : pli->GetIndex()) {
-            for (int value : cluster) {
-                current[value] = cluster_id;
-            }
-            cluster_id++;
-        }
-        inverted_plis.push_back(std::move(current));
-    }
-    return inverted_plis;
-}
-
-algos::hy::Rows BuildRecordRepresentation(algos::hy::Columns const& inverted_plis) {
-    size_t const num_columns = inverted_plis.size();
-    size_t const num_rows = num_columns == 0 ? 0 : inverted_plis.begin()->size();
-
-    algos::hy::Rows pli_records(num_rows, algos::hy::Row(num_columns));
-
-    for (size_t i = 0; i < num_rows; ++i) {
-        for (size_t j = 0; j < num_columns; ++j) {
-            pli_records[i][j] = inverted_plis[j][i];
-        }
-    }
-
-    return pli_records;
-}
-
 }  // namespace
 
 namespace algos::hy {
 
-std::tuple<PLIs, Rows, std::vector<ClusterId>> Preprocess(ColumnLayoutRelationData* relation) {
+std::tuple<PLIs, CompressedRecords, std::vector<ClusterId>> Preprocess(
+        ColumnLayoutRelationData* relation) {
     PLIs plis;
     std::transform(relation->GetColumnData().begin(), relation->GetColumnData().end(),
                    std::back_inserter(plis),
@@ -72,9 +38,7 @@ std::tuple<PLIs, Rows, std::vector<ClusterId>> Preprocess(ColumnLayoutRelationDa
 
     auto og_mapping = SortAndGetMapping(plis);
 
-    auto const inverted_plis = BuildInvertedPlis(plis);
-
-    auto pli_records = BuildRecordRepresentation(inverted_plis);
+    CompressedRecords pli_records(plis);
 
     return std::make_tuple(std::move(plis), std::move(pli_records), std::move(og_mapping));
 }
@@ -4,12 +4,14 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include "compressed_records.h"
 #include "model/table/column_layout_relation_data.h"
 #include "types.h"
 
 namespace algos::hy {
 
-std::tuple<PLIs, Rows, std::vector<ClusterId>> Preprocess(ColumnLayoutRelationData* relation);
+std::tuple<PLIs, CompressedRecords, std::vector<ClusterId>> Preprocess(
+        ColumnLayoutRelationData* relation);
 boost::dynamic_bitset<> RestoreAgreeSet(boost::dynamic_bitset<> const& as,
                                         std::vector<ClusterId> const& og_mapping, size_t num_cols);
 
@@ -9,32 +9,31 @@
 #include <boost/dynamic_bitset.hpp>
 #include <boost/thread/future.hpp>
 
-#include "algorithms/fd/hycommon/util/pli_util.h"
 #include "efficiency.h"
 
 namespace {
 
 class ClusterComparator {
 private:
-    algos::hy::Rows* sort_keys_;
+    algos::hy::CompressedRecords const* sort_keys_;
     size_t comparison_column_1_;
     size_t comparison_column_2_;
 
 public:
-    ClusterComparator(algos::hy::Rows* sort_keys, size_t comparison_column_1,
+    ClusterComparator(algos::hy::CompressedRecords const* sort_keys, size_t comparison_column_1,
                       size_t comparison_column_2) noexcept
         : sort_keys_(sort_keys),
           comparison_column_1_(comparison_column_1),
           comparison_column_2_(comparison_column_2) {
-        assert(sort_keys_->front().size() >= 3);
+        assert(sort_keys_->GetNumColumns() >= 3);
     }
 
     bool operator()(size_t o1, size_t o2) noexcept {
-        size_t value1 = (*sort_keys_)[o1][comparison_column_1_];
-        size_t value2 = (*sort_keys_)[o2][comparison_column_1_];
+        size_t value1 = sort_keys_->Get(o1, comparison_column_1_);
+        size_t value2 = sort_keys_->Get(o2, comparison_column_1_);
         if (value1 == value2) {
-            value1 = (*sort_keys_)[o1][comparison_column_2_];
-            value2 = (*sort_keys_)[o2][comparison_column_2_];
+            value1 = sort_keys_->Get(o1, comparison_column_2_);
+            value2 = sort_keys_->Get(o2, comparison_column_2_);
         }
         return value1 > value2;
     }
@@ -84,13 +83,13 @@ void Sampler::RunWindowImpl(Efficiency& efficiency, model::PositionListIndex con
     unsigned comparisons = 0;
     unsigned const window = efficiency.GetWindow();
 
-    for (model::PLI::Cluster const& cluster : pli.GetIndex()) {
+    for (model::PLI::ClusterView cluster : pli.GetIndex()) {
         boost::dynamic_bitset<> equal_attrs(num_attributes);
         for (size_t i = 0; window < cluster.size() && i < cluster.size() - window; ++i) {
             int const pivot_id = cluster[i];
             int const partner_id = cluster[i + window];
 
-            Match(equal_attrs, pivot_id, partner_id);
+            compressed_records_->Match(equal_attrs, pivot_id, partner_id);
             assert(equal_attrs.any());
             store_match(equal_attrs);
             equal_attrs.reset();
@@ -127,7 +126,7 @@ void Sampler::ProcessComparisonSuggestions(IdPairs const& comparison_suggestions
 
     for (auto [first_id, second_id] : comparison_suggestions) {
         boost::dynamic_bitset<> equal_attrs(num_attributes);
-        Match(equal_attrs, first_id, second_id);
+        compressed_records_->Match(equal_attrs, first_id, second_id);
 
         agree_sets_->Add(std::move(equal_attrs));
     }
@@ -141,7 +140,7 @@ void Sampler::SortClustersParallel() {
                                              column_slider.GetLeftNeighbor(),
                                              column_slider.GetRightNeighbor());
         auto sort = [pli, cluster_comparator]() {
-            for (model::PLI::Cluster& cluster : pli->GetIndex()) {
+            for (model::ClusterList::MutableView cluster : pli->GetIndex()) {
                 std::sort(cluster.begin(), cluster.end(), cluster_comparator);
             }
         };
@@ -159,7 +158,7 @@ void Sampler::SortClustersSeq() {
         ClusterComparator cluster_comparator(compressed_records_.get(),
                                              column_slider.GetLeftNeighbor(),
                                              column_slider.GetRightNeighbor());
-        for (model::PLI::Cluster& cluster : pli->GetIndex()) {
+        for (model::ClusterList::MutableView cluster : pli->GetIndex()) {
             std::sort(cluster.begin(), cluster.end(), cluster_comparator);
         }
         column_slider.ToNextColumn();
@@ -275,22 +274,7 @@ ColumnCombinationList Sampler::GetAgreeSets(IdPairs const& comparison_suggestion
     return agree_sets_->MoveOutNewColumnCombinations();
 }
 
-void Sampler::Match(boost::dynamic_bitset<>& attributes, size_t first_record_id,
-                    size_t second_record_id) {
-    assert(first_record_id < compressed_records_->size() &&
-           second_record_id < compressed_records_->size());
-
-    for (size_t i = 0; i < compressed_records_->front().size(); ++i) {
-        TablePos const val1 = (*compressed_records_)[first_record_id][i];
-        TablePos const val2 = (*compressed_records_)[second_record_id][i];
-        if (!PLIUtil::IsSingletonCluster(val1) && !PLIUtil::IsSingletonCluster(val2) &&
-            val1 == val2) {
-            attributes.set(i);
-        }
-    }
-}
-
-Sampler::Sampler(PLIsPtr plis, RowsPtr pli_records, config::ThreadNumType threads)
+Sampler::Sampler(PLIsPtr plis, CompressedRecordsPtr pli_records, config::ThreadNumType threads)
     : plis_(std::move(plis)),
       compressed_records_(std::move(pli_records)),
       agree_sets_(std::make_unique<AllColumnCombinations>(plis_->size())),
@@ -7,6 +7,7 @@
 #include <boost/dynamic_bitset.hpp>
 
 #include "all_column_combinations.h"
+#include "compressed_records.h"
 #include "config/thread_number/type.h"
 #include "efficiency_threshold.h"
 #include "model/table/position_list_index.h"
@@ -26,7 +27,7 @@ private:
     double efficiency_threshold_ = kEfficiencyThreshold;
 
     PLIsPtr plis_;
-    RowsPtr compressed_records_;
+    CompressedRecordsPtr compressed_records_;
     std::priority_queue<Efficiency> efficiency_queue_;
     std::unique_ptr<AllColumnCombinations> agree_sets_;
     config::ThreadNumType threads_num_;
@@ -41,8 +42,6 @@ private:
     void InitializeEfficiencyQueueImpl();
     void InitializeEfficiencyQueue();
 
-    void Match(boost::dynamic_bitset<>& attributes, size_t first_record_id,
-               size_t second_record_id);
     template <typename F>
     void RunWindowImpl(Efficiency& efficiency, model::PositionListIndex const& pli, F store_match);
     std::vector<boost::dynamic_bitset<>> RunWindowRet(Efficiency& efficiency,
@@ -50,7 +49,7 @@ private:
     void RunWindow(Efficiency& efficiency, model::PositionListIndex const& pli);
 
 public:
-    Sampler(PLIsPtr plis, RowsPtr pli_records, config::ThreadNumType threads = 1);
+    Sampler(PLIsPtr plis, CompressedRecordsPtr pli_records, config::ThreadNumType threads = 1);
 
     Sampler(Sampler const& other) = delete;
     Sampler(Sampler&& other) = delete;
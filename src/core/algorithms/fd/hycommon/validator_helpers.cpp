@@ -6,12 +6,13 @@
 
 namespace algos::hy {
 
-std::vector<ClusterId> BuildClustersIdentifier(Row const& compressed_record,
+std::vector<ClusterId> BuildClustersIdentifier(CompressedRecords const& compressed_records,
+                                               size_t row,
                                                std::vector<ClusterId> const& agree_set) {
     std::vector<ClusterId> sub_cluster;
     sub_cluster.reserve(agree_set.size());
     for (auto attr : agree_set) {
-        ClusterId const cluster_id = compressed_record[attr];
+        ClusterId const cluster_id = compressed_records.Get(row, attr);
 
         if (PLIUtil::IsSingletonCluster(cluster_id)) {
             return {};
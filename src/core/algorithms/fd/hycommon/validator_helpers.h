@@ -9,6 +9,7 @@
 #include <boost/version.hpp>
 #include <easylogging++.h>
 
+#include "compressed_records.h"
 #include "types.h"
 
 #define UNORDERED_FLAT_MAP_AVAILABLE (BOOST_VERSION >= 108100)
@@ -19,10 +20,11 @@
 
 namespace algos::hy {
 
-// Builds a cluster's identifier of the agree set provided. Cluster's identifier is a vector
-// of size_t value where ith value of the vector is an identifier of a cluster of ith set
+// Builds a cluster's identifier of the agree set provided for the row. Cluster's identifier is a
+// vector of size_t value where ith value of the vector is an identifier of a cluster of ith set
 // attribute of the agree set.
-std::vector<ClusterId> BuildClustersIdentifier(Row const& compressed_record,
+std::vector<ClusterId> BuildClustersIdentifier(CompressedRecords const& compressed_records,
+                                               size_t row,
                                                std::vector<ClusterId> const& agree_set);
 
 // Builds the next level of the prefix tree traversal
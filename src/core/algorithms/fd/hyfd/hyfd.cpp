@@ -12,6 +12,7 @@
 
 #include "algorithms/fd/hycommon/preprocessor.h"
 #include "algorithms/fd/hycommon/util/pli_util.h"
+#include "config/thread_number/option.h"
 #include "inductor.h"
 #include "sampler.h"
 #include "validator.h"
@@ -21,6 +22,10 @@ namespace algos::hyfd {
 HyFD::HyFD(std::optional<ColumnLayoutRelationDataManager> relation_manager)
     : PliBasedFDAlgorithm({}, relation_manager) {}
 
+void HyFD::MakeExecuteOptsAvailableFDInternal() {
+    MakeOptionsAvailable({config::kThreadNumberOpt.GetName()});
+}
+
 unsigned long long HyFD::ExecuteInternal() {
     using namespace hy;
     LOG(TRACE) << "Executing";
@@ -28,14 +33,14 @@ unsigned long long HyFD::ExecuteInternal() {
 
     auto [plis, pli_records, og_mapping] = Preprocess(relation_.get());
     auto const plis_shared = std::make_shared<PLIs>(std::move(plis));
-    auto const pli_records_shared = std::make_shared<Rows>(std::move(pli_records));
+    auto const pli_records_shared = std::make_shared<CompressedRecords>(std::move(pli_records));
 
     Sampler sampler(plis_shared, pli_records_shared);
 
     auto const positive_cover_tree =
             std::make_shared<fd_tree::FDTree>(GetRelation().GetNumColumns());
     Inductor inductor(positive_cover_tree);
-    Validator validator(positive_cover_tree, plis_shared, pli_records_shared);
+    Validator validator(positive_cover_tree, plis_shared, pli_records_shared, threads_num_);
 
     IdPairs comparison_suggestions;
 
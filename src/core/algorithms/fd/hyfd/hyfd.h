@@ -37,6 +37,7 @@ namespace algos::hyfd {
  */
 class HyFD : public PliBasedFDAlgorithm {
 private:
+    void MakeExecuteOptsAvailableFDInternal() final;
     void ResetStateFd() final {}
 
     unsigned long long ExecuteInternal() override;
@@ -9,7 +9,7 @@ private:
     hy::Sampler sampler_;
 
 public:
-    Sampler(hy::PLIsPtr plis, hy::RowsPtr pli_records)
+    Sampler(hy::PLIsPtr plis, hy::CompressedRecordsPtr pli_records)
         : sampler_(std::move(plis), std::move(pli_records)) {}
 
     NonFDList GetNonFDs(hy::IdPairs const& comparison_suggestions) {
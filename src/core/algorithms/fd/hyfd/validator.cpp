@@ -1,11 +1,15 @@
 #include "validator.h"
 
 #include <algorithm>
+#include <cassert>
+#include <future>
 #include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <easylogging++.h>
 
@@ -25,10 +29,11 @@ std::unordered_set<size_t> AsSet(boost::dynamic_bitset<> const& bitset) {
 }
 
 std::pair<std::vector<size_t>, std::vector<size_t>> BuildRhsMappings(
-        boost::dynamic_bitset<> const& rhs, algos::hy::Rows const& compressed_records) {
+        boost::dynamic_bitset<> const& rhs,
+        algos::hy::CompressedRecords const& compressed_records) {
     std::vector<size_t> rhs_column_ids;
     rhs_column_ids.reserve(rhs.count());
-    std::vector<size_t> rhs_ranks(compressed_records[0].size());
+    std::vector<size_t> rhs_ranks(compressed_records.GetNumColumns());
 
     for (size_t attr = rhs.find_first(); attr != boost::dynamic_bitset<>::npos;
          attr = rhs.find_next(attr)) {
@@ -42,12 +47,13 @@ std::pair<std::vector<size_t>, std::vector<size_t>> BuildRhsMappings(
 using LhsRow = std::vector<size_t>;
 using RhsRowId = std::pair<std::vector<size_t>, size_t>;
 
-void ValidateRhss(RhsRowId const& rhs_record, algos::hy::Rows const& compressed_records, size_t row,
+void ValidateRhss(RhsRowId const& rhs_record,
+                  algos::hy::CompressedRecords const& compressed_records, size_t row,
                   std::vector<size_t> const& rhs_ranks, std::unordered_set<size_t>& valid_rhs_ids,
                   algos::hy::IdPairs& comparison_suggestions) {
     for (auto it = valid_rhs_ids.begin(); it != valid_rhs_ids.end();) {
         size_t const rhs_column = *it;
-        size_t const value = compressed_records[row][rhs_column];
+        size_t const value = compressed_records.Get(row, rhs_column);
 
         if (algos::hy::PLIUtil::IsSingletonCluster(value) ||
             value != rhs_record.first[rhs_ranks[rhs_column]]) {
@@ -62,12 +68,12 @@ void ValidateRhss(RhsRowId const& rhs_record, algos::hy::Rows const& compressed_
     }
 }
 
-RhsRowId BuildRhsRowId(algos::hy::Rows const& compressed_records,
+RhsRowId BuildRhsRowId(algos::hy::CompressedRecords const& compressed_records,
                        boost::dynamic_bitset<> const& rhs,
                        std::vector<size_t> const& rhs_column_ids, size_t row) {
     std::vector<size_t> rhs_sub_cluster(rhs.count());
     for (size_t i = 0; i < rhs.count(); ++i) {
-        rhs_sub_cluster[i] = compressed_records[row][rhs_column_ids[i]];
+        rhs_sub_cluster[i] = compressed_records.Get(row, rhs_column_ids[i]);
     }
 
     return std::make_pair(std::move(rhs_sub_cluster), row);
@@ -75,7 +81,7 @@ RhsRowId BuildRhsRowId(algos::hy::Rows const& compressed_records,
 
 boost::dynamic_bitset<> Refine(algos::hy::IdPairs& comparison_suggestions,
                                algos::hy::PLIs const& plis,
-                               algos::hy::Rows const& compressed_records,
+                               algos::hy::CompressedRecords const& compressed_records,
                                boost::dynamic_bitset<> const& lhs,
                                boost::dynamic_bitset<> const& rhs, size_t firstAttr) {
     auto valid_rhs_ids = AsSet(rhs);
@@ -87,7 +93,7 @@ boost::dynamic_bitset<> Refine(algos::hy::IdPairs& comparison_suggestions,
 
         for (size_t row : cluster) {
             auto lhs_row =
-                    algos::hy::BuildClustersIdentifier(compressed_records[row], lhs_column_ids);
+                    algos::hy::BuildClustersIdentifier(compressed_records, row, lhs_column_ids);
             if (lhs_row.empty()) {
                 continue;
             }
@@ -182,10 +188,10 @@ Validator::FDValidations Validator::ProcessFirstLevel(LhsPair const& lhs_pair) {
     for (size_t attr = rhs.find_first(); attr != boost::dynamic_bitset<>::npos;
          attr = rhs.find_next(attr)) {
         for (auto const& cluster : (*plis_)[lhs_attr]->GetIndex()) {
-            size_t const cluster_id = (*compressed_records_)[cluster[0]][attr];
+            size_t const cluster_id = compressed_records_->Get(cluster[0], attr);
             if (algos::hy::PLIUtil::IsSingletonCluster(cluster_id) ||
-                std::any_of(cluster.cbegin(), cluster.cend(), [this, attr, cluster_id](int id) {
-                    return (*compressed_records_)[id][attr] != cluster_id;
+                std::any_of(cluster.begin(), cluster.end(), [this, attr, cluster_id](int id) {
+                    return compressed_records_->Get(id, attr) != cluster_id;
                 })) {
                 vertex->RemoveFd(attr);
                 result.InvalidInstances().emplace_back(lhs, attr);
@@ -249,6 +255,41 @@ Validator::FDValidations Validator::ValidateAndExtendSeq(std::vector<LhsPair> co
     return result;
 }
 
+Validator::FDValidations Validator::ValidateAndExtendParallel(
+        std::vector<LhsPair> const& vertices) {
+    FDValidations result;
+    boost::asio::thread_pool pool(threads_num_);
+    std::vector<std::future<FDValidations>> validation_futures;
+    validation_futures.reserve(vertices.size());
+
+    // Every vertex of a level is refined independently: a task only changes the FDs stored in
+    // its own vertex, and the validations are merged in the order of the sequential run
+    for (auto const& vertex : vertices) {
+        std::packaged_task<FDValidations()> task(
+                [this, &vertex]() { return GetValidations(vertex); });
+        validation_futures.push_back(task.get_future());
+        boost::asio::post(pool, std::move(task));
+    }
+
+    pool.join();
+
+    for (auto& future : validation_futures) {
+        assert(future.valid());
+        result.Add(future.get());
+    }
+
+    return result;
+}
+
+Validator::FDValidations Validator::ValidateAndExtend(std::vector<LhsPair> const& vertices) {
+    assert(threads_num_ > 0);
+    if (threads_num_ > 1) {
+        return ValidateAndExtendParallel(vertices);
+    } else {
+        return ValidateAndExtendSeq(vertices);
+    }
+}
+
 algos::hy::IdPairs Validator::ValidateAndExtendCandidates() {
     size_t const num_attributes = plis_->size();
 
@@ -263,7 +304,7 @@ algos::hy::IdPairs Validator::ValidateAndExtendCandidates() {
     size_t previous_num_invalid_fds = 0;
     algos::hy::IdPairs comparison_suggestions;
     while (!cur_level_vertices.empty()) {
-        auto const result = ValidateAndExtendSeq(cur_level_vertices);
+        auto const result = ValidateAndExtend(cur_level_vertices);
 
         comparison_suggestions.insert(comparison_suggestions.end(),
                                       result.ComparisonSuggestions().begin(),
@@ -7,6 +7,7 @@
 #include "algorithms/fd/hycommon/primitive_validations.h"
 #include "algorithms/fd/hyfd/model/fd_tree.h"
 #include "algorithms/fd/raw_fd.h"
+#include "config/thread_number/type.h"
 #include "model/table/position_list_index.h"
 #include "types.h"
 
@@ -21,9 +22,10 @@ private:
     std::shared_ptr<fd_tree::FDTree> fds_;
 
     hy::PLIsPtr plis_;
-    hy::RowsPtr compressed_records_;
+    hy::CompressedRecordsPtr compressed_records_;
 
     unsigned current_level_number_ = 0;
+    config::ThreadNumType threads_num_ = 1;
 
     FDValidations ProcessZeroLevel(LhsPair const& lhsPair);
     FDValidations ProcessFirstLevel(LhsPair const& lhs_pair);
@@ -32,6 +34,8 @@ private:
     FDValidations GetValidations(LhsPair const& lhsPair);
 
     FDValidations ValidateAndExtendSeq(std::vector<LhsPair> const& vertices);
+    FDValidations ValidateAndExtendParallel(std::vector<LhsPair> const& vertices);
+    FDValidations ValidateAndExtend(std::vector<LhsPair> const& vertices);
 
     [[nodiscard]] unsigned GetLevelNum() const {
         return current_level_number_;
@@ -39,10 +43,12 @@ private:
 
 public:
     Validator(std::shared_ptr<fd_tree::FDTree> fds, hy::PLIsPtr plis,
-              hy::RowsPtr compressed_records) noexcept
+              hy::CompressedRecordsPtr compressed_records,
+              config::ThreadNumType threads_num = 1) noexcept
         : fds_(std::move(fds)),
           plis_(std::move(plis)),
-          compressed_records_(std::move(compressed_records)) {}
+          compressed_records_(std::move(compressed_records)),
+          threads_num_(threads_num) {}
 
     hy::IdPairs ValidateAndExtendCandidates();
 };
@@ -4,12 +4,16 @@
 #include <iomanip>
 #include <list>
 #include <memory>
+#include <vector>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <easylogging++.h>
 
 #include "config/error/option.h"
 #include "config/error_measure/option.h"
 #include "config/max_lhs/option.h"
+#include "config/thread_number/option.h"
 #include "enums.h"
 #include "fd/tane/lattice_level.h"
 #include "fd/tane/lattice_vertex.h"
@@ -20,11 +24,12 @@
 namespace algos {
 using boost::dynamic_bitset;
 using Cluster = model::PositionListIndex::Cluster;
+using ClusterView = model::PositionListIndex::ClusterView;
 
 config::ErrorType PFDTane::CalculateZeroAryFdError(ColumnData const* rhs) {
     std::size_t max = 1;
     model::PositionListIndex const* x_pli = rhs->GetPositionListIndex();
-    for (Cluster const& x_cluster : x_pli->GetIndex()) {
+    for (ClusterView x_cluster : x_pli->GetIndex()) {
         max = std::max(max, x_cluster.size());
     }
     return 1.0 - static_cast<double>(max) / x_pli->GetRelationSize();
@@ -33,24 +38,24 @@ config::ErrorType PFDTane::CalculateZeroAryFdError(ColumnData const* rhs) {
 config::ErrorType PFDTane::CalculateFdError(model::PositionListIndex const* x_pli,
                                             model::PositionListIndex const* xa_pli,
                                             ErrorMeasure measure) {
-    std::deque<Cluster> xa_index = xa_pli->GetIndex();
+    std::vector<ClusterView> xa_index(xa_pli->GetIndex().begin(), xa_pli->GetIndex().end());
     std::shared_ptr<Cluster const> probing_table = x_pli->CalculateAndGetProbingTable();
     std::sort(xa_index.begin(), xa_index.end(),
-              [&probing_table](Cluster const& a, Cluster const& b) {
+              [&probing_table](ClusterView a, ClusterView b) {
                   return probing_table->at(a.front()) < probing_table->at(b.front());
               });
     double sum = 0.0;
     std::size_t cluster_rows_count = 0;
-    std::deque<Cluster> const& x_index = x_pli->GetIndex();
+    model::ClusterList const& x_index = x_pli->GetIndex();
     auto xa_cluster_it = xa_index.begin();
 
-    for (Cluster const& x_cluster : x_index) {
+    for (ClusterView x_cluster : x_index) {
         std::size_t max = 1;
         for (int x_row : x_cluster) {
             if (xa_cluster_it == xa_index.end()) {
                 break;
             }
-            if (x_row == xa_cluster_it->at(0)) {
+            if (x_row == xa_cluster_it->front()) {
                 max = std::max(max, xa_cluster_it->size());
                 xa_cluster_it++;
             }
@@ -73,7 +78,8 @@ void PFDTane::RegisterOptions() {
 }
 
 void PFDTane::MakeExecuteOptsAvailableFDInternal() {
-    MakeOptionsAvailable({config::kErrorOpt.GetName(), config::kErrorMeasureOpt.GetName()});
+    MakeOptionsAvailable({config::kErrorOpt.GetName(), config::kErrorMeasureOpt.GetName(),
+                          config::kThreadNumberOpt.GetName()});
 }
 
 void PFDTane::ResetStateFd() {}
@@ -150,50 +156,81 @@ void PFDTane::Prune(model::LatticeLevel* level) {
     }
 }
 
-void PFDTane::ComputeDependencies(model::LatticeLevel* level) {
+std::vector<PFDTane::VertexFd> PFDTane::ComputeDependencies(model::LatticeVertex* xa_vertex) {
     RelationalSchema const* schema = relation_->GetSchema();
-    for (auto& [key_map, xa_vertex] : level->GetVertices()) {
-        if (xa_vertex->GetIsInvalid()) {
-            continue;
+    std::vector<VertexFd> fds;
+    Vertical const& xa = xa_vertex->GetVertical();
+    // Calculate XA PLI
+    if (xa_vertex->GetPositionListIndex() == nullptr) {
+        auto parent_pli_1 = xa_vertex->GetParents()[0]->GetPositionListIndex();
+        auto parent_pli_2 = xa_vertex->GetParents()[1]->GetPositionListIndex();
+        xa_vertex->AcquirePositionListIndex(parent_pli_1->Intersect(parent_pli_2));
+    }
+
+    dynamic_bitset<> xa_indices = xa.GetColumnIndices();
+    dynamic_bitset<> a_candidates = xa_vertex->GetRhsCandidates();
+    auto xa_pli = xa_vertex->GetPositionListIndex();
+    for (auto const& x_vertex : xa_vertex->GetParents()) {
+        Vertical const& lhs = x_vertex->GetVertical();
+
+        // Find index of A in XA. If a is not a candidate, continue. TODO: possible to do it
+        // easier??
+        // like "a_index = xa_indices - x_indices;"
+        int a_index = xa_indices.find_first();
+        dynamic_bitset<> x_indices = lhs.GetColumnIndices();
+        while (a_index >= 0 && x_indices[a_index]) {
+            a_index = xa_indices.find_next(a_index);
         }
-        Vertical xa = xa_vertex->GetVertical();
-        // Calculate XA PLI
-        if (xa_vertex->GetPositionListIndex() == nullptr) {
-            auto parent_pli_1 = xa_vertex->GetParents()[0]->GetPositionListIndex();
-            auto parent_pli_2 = xa_vertex->GetParents()[1]->GetPositionListIndex();
-            xa_vertex->AcquirePositionListIndex(parent_pli_1->Intersect(parent_pli_2));
+        if (!a_candidates[a_index]) {
+            continue;
         }
+        auto x_pli = x_vertex->GetPositionListIndex();
 
-        dynamic_bitset<> xa_indices = xa.GetColumnIndices();
-        dynamic_bitset<> a_candidates = xa_vertex->GetRhsCandidates();
-        auto xa_pli = xa_vertex->GetPositionListIndex();
-        for (auto const& x_vertex : xa_vertex->GetParents()) {
-            Vertical const& lhs = x_vertex->GetVertical();
-
-            // Find index of A in XA. If a is not a candidate, continue. TODO: possible to do it
-            // easier??
-            // like "a_index = xa_indices - x_indices;"
-            int a_index = xa_indices.find_first();
-            dynamic_bitset<> x_indices = lhs.GetColumnIndices();
-            while (a_index >= 0 && x_indices[a_index]) {
-                a_index = xa_indices.find_next(a_index);
-            }
-            if (!a_candidates[a_index]) {
-                continue;
+        // Check X -> A
+        config::ErrorType error = CalculateFdError(x_pli, xa_pli, error_measure_);
+        if (error <= max_fd_error_) {
+            Column const* rhs = schema->GetColumns()[a_index].get();
+
+            fds.push_back({&lhs, rhs, error});
+            xa_vertex->GetRhsCandidates().set(rhs->GetIndex(), false);
+            if (error == 0) {
+                xa_vertex->GetRhsCandidates() &= lhs.GetColumnIndices();
             }
-            auto x_pli = x_vertex->GetPositionListIndex();
+        }
+    }
+    return fds;
+}
 
-            // Check X -> A
-            config::ErrorType error = CalculateFdError(x_pli, xa_pli, error_measure_);
-            if (error <= max_fd_error_) {
-                Column const* rhs = schema->GetColumns()[a_index].get();
+void PFDTane::ComputeDependencies(model::LatticeLevel* level) {
+    RelationalSchema const* schema = relation_->GetSchema();
+    std::vector<model::LatticeVertex*> xa_vertices;
+    for (auto& [key_map, xa_vertex] : level->GetVertices()) {
+        if (!xa_vertex->GetIsInvalid()) {
+            xa_vertices.push_back(xa_vertex.get());
+        }
+    }
 
-                RegisterAndCountFd(lhs, rhs, error, schema);
-                xa_vertex->GetRhsCandidates().set(rhs->GetIndex(), false);
-                if (error == 0) {
-                    xa_vertex->GetRhsCandidates() &= lhs.GetColumnIndices();
-                }
-            }
+    // Vertices of a level only read the PLIs of the previous one, so they are checked
+    // independently. FDs are registered afterwards in the order of a single-threaded run.
+    std::vector<std::vector<VertexFd>> vertex_fds(xa_vertices.size());
+    auto task = [this, &xa_vertices, &vertex_fds](std::size_t i) {
+        vertex_fds[i] = ComputeDependencies(xa_vertices[i]);
+    };
+    if (threads_num_ > 1) {
+        boost::asio::thread_pool pool(threads_num_);
+        for (std::size_t i = 0; i < xa_vertices.size(); ++i) {
+            boost::asio::post(pool, [i, &task]() { task(i); });
+        }
+        pool.join();
+    } else {
+        for (std::size_t i = 0; i < xa_vertices.size(); ++i) {
+            task(i);
+        }
+    }
+
+    for (std::vector<VertexFd> const& fds : vertex_fds) {
+        for (VertexFd const& fd : fds) {
+            RegisterAndCountFd(*fd.lhs, fd.rhs, fd.error, schema);
         }
     }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "algorithms/fd/pli_based_fd_algorithm.h"
 #include "algorithms/fd/tane/lattice_level.h"
 #include "config/error/type.h"
@@ -13,6 +15,13 @@ namespace algos {
 
 class PFDTane : public PliBasedFDAlgorithm {
 private:
+    /* FD X -> A found on the lattice vertex XA */
+    struct VertexFd {
+        Vertical const* lhs;
+        Column const* rhs;
+        config::ErrorType error;
+    };
+
     config::ErrorType max_fd_error_;
     config::ErrorType max_ucc_error_;
     ErrorMeasure error_measure_ = +ErrorMeasure::per_tuple;
@@ -21,6 +30,7 @@ private:
     void RegisterOptions();
     void MakeExecuteOptsAvailableFDInternal() final;
     void Prune(model::LatticeLevel* level);
+    std::vector<VertexFd> ComputeDependencies(model::LatticeVertex* xa_vertex);
     void ComputeDependencies(model::LatticeLevel* level);
     unsigned long long ExecuteInternal() final;
 
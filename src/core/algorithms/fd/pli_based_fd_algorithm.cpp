@@ -2,6 +2,7 @@
 
 #include "config/equal_nulls/option.h"
 #include "config/tabular_data/input_table/option.h"
+#include "config/thread_number/option.h"
 
 namespace algos {
 
@@ -11,11 +12,14 @@ PliBasedFDAlgorithm::PliBasedFDAlgorithm(
     : FDAlgorithm(std::move(phase_names)),
       relation_manager_(relation_manager.has_value()
                                 ? *relation_manager
-                                : ColumnLayoutRelationDataManager{
-                                          &input_table_, &is_null_equal_null_, &relation_}) {
+                                : ColumnLayoutRelationDataManager{&input_table_,
+                                                                  &is_null_equal_null_, &relation_,
+                                                                  &threads_num_}) {
+    RegisterOption(config::kThreadNumberOpt(&threads_num_));
     if (relation_manager.has_value()) return;
     RegisterRelationManagerOptions();
-    MakeOptionsAvailable({config::kTableOpt.GetName(), config::kEqualNullsOpt.GetName()});
+    MakeOptionsAvailable({config::kTableOpt.GetName(), config::kEqualNullsOpt.GetName(),
+                          config::kThreadNumberOpt.GetName()});
 }
 
 void PliBasedFDAlgorithm::RegisterRelationManagerOptions() {
@@ -25,6 +29,9 @@ void PliBasedFDAlgorithm::RegisterRelationManagerOptions() {
 
 void PliBasedFDAlgorithm::LoadDataInternal() {
     relation_ = relation_manager_.GetRelation();
+    // The value was only needed for loading, algorithms that use threads for mining request
+    // the option again when it is time to execute
+    UnsetOption(config::kThreadNumberOpt.GetName());
 
     if (relation_->GetColumnData().empty()) {
         throw std::runtime_error("Got an empty dataset: FD mining is meaningless.");
@@ -4,6 +4,7 @@
 
 #include "config/equal_nulls/type.h"
 #include "config/tabular_data/input_table_type.h"
+#include "config/thread_number/type.h"
 #include "fd_algorithm.h"
 #include "model/table/column_layout_relation_data.h"
 
@@ -16,19 +17,24 @@ public:
         config::InputTable* input_table_;
         config::EqNullsType* is_null_equal_null_;
         std::shared_ptr<ColumnLayoutRelationData>* relation_;
+        // Number of threads used to build the relation, nullptr means one thread
+        config::ThreadNumType const* threads_num_;
 
     public:
-        ColumnLayoutRelationDataManager(
-                config::InputTable* input_table, config::EqNullsType* is_null_equal_null,
-                std::shared_ptr<ColumnLayoutRelationData>* relation_ptr) noexcept
+        ColumnLayoutRelationDataManager(config::InputTable* input_table,
+                                        config::EqNullsType* is_null_equal_null,
+                                        std::shared_ptr<ColumnLayoutRelationData>* relation_ptr,
+                                        config::ThreadNumType const* threads_num = nullptr) noexcept
             : input_table_(input_table),
               is_null_equal_null_(is_null_equal_null),
-              relation_(relation_ptr) {}
+              relation_(relation_ptr),
+              threads_num_(threads_num) {}
 
         std::shared_ptr<ColumnLayoutRelationData> GetRelation() const {
             if (*relation_ == nullptr)
-                *relation_ =
-                        ColumnLayoutRelationData::CreateFrom(**input_table_, *is_null_equal_null_);
+                *relation_ = ColumnLayoutRelationData::CreateFrom(
+                        **input_table_, *is_null_equal_null_,
+                        threads_num_ == nullptr ? 1 : *threads_num_);
             return *relation_;
         }
     };
@@ -42,6 +48,9 @@ private:
 
 protected:
     std::shared_ptr<ColumnLayoutRelationData> relation_;
+    // Used to load the relation and, by the algorithms that make the option available for
+    // execution, to mine dependencies
+    config::ThreadNumType threads_num_ = 1;
 
     void LoadDataInternal() final;
 
@@ -9,9 +9,11 @@
 #include "algorithms/fd/pyrocommon/core/fd_g1_strategy.h"
 #include "config/error/option.h"
 #include "config/max_lhs/option.h"
+#include "config/mem_limit/option.h"
 #include "config/names_and_descriptions.h"
 #include "config/option_using.h"
 #include "config/thread_number/option.h"
+#include "model/table/pli_cache.h"
 
 namespace algos {
 
@@ -31,13 +33,14 @@ void Pyro::RegisterOptions() {
     DESBORDANTE_OPTION_USING;
 
     RegisterOption(config::kErrorOpt(&parameters_.max_ucc_error));
-    RegisterOption(config::kThreadNumberOpt(&parameters_.parallelism));
+    RegisterOption(config::kMemLimitMbOpt(&parameters_.mem_limit_mb));
     RegisterOption(Option{&parameters_.seed, kSeed, kDSeed, 0});
 }
 
 void Pyro::MakeExecuteOptsAvailableFDInternal() {
     using namespace config::names;
-    MakeOptionsAvailable({config::kErrorOpt.GetName(), config::kThreadNumberOpt.GetName(), kSeed});
+    MakeOptionsAvailable({config::kErrorOpt.GetName(), config::kThreadNumberOpt.GetName(),
+                          config::kMemLimitMbOpt.GetName(), kSeed});
 }
 
 void Pyro::ResetStateFd() {
@@ -46,12 +49,12 @@ void Pyro::ResetStateFd() {
 
 unsigned long long Pyro::ExecuteInternal() {
     auto start_time = std::chrono::system_clock::now();
+    parameters_.parallelism = threads_num_;
 
     auto schema = relation_->GetSchema();
 
     auto profiling_context = std::make_unique<ProfilingContext>(
-            parameters_, relation_.get(), ucc_consumer_, fd_consumer_, caching_method_,
-            eviction_method_, caching_method_value_);
+            parameters_, relation_.get(), ucc_consumer_, fd_consumer_, caching_method_);
 
     std::function<bool(DependencyCandidate const&, DependencyCandidate const&)> launch_pad_order;
     if (parameters_.launch_pad_order == "arity") {
@@ -126,6 +129,9 @@ unsigned long long Pyro::ExecuteInternal() {
     LOG(INFO) << "Total ascension time: " << total_ascension << "ms";
     LOG(INFO) << "Total trickle time: " << total_trickle << "ms";
     LOG(INFO) << "Total intersection time: " << model::PositionListIndex::micros_ / 1000 << "ms";
+    model::PLICache const* pli_cache = profiling_context->GetPliCache();
+    LOG(INFO) << boost::format{"PLI cache: %1% hits, %2% misses, %3% evictions"} %
+                         pli_cache->GetHits() % pli_cache->GetMisses() % pli_cache->GetEvictions();
     LOG(INFO) << "HASH: " << PliBasedFDAlgorithm::Fletcher16();
     return elapsed_milliseconds.count();
 }
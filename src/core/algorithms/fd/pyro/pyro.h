@@ -15,8 +15,6 @@ private:
     std::list<std::unique_ptr<SearchSpace>> search_spaces_;
 
     CachingMethod caching_method_ = CachingMethod::kCoin;
-    CacheEvictionMethod eviction_method_ = CacheEvictionMethod::kDefault;
-    double caching_method_value_;
 
     pyro::Parameters parameters_;
 
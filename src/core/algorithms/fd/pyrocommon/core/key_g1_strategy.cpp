@@ -2,10 +2,10 @@
 
 #include <unordered_map>
 
-#include "../model/pli_cache.h"
+#include "model/table/pli_cache.h"
 #include "search_space.h"
 
-double KeyG1Strategy::CalculateKeyError(model::PositionListIndex* pli) const {
+double KeyG1Strategy::CalculateKeyError(model::PositionListIndex const* pli) const {
     return CalculateKeyError(pli->GetNepAsLong());
 }
 
@@ -30,11 +30,8 @@ void KeyG1Strategy::EnsureInitialized(SearchSpace* search_space) const {
 }
 
 double KeyG1Strategy::CalculateError(Vertical const& key_candidate) const {
-    auto pli = context_->GetPliCache()->GetOrCreateFor(key_candidate, context_);
-    auto pli_pointer = std::holds_alternative<model::PositionListIndex*>(pli)
-                               ? std::get<model::PositionListIndex*>(pli)
-                               : std::get<std::unique_ptr<model::PositionListIndex>>(pli).get();
-    double error = CalculateKeyError(pli_pointer);
+    auto pli = context_->GetPliCache()->GetOrCreateFor(key_candidate);
+    double error = CalculateKeyError(pli.get());
     calc_count_++;
     return error;
 }
@@ -48,11 +45,8 @@ model::ConfidenceInterval KeyG1Strategy::CalculateKeyError(
 
 DependencyCandidate KeyG1Strategy::CreateDependencyCandidate(Vertical const& vertical) const {
     if (vertical.GetArity() == 1) {
-        auto pli = context_->GetPliCache()->GetOrCreateFor(vertical, context_);
-        auto pli_pointer = std::holds_alternative<model::PositionListIndex*>(pli)
-                                   ? std::get<model::PositionListIndex*>(pli)
-                                   : std::get<std::unique_ptr<model::PositionListIndex>>(pli).get();
-        double key_error = CalculateKeyError(pli_pointer->GetNepAsLong());
+        auto pli = context_->GetPliCache()->GetOrCreateFor(vertical);
+        double key_error = CalculateKeyError(pli->GetNepAsLong());
         return DependencyCandidate(vertical, model::ConfidenceInterval(key_error), true);
     }
 
@@ -5,7 +5,7 @@
 
 class KeyG1Strategy : public DependencyStrategy {
 private:
-    double CalculateKeyError(model::PositionListIndex* pli) const;
+    double CalculateKeyError(model::PositionListIndex const* pli) const;
     double CalculateKeyError(double num_violating_tuple_pairs) const;
     model::ConfidenceInterval CalculateKeyError(
             model::ConfidenceInterval const& num_violations) const;
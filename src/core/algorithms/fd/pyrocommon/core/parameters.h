@@ -5,6 +5,7 @@
 #include "config/equal_nulls/type.h"
 #include "config/error/type.h"
 #include "config/max_lhs/type.h"
+#include "config/mem_limit/type.h"
 #include "config/thread_number/type.h"
 
 namespace algos::pyro {
@@ -35,6 +36,7 @@ struct Parameters {
     // Cache settings
     double caching_probability = 0.5;
     unsigned int nary_intersection_size = 4;
+    config::MemLimitMBType mem_limit_mb = 2 * 1024;
 
     // Miscellaneous settings
     bool is_check_estimates = false;
@@ -1,11 +1,12 @@
 #include "profiling_context.h"
 
+#include <stdexcept>
 #include <utility>
 
 #include <easylogging++.h>
 
 #include "../model/list_agree_set_sample.h"
-#include "../model/pli_cache.h"
+#include "model/table/pli_cache.h"
 #include "model/table/vertical_map.h"
 
 using std::shared_ptr;
@@ -14,9 +15,7 @@ ProfilingContext::ProfilingContext(algos::pyro::Parameters parameters,
                                    ColumnLayoutRelationData* relation_data,
                                    std::function<void(PartialKey const&)> const& ucc_consumer,
                                    std::function<void(PartialFD const&)> const& fd_consumer,
-                                   CachingMethod const& caching_method,
-                                   CacheEvictionMethod const& eviction_method,
-                                   double caching_method_value)
+                                   CachingMethod const& caching_method)
     : parameters_(std::move(parameters)),
       relation_data_(relation_data),
       random_(parameters_.seed == 0 ? std::mt19937() : std::mt19937(parameters_.seed)),
@@ -41,13 +40,26 @@ ProfilingContext::ProfilingContext(algos::pyro::Parameters parameters,
     } else {
         agree_set_samples_ = nullptr;
     }
-    double max_entropy = GetMaximumEntropy(relation_data_);
+    model::PLICache::CachingPredicate should_cache;
+    switch (caching_method) {
+        case CachingMethod::kCoin:
+            // called by the cache under its unique lock
+            should_cache = [this](Vertical const&, model::PositionListIndex const&) {
+                return NextDouble() < parameters_.caching_probability;
+            };
+            break;
+        case CachingMethod::kNoCaching:
+            should_cache = [](Vertical const&, model::PositionListIndex const&) { return false; };
+            break;
+        case CachingMethod::kAllCaching:
+            break;
+        default:
+            throw std::runtime_error(
+                    "Only kCoin, kNoCaching and kAllCaching strategies are currently available");
+    }
     pli_cache_ = std::make_unique<model::PLICache>(
-            relation_data_, caching_method, eviction_method, caching_method_value,
-            GetMinEntropy(relation_data_), GetMeanEntropy(relation_data_),
-            GetMedianEntropy(relation_data_), SetMaximumEntropy(relation_data_, caching_method),
-            GetMedianGini(relation_data_), GetMedianInvertedEntropy(relation_data_));
-    pli_cache_->SetMaximumEntropy(max_entropy);
+            relation_data_, std::size_t{parameters_.mem_limit_mb} << 20, std::move(should_cache),
+            parameters_.nary_intersection_size);
     // TODO: partialFDScoring - for FD registration
 }
 
@@ -114,36 +126,11 @@ double ProfilingContext::GetMedianGini(ColumnLayoutRelationData const* relation_
     return GetMedianValue(std::move(vals), "MedianGini");
 }
 
-double ProfilingContext::SetMaximumEntropy(ColumnLayoutRelationData const* relation_data,
-                                           CachingMethod const& caching_method) {
-    switch (caching_method) {
-        case CachingMethod::kEntropy:
-        case CachingMethod::kCoin:
-        case CachingMethod::kNoCaching:
-            return relation_data->GetMaximumEntropy();
-        case CachingMethod::kTrueUniquenessEntropy:
-            return GetMaximumEntropy(relation_data);
-        case CachingMethod::kMeanEntropyThreshold:
-            return GetMeanEntropy(relation_data);
-        case CachingMethod::kHeuristicQ2:
-            return GetMaximumEntropy(relation_data);
-        case CachingMethod::kGini:
-            return GetMedianGini(relation_data);
-        case CachingMethod::kInvertedEntropy:
-            return GetMedianInvertedEntropy(relation_data);
-        default:
-            return 0;
-    }
-}
-
 model::AgreeSetSample const* ProfilingContext::CreateFocusedSample(Vertical const& focus,
                                                                    double boost_factor) {
-    auto pli = pli_cache_->GetOrCreateFor(focus, this);
-    auto pli_pointer = std::holds_alternative<model::PositionListIndex*>(pli)
-                               ? std::get<model::PositionListIndex*>(pli)
-                               : std::get<std::unique_ptr<model::PositionListIndex>>(pli).get();
+    std::shared_ptr<model::PositionListIndex const> pli = pli_cache_->GetOrCreateFor(focus);
     std::unique_ptr<model::ListAgreeSetSample> sample = model::ListAgreeSetSample::CreateFocusedFor(
-            relation_data_, focus, pli_pointer, parameters_.sample_size * boost_factor,
+            relation_data_, focus, pli.get(), parameters_.sample_size * boost_factor,
             custom_random_);
     LOG(TRACE) << boost::format{"Creating sample focused on: %1%"} % focus.ToString();
     auto sample_ptr = sample.get();
@@ -6,7 +6,6 @@
 #include "../model/agree_set_sample.h"
 #include "../model/partial_fd.h"
 #include "../model/partial_key.h"
-#include "cache_eviction_method.h"
 #include "caching_method.h"
 #include "dependency_consumer.h"
 #include "parameters.h"
@@ -42,8 +41,7 @@ public:
     ProfilingContext(algos::pyro::Parameters parameters, ColumnLayoutRelationData* relation_data,
                      std::function<void(PartialKey const&)> const& ucc_consumer,
                      std::function<void(PartialFD const&)> const& fd_consumer,
-                     CachingMethod const& caching_method,
-                     CacheEvictionMethod const& eviction_method, double caching_method_value);
+                     CachingMethod const& caching_method);
 
     // Non-const as RandomGenerator state gets changed
     model::AgreeSetSample const* CreateFocusedSample(Vertical const& focus, double boost_factor);
@@ -95,6 +93,4 @@ public:
 
 private:
     static double GetMedianValue(std::vector<double>&& values, std::string const& measure_name);
-    static double SetMaximumEntropy(ColumnLayoutRelationData const* relation_data,
-                                    CachingMethod const& caching_method);
 };
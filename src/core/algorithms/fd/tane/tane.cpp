@@ -5,10 +5,13 @@
 #include <list>
 #include <memory>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <easylogging++.h>
 
 #include "config/error/option.h"
 #include "config/max_lhs/option.h"
+#include "config/thread_number/option.h"
 #include "lattice_level.h"
 #include "lattice_vertex.h"
 #include "model/table/column_data.h"
@@ -29,7 +32,7 @@ void Tane::RegisterOptions() {
 }
 
 void Tane::MakeExecuteOptsAvailableFDInternal() {
-    MakeOptionsAvailable({config::kErrorOpt.GetName()});
+    MakeOptionsAvailable({config::kErrorOpt.GetName(), config::kThreadNumberOpt.GetName()});
 }
 
 void Tane::ResetStateFd() {
@@ -74,6 +77,86 @@ void Tane::RegisterUcc([[maybe_unused]] Vertical const& key, [[maybe_unused]] do
     count_of_ucc_++;
 }
 
+std::vector<Tane::VertexFd> Tane::ComputeDependencies(model::LatticeVertex* xa_vertex) {
+    RelationalSchema const* schema = relation_->GetSchema();
+    std::vector<VertexFd> fds;
+    Vertical const& xa = xa_vertex->GetVertical();
+    // Calculate XA PLI
+    if (xa_vertex->GetPositionListIndex() == nullptr) {
+        auto parent_pli_1 = xa_vertex->GetParents()[0]->GetPositionListIndex();
+        auto parent_pli_2 = xa_vertex->GetParents()[1]->GetPositionListIndex();
+        xa_vertex->AcquirePositionListIndex(parent_pli_1->Intersect(parent_pli_2));
+    }
+
+    dynamic_bitset<> xa_indices = xa.GetColumnIndices();
+    dynamic_bitset<> a_candidates = xa_vertex->GetRhsCandidates();
+
+    for (auto const& x_vertex : xa_vertex->GetParents()) {
+        Vertical const& lhs = x_vertex->GetVertical();
+
+        // Find index of A in XA. If a is not a candidate, continue. TODO: possible to do it
+        // easier??
+        // like "a_index = xa_indices - x_indices;"
+        int a_index = xa_indices.find_first();
+        dynamic_bitset<> x_indices = lhs.GetColumnIndices();
+        while (a_index >= 0 && x_indices[a_index]) {
+            a_index = xa_indices.find_next(a_index);
+        }
+        if (!a_candidates[a_index]) {
+            continue;
+        }
+
+        // Check X -> A
+        double error = CalculateFdError(x_vertex->GetPositionListIndex(),
+                                        xa_vertex->GetPositionListIndex(), relation_.get());
+        if (error <= max_fd_error_) {
+            Column const* rhs = schema->GetColumns()[a_index].get();
+
+            fds.push_back({&lhs, rhs, error});
+            xa_vertex->GetRhsCandidates().set(rhs->GetIndex(), false);
+            if (error == 0) {
+                xa_vertex->GetRhsCandidates() &= lhs.GetColumnIndices();
+            }
+        }
+    }
+    return fds;
+}
+
+void Tane::ComputeDependencies(model::LatticeLevel* level) {
+    RelationalSchema const* schema = relation_->GetSchema();
+    std::vector<model::LatticeVertex*> xa_vertices;
+    for (auto& [key_map, xa_vertex] : level->GetVertices()) {
+        if (!xa_vertex->GetIsInvalid()) {
+            xa_vertices.push_back(xa_vertex.get());
+        }
+    }
+
+    // Vertices of a level only read the PLIs of the previous one, so they are checked
+    // independently. FDs are registered afterwards in the order of a single-threaded run.
+    std::vector<std::vector<VertexFd>> vertex_fds(xa_vertices.size());
+    auto task = [this, &xa_vertices, &vertex_fds](std::size_t i) {
+        vertex_fds[i] = ComputeDependencies(xa_vertices[i]);
+    };
+    if (threads_num_ > 1) {
+        boost::asio::thread_pool pool(threads_num_);
+        for (std::size_t i = 0; i < xa_vertices.size(); ++i) {
+            boost::asio::post(pool, [i, &task]() { task(i); });
+        }
+        pool.join();
+    } else {
+        for (std::size_t i = 0; i < xa_vertices.size(); ++i) {
+            task(i);
+        }
+    }
+
+    for (std::vector<VertexFd> const& fds : vertex_fds) {
+        for (VertexFd const& fd : fds) {
+            // TODO: register FD to a file or something
+            RegisterAndCountFd(*fd.lhs, fd.rhs, fd.error, schema);
+        }
+    }
+}
+
 unsigned long long Tane::ExecuteInternal() {
     max_fd_error_ = max_ucc_error_;
     RelationalSchema const* schema = relation_->GetSchema();
@@ -178,52 +261,7 @@ unsigned long long Tane::ExecuteInternal() {
             break;
         }
 
-        for (auto& [key_map, xa_vertex] : level->GetVertices()) {
-            if (xa_vertex->GetIsInvalid()) {
-                continue;
-            }
-
-            Vertical xa = xa_vertex->GetVertical();
-            // Calculate XA PLI
-            if (xa_vertex->GetPositionListIndex() == nullptr) {
-                auto parent_pli_1 = xa_vertex->GetParents()[0]->GetPositionListIndex();
-                auto parent_pli_2 = xa_vertex->GetParents()[1]->GetPositionListIndex();
-                xa_vertex->AcquirePositionListIndex(parent_pli_1->Intersect(parent_pli_2));
-            }
-
-            dynamic_bitset<> xa_indices = xa.GetColumnIndices();
-            dynamic_bitset<> a_candidates = xa_vertex->GetRhsCandidates();
-
-            for (auto const& x_vertex : xa_vertex->GetParents()) {
-                Vertical const& lhs = x_vertex->GetVertical();
-
-                // Find index of A in XA. If a is not a candidate, continue. TODO: possible to do it
-                // easier??
-                // like "a_index = xa_indices - x_indices;"
-                int a_index = xa_indices.find_first();
-                dynamic_bitset<> x_indices = lhs.GetColumnIndices();
-                while (a_index >= 0 && x_indices[a_index]) {
-                    a_index = xa_indices.find_next(a_index);
-                }
-                if (!a_candidates[a_index]) {
-                    continue;
-                }
-
-                // Check X -> A
-                double error = CalculateFdError(x_vertex->GetPositionListIndex(),
-                                                xa_vertex->GetPositionListIndex(), relation_.get());
-                if (error <= max_fd_error_) {
-                    Column const* rhs = schema->GetColumns()[a_index].get();
-
-                    // TODO: register FD to a file or something
-                    RegisterAndCountFd(lhs, rhs, error, schema);
-                    xa_vertex->GetRhsCandidates().set(rhs->GetIndex(), false);
-                    if (error == 0) {
-                        xa_vertex->GetRhsCandidates() &= lhs.GetColumnIndices();
-                    }
-                }
-            }
-        }
+        ComputeDependencies(level);
 
         if (arity == max_arity) {
             break;
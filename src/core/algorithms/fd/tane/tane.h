@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "algorithms/fd/pli_based_fd_algorithm.h"
+#include "algorithms/fd/tane/lattice_level.h"
 #include "config/error/type.h"
 #include "model/table/position_list_index.h"
 #include "model/table/relation_data.h"
@@ -11,10 +13,19 @@ namespace algos {
 
 class Tane : public PliBasedFDAlgorithm {
 private:
+    /* FD X -> A found on the lattice vertex XA */
+    struct VertexFd {
+        Vertical const* lhs;
+        Column const* rhs;
+        double error;
+    };
+
     void RegisterOptions();
     void MakeExecuteOptsAvailableFDInternal() final;
 
     void ResetStateFd() final;
+    std::vector<VertexFd> ComputeDependencies(model::LatticeVertex* xa_vertex);
+    void ComputeDependencies(model::LatticeLevel* level);
     unsigned long long ExecuteInternal() final;
 
 public:
@@ -1,3 +1,4 @@
 #pragma once
 
+#include "algorithms/fd/fd_verifier/batch_verifier.h"
 #include "algorithms/fd/fd_verifier/fd_verifier.h"
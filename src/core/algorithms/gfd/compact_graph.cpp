@@ -0,0 +1,153 @@
+#include "compact_graph.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+
+std::string const kLabel = "label";
+
+}  // namespace
+
+CompactGraph::StringId CompactGraph::Dictionary::Intern(std::string const& string) {
+    auto it = ids_.find(string);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    if (strings_.size() >= kNoString) {
+        throw std::runtime_error("Too many distinct strings in the graph.");
+    }
+    StringId const id = strings_.size();
+    std::string const& stored = strings_.emplace_back(string);
+    ids_.emplace(stored, id);
+    return id;
+}
+
+CompactGraph::StringId CompactGraph::Dictionary::Find(std::string_view string) const {
+    auto it = ids_.find(string);
+    return it == ids_.end() ? kNoString : it->second;
+}
+
+template <typename GetId>
+void CompactGraph::Build(graph_t const& graph, GetId get_id) {
+    size_t const num_vertices = boost::num_vertices(graph);
+    if (num_vertices > std::numeric_limits<VertexId>::max()) {
+        throw std::runtime_error("Too many vertices in the graph.");
+    }
+
+    labels_.reserve(num_vertices);
+    attribute_offsets_.reserve(num_vertices + 1);
+    for (vertex_t v = 0; v < num_vertices; ++v) {
+        auto const& vertex_attributes = graph[v].attributes;
+        auto label_it = vertex_attributes.find(kLabel);
+        if (label_it == vertex_attributes.end()) {
+            throw std::runtime_error("Every vertex of the graph should have a label.");
+        }
+        labels_.push_back(get_id(label_it->second));
+        size_t const begin = attributes_.size();
+        for (auto const& [name, value] : vertex_attributes) {
+            attributes_.emplace_back(get_id(name), get_id(value));
+        }
+        std::sort(attributes_.begin() + begin, attributes_.end());
+        attribute_offsets_.push_back(attributes_.size());
+    }
+
+    // every undirected edge is stored in the rows of both its ends
+    std::vector<size_t> degrees(num_vertices, 0);
+    typename boost::graph_traits<graph_t>::edge_iterator it, end;
+    for (boost::tie(it, end) = boost::edges(graph); it != end; ++it) {
+        ++degrees[boost::source(*it, graph)];
+        ++degrees[boost::target(*it, graph)];
+    }
+    offsets_.resize(num_vertices + 1);
+    offsets_[0] = 0;
+    for (size_t v = 0; v < num_vertices; ++v) {
+        offsets_[v + 1] = offsets_[v] + degrees[v];
+    }
+    std::vector<size_t> positions(offsets_.begin(), offsets_.end() - 1);
+    neighbours_.resize(offsets_.back());
+    edge_labels_.resize(offsets_.back());
+    for (boost::tie(it, end) = boost::edges(graph); it != end; ++it) {
+        VertexId const source = boost::source(*it, graph);
+        VertexId const target = boost::target(*it, graph);
+        StringId const label = get_id(graph[*it].label);
+        neighbours_[positions[source]] = target;
+        edge_labels_[positions[source]++] = label;
+        neighbours_[positions[target]] = source;
+        edge_labels_[positions[target]++] = label;
+    }
+
+    std::vector<std::pair<VertexId, StringId>> row;
+    for (size_t v = 0; v < num_vertices; ++v) {
+        row.clear();
+        for (size_t i = offsets_[v]; i < offsets_[v + 1]; ++i) {
+            row.emplace_back(neighbours_[i], edge_labels_[i]);
+        }
+        std::sort(row.begin(), row.end());
+        for (size_t i = 0; i < row.size(); ++i) {
+            std::tie(neighbours_[offsets_[v] + i], edge_labels_[offsets_[v] + i]) = row[i];
+        }
+        vertices_by_label_[labels_[v]].push_back(v);
+    }
+}
+
+CompactGraph::CompactGraph(graph_t const& graph) {
+    Build(graph, [this](std::string const& string) { return dictionary_->Intern(string); });
+}
+
+CompactGraph::CompactGraph(graph_t const& pattern, CompactGraph const& graph)
+    : dictionary_(graph.dictionary_) {
+    Build(pattern, [this](std::string const& string) { return dictionary_->Find(string); });
+}
+
+std::span<CompactGraph::StringId const> CompactGraph::GetEdgeLabels(VertexId u,
+                                                                    VertexId v) const {
+    std::span<VertexId const> neighbours = Neighbours(u);
+    auto [first, last] = std::equal_range(neighbours.begin(), neighbours.end(), v);
+    return EdgeLabels(u).subspan(first - neighbours.begin(), last - first);
+}
+
+bool CompactGraph::HasEdge(VertexId u, VertexId v, StringId label) const {
+    std::span<StringId const> labels = GetEdgeLabels(u, v);
+    return std::binary_search(labels.begin(), labels.end(), label);
+}
+
+std::optional<CompactGraph::StringId> CompactGraph::GetAttribute(VertexId v,
+                                                                 StringId name) const {
+    auto begin = attributes_.begin() + attribute_offsets_[v];
+    auto end = attributes_.begin() + attribute_offsets_[v + 1];
+    auto it = std::lower_bound(begin, end, name, [](auto const& attribute, StringId id) {
+        return attribute.first < id;
+    });
+    if (it == end || it->first != name) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::span<CompactGraph::VertexId const> CompactGraph::GetVerticesWithLabel(StringId label) const {
+    auto it = vertices_by_label_.find(label);
+    if (it == vertices_by_label_.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+CompactLiterals::CompactLiterals(std::vector<Literal> const& literals, CompactGraph const& graph) {
+    // constants missing from the graph get ids after the ids of the graph, equal constants get
+    // equal ids
+    std::unordered_map<std::string, CompactGraph::StringId> unknown_constants;
+    auto make_token = [&graph, &unknown_constants](::Token const& token) {
+        CompactGraph::StringId id = graph.FindString(token.second);
+        if (token.first == -1 && id == CompactGraph::kNoString) {
+            id = unknown_constants.try_emplace(token.second, graph.NumStrings() +
+                                                                     unknown_constants.size())
+                         .first->second;
+        }
+        return Token{token.first, id};
+    };
+    for (auto const& [fst_token, snd_token] : literals) {
+        literals_.emplace_back(make_token(fst_token), make_token(snd_token));
+    }
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gfd.h"
+#include "graph_descriptor.h"
+
+/* Immutable labelled graph in the compressed sparse row format. Labels of vertices and edges,
+ * names and values of attributes are interned, so they are compared as integers. Neighbours of
+ * every vertex are stored contiguously and sorted, so an edge is found by binary search. The data
+ * graph is built once after parsing and shared by the GFD validators, patterns are built against
+ * its dictionary. */
+class CompactGraph {
+public:
+    using VertexId = uint32_t;
+    using StringId = uint32_t;
+
+    /* id of the strings of a pattern that don't occur in the graph */
+    static constexpr StringId kNoString = std::numeric_limits<StringId>::max();
+
+private:
+    class Dictionary {
+    private:
+        std::deque<std::string> strings_;
+        std::unordered_map<std::string_view, StringId> ids_;
+
+    public:
+        StringId Intern(std::string const& string);
+        StringId Find(std::string_view string) const;
+
+        std::string const& GetString(StringId id) const {
+            return strings_[id];
+        }
+
+        size_t Size() const {
+            return strings_.size();
+        }
+    };
+
+    std::shared_ptr<Dictionary> dictionary_ = std::make_shared<Dictionary>();
+    /* neighbours of v are neighbours_[offsets_[v]], ..., neighbours_[offsets_[v + 1] - 1] sorted
+     * by id and then by label, labels of the edges are at the same positions of edge_labels_ */
+    std::vector<size_t> offsets_ = {0};
+    std::vector<VertexId> neighbours_;
+    std::vector<StringId> edge_labels_;
+    std::vector<StringId> labels_;
+    /* attributes of every vertex sorted by name */
+    std::vector<size_t> attribute_offsets_ = {0};
+    std::vector<std::pair<StringId, StringId>> attributes_;
+    std::unordered_map<StringId, std::vector<VertexId>> vertices_by_label_;
+
+    template <typename GetId>
+    void Build(graph_t const& graph, GetId get_id);
+
+public:
+    CompactGraph() = default;
+    explicit CompactGraph(graph_t const& graph);
+    /* Pattern over the dictionary of graph, its unknown strings get kNoString */
+    CompactGraph(graph_t const& pattern, CompactGraph const& graph);
+
+    size_t NumVertices() const {
+        return labels_.size();
+    }
+
+    size_t NumEdges() const {
+        return neighbours_.size() / 2;
+    }
+
+    size_t Degree(VertexId v) const {
+        return offsets_[v + 1] - offsets_[v];
+    }
+
+    std::span<VertexId const> Neighbours(VertexId v) const {
+        return {neighbours_.data() + offsets_[v], Degree(v)};
+    }
+
+    /* Labels of the edges to Neighbours(v), in the same order */
+    std::span<StringId const> EdgeLabels(VertexId v) const {
+        return {edge_labels_.data() + offsets_[v], Degree(v)};
+    }
+
+    /* Sorted labels of all edges between u and v */
+    std::span<StringId const> GetEdgeLabels(VertexId u, VertexId v) const;
+
+    /* Label of an edge between u and v or kNoString if there are none */
+    StringId GetEdgeLabel(VertexId u, VertexId v) const {
+        std::span<StringId const> labels = GetEdgeLabels(u, v);
+        return labels.empty() ? kNoString : labels.front();
+    }
+
+    bool HasEdge(VertexId u, VertexId v) const {
+        return !GetEdgeLabels(u, v).empty();
+    }
+
+    bool HasEdge(VertexId u, VertexId v, StringId label) const;
+
+    StringId GetLabel(VertexId v) const {
+        return labels_[v];
+    }
+
+    std::optional<StringId> GetAttribute(VertexId v, StringId name) const;
+
+    /* Vertices with the label in ascending order */
+    std::span<VertexId const> GetVerticesWithLabel(StringId label) const;
+
+    StringId FindString(std::string_view string) const {
+        return dictionary_->Find(string);
+    }
+
+    std::string const& GetString(StringId id) const {
+        return dictionary_->GetString(id);
+    }
+
+    size_t NumStrings() const {
+        return dictionary_->Size();
+    }
+};
+
+/* Literals of a GFD with the names and constants interned in the dictionary of a graph */
+class CompactLiterals {
+private:
+    /* vertex of the pattern and attribute name, vertex is -1 for constants */
+    using Token = std::pair<int, CompactGraph::StringId>;
+
+    std::vector<std::pair<Token, Token>> literals_;
+
+public:
+    CompactLiterals(std::vector<Literal> const& literals, CompactGraph const& graph);
+
+    /* Returns true if all literals hold when every pattern vertex u is mapped to get_vertex(u) */
+    template <typename GetVertex>
+    bool Hold(CompactGraph const& graph, GetVertex const& get_vertex) const {
+        auto get_value = [&graph, &get_vertex](Token const& token) {
+            if (token.first == -1) {
+                return std::optional<CompactGraph::StringId>(token.second);
+            }
+            return graph.GetAttribute(get_vertex(token.first), token.second);
+        };
+        for (auto const& [fst_token, snd_token] : literals_) {
+            std::optional<CompactGraph::StringId> fst = get_value(fst_token);
+            if (!fst) return false;
+            std::optional<CompactGraph::StringId> snd = get_value(snd_token);
+            if (!snd || *fst != *snd) return false;
+        }
+        return true;
+    }
+};
+
+/* GFD with the pattern and the literals interned in the dictionary of a graph */
+struct CompactGfd {
+    CompactGraph pattern;
+    CompactLiterals premises;
+    CompactLiterals conclusion;
+
+    CompactGfd(Gfd const& gfd, CompactGraph const& graph)
+        : pattern(gfd.GetPattern(), graph),
+          premises(gfd.GetPremises(), graph),
+          conclusion(gfd.GetConclusion(), graph) {}
+};
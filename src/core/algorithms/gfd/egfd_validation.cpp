@@ -1,75 +1,106 @@
 #include "egfd_validation.h"
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <ranges>
+#include <unordered_map>
 
-#include <boost/graph/vf2_sub_graph_iso.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <easylogging++.h>
 
+#include "compact_graph.h"
 #include "config/equal_nulls/option.h"
 #include "config/names_and_descriptions.h"
 #include "config/option_using.h"
 #include "config/tabular_data/input_table/option.h"
+#include "config/thread_number/option.h"
 
 namespace {
 
 using namespace algos;
-using Match = std::vector<std::pair<std::set<vertex_t>::iterator, std::set<vertex_t>::iterator>>;
+using Match = std::vector<
+        std::pair<std::set<vertex_t>::const_iterator, std::set<vertex_t>::const_iterator>>;
+/* edge of the pattern as a pair of its ends in ascending order */
+using PatternEdge = std::pair<vertex_t, vertex_t>;
+using Counts = std::unordered_map<vertex_t, int>;
 
-void FstStepForest(graph_t const& graph, std::map<vertex_t, std::set<vertex_t>>& rooted_subtree,
-                   std::map<vertex_t, vertex_t>& children_amount) {
-    typename boost::graph_traits<graph_t>::vertex_iterator it, end;
-    for (boost::tie(it, end) = vertices(graph); it != end; ++it) {
-        if (boost::degree(*it, graph) != 1) {
-            continue;
+PatternEdge MakeEdge(vertex_t u, vertex_t v) {
+    return std::minmax(u, v);
+}
+
+/* Calls task(i) for every i < count, the calls are independent and run on a thread pool if more
+ * than one thread is used */
+template <typename Task>
+void ForEachIndex(size_t count, config::ThreadNumType threads_num, Task const& task) {
+    if (threads_num <= 1 || count <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+    boost::asio::thread_pool pool(threads_num);
+    for (size_t i = 0; i < count; ++i) {
+        boost::asio::post(pool, [&task, i]() { task(i); });
+    }
+    pool.join();
+}
+
+/* Returns the vertices satisfying pred in their order, chunks of vertices are checked in
+ * parallel */
+template <typename Vertices, typename Pred>
+std::vector<vertex_t> FilterVertices(Vertices const& vertices, Pred const& pred,
+                                     config::ThreadNumType threads_num) {
+    constexpr size_t kChunkSize = 1024;
+    size_t const size = vertices.size();
+    std::vector<std::vector<vertex_t>> chunks((size + kChunkSize - 1) / kChunkSize);
+    ForEachIndex(chunks.size(), threads_num, [&](size_t i) {
+        auto end = vertices.begin() + std::min(size, (i + 1) * kChunkSize);
+        for (auto it = vertices.begin() + i * kChunkSize; it != end; ++it) {
+            if (pred(*it)) {
+                chunks[i].push_back(*it);
+            }
         }
-        typename boost::graph_traits<graph_t>::adjacency_iterator adjacency_it =
-                boost::adjacent_vertices(*it, graph).first;
+    });
+    std::vector<vertex_t> result;
+    for (auto const& chunk : chunks) {
+        result.insert(result.end(), chunk.begin(), chunk.end());
+    }
+    return result;
+}
 
-        if (rooted_subtree.find(*adjacency_it) != rooted_subtree.end()) {
-            rooted_subtree.at(*adjacency_it).insert(*it);
-            children_amount[*adjacency_it]++;
-        } else {
-            std::set<vertex_t> value = {*it};
-            rooted_subtree.emplace(*adjacency_it, value);
-            children_amount.emplace(*adjacency_it, 1);
+void FstStepForest(CompactGraph const& graph,
+                   std::map<vertex_t, std::set<vertex_t>>& rooted_subtree,
+                   std::map<vertex_t, vertex_t>& children_amount) {
+    for (vertex_t v = 0; v < graph.NumVertices(); ++v) {
+        if (graph.Degree(v) != 1) {
+            continue;
         }
+        vertex_t adjacent = graph.Neighbours(v).front();
+        rooted_subtree[adjacent].insert(v);
+        children_amount[adjacent]++;
     }
 }
 
-void BuildForest(graph_t const& graph, std::map<vertex_t, std::set<vertex_t>>& rooted_subtree,
+void BuildForest(CompactGraph const& graph, std::map<vertex_t, std::set<vertex_t>>& rooted_subtree,
                  std::map<vertex_t, vertex_t>& children_amount) {
     bool changed = true;
     while (changed) {
         changed = false;
         std::map<vertex_t, std::set<vertex_t>> temp;
         std::map<vertex_t, vertex_t> children_temp;
-        for (auto const& kv : rooted_subtree) {
-            auto desc = kv.first;
-            auto children = kv.second;
-
-            if (boost::degree(desc, graph) == (children_amount.at(desc) + 1)) {
+        for (auto const& [desc, children] : rooted_subtree) {
+            if (graph.Degree(desc) == (children_amount.at(desc) + 1)) {
                 changed = true;
-                typename boost::graph_traits<graph_t>::adjacency_iterator adjacency_it,
-                        adjacency_end;
-                boost::tie(adjacency_it, adjacency_end) = boost::adjacent_vertices(desc, graph);
-                for (; adjacency_it != adjacency_end; ++adjacency_it) {
-                    if (children.find(*adjacency_it) != children.end()) {
+                for (vertex_t adjacent : graph.Neighbours(desc)) {
+                    if (children.find(adjacent) != children.end()) {
                         continue;
                     }
-                    if (temp.find(*adjacency_it) != temp.end()) {
-                        std::set<vertex_t> value = {};
-                        auto current = temp.at(*adjacency_it);
-                        std::set_union(children.begin(), children.end(), current.begin(),
-                                       current.end(), std::inserter(value, value.begin()));
-                        value.insert(desc);
-                        temp[*adjacency_it] = value;
-                        children_temp[*adjacency_it]++;
-                    } else {
-                        std::set<vertex_t> value = children;
-                        value.insert(desc);
-                        temp.emplace(*adjacency_it, value);
-                        children_temp.emplace(*adjacency_it, 1);
-                    }
+                    std::set<vertex_t>& value = temp[adjacent];
+                    value.insert(children.begin(), children.end());
+                    value.insert(desc);
+                    children_temp[adjacent]++;
                     break;
                 }
             } else {
@@ -77,17 +108,16 @@ void BuildForest(graph_t const& graph, std::map<vertex_t, std::set<vertex_t>>& r
                 children_temp.emplace(desc, children_amount.at(desc));
             }
         }
-        rooted_subtree = temp;
-        children_amount = children_temp;
+        rooted_subtree = std::move(temp);
+        children_amount = std::move(children_temp);
     }
 }
 
-void CfDecompose(graph_t const& graph, std::set<vertex_t>& core,
+void CfDecompose(CompactGraph const& graph, std::set<vertex_t>& core,
                  std::vector<std::set<vertex_t>>& forest) {
-    if (boost::num_vertices(graph) == (boost::num_edges(graph) + 1)) {
-        typename boost::graph_traits<graph_t>::vertex_iterator it, end;
-        for (boost::tie(it, end) = vertices(graph); it != end; ++it) {
-            core.insert(*it);
+    if (graph.NumVertices() == (graph.NumEdges() + 1)) {
+        for (vertex_t v = 0; v < graph.NumVertices(); ++v) {
+            core.insert(v);
         }
         return;
     }
@@ -99,439 +129,352 @@ void CfDecompose(graph_t const& graph, std::set<vertex_t>& core,
 
     std::set<vertex_t> not_core_indices = {};
     for (auto const& kv : rooted_subtree) {
-        for (int child : kv.second) {
-            not_core_indices.insert(child);
-        }
+        not_core_indices.insert(kv.second.begin(), kv.second.end());
     }
-    typename boost::graph_traits<graph_t>::vertex_iterator it, end;
-    for (boost::tie(it, end) = vertices(graph); it != end; ++it) {
-        if (not_core_indices.find(*it) == not_core_indices.end()) {
-            core.insert(*it);
+    for (vertex_t v = 0; v < graph.NumVertices(); ++v) {
+        if (not_core_indices.find(v) == not_core_indices.end()) {
+            core.insert(v);
         }
     }
 
     for (auto const& kv : rooted_subtree) {
         std::set<vertex_t> indices(kv.second);
         indices.insert(kv.first);
-        forest.push_back(indices);
+        forest.push_back(std::move(indices));
     }
 }
 
-int Mnd(graph_t const& graph, vertex_t const& v) {
-    typename boost::graph_traits<graph_t>::adjacency_iterator adjacency_it, adjacency_end;
-    boost::tie(adjacency_it, adjacency_end) = boost::adjacent_vertices(v, graph);
+int Mnd(CompactGraph const& graph, vertex_t const& v) {
     std::size_t result = 0;
-    for (; adjacency_it != adjacency_end; ++adjacency_it) {
-        if (result < boost::degree(*adjacency_it, graph)) {
-            result = boost::degree(*adjacency_it, graph);
-        }
+    for (vertex_t adjacent : graph.Neighbours(v)) {
+        result = std::max(result, graph.Degree(adjacent));
     }
     return result;
 }
 
-void CountLabelDegrees(graph_t const& graph, vertex_t const& v,
-                       std::map<std::string, vertex_t>& result) {
-    typename boost::graph_traits<graph_t>::adjacency_iterator adjacency_it, adjacency_end;
-    boost::tie(adjacency_it, adjacency_end) = boost::adjacent_vertices(v, graph);
-    for (; adjacency_it != adjacency_end; ++adjacency_it) {
-        if (result.find(graph[*adjacency_it].attributes.at("label")) != result.end()) {
-            result[graph[*adjacency_it].attributes.at("label")]++;
-        } else {
-            result.emplace(graph[*adjacency_it].attributes.at("label"), 1);
-        }
+/* Sorted labels of the neighbours of v, a label occurs once for every neighbour having it */
+void GetNeighbourLabels(CompactGraph const& graph, vertex_t const& v,
+                        std::vector<CompactGraph::StringId>& result) {
+    result.clear();
+    for (vertex_t adjacent : graph.Neighbours(v)) {
+        result.push_back(graph.GetLabel(adjacent));
     }
+    std::sort(result.begin(), result.end());
 }
 
-bool CandVerify(graph_t const& graph, vertex_t const& v, graph_t const& query, vertex_t const& u) {
+bool CandVerify(CompactGraph const& graph, vertex_t const& v, CompactGraph const& query,
+                vertex_t const& u) {
     if (Mnd(graph, v) < Mnd(query, u)) {
         return false;
     }
-    std::map<std::string, vertex_t> graph_label_degrees;
-    CountLabelDegrees(graph, v, graph_label_degrees);
-    std::map<std::string, vertex_t> query_label_degrees;
-    CountLabelDegrees(query, u, query_label_degrees);
-
-    for (auto const& label_degree : query_label_degrees) {
-        std::string const& label = label_degree.first;
-        std::size_t const& degree = label_degree.second;
-        if (graph_label_degrees.find(label) == graph_label_degrees.end() ||
-            graph_label_degrees.at(label) < degree) {
-            return false;
-        }
-    }
-    return true;
-}
-
-void SortComplexity(std::vector<vertex_t>& order, graph_t const& graph, graph_t const& query,
-                    std::map<std::string, std::set<vertex_t>> const& label_classes) {
-    auto cmp_complexity = [&graph, &query, &label_classes](vertex_t const& a, vertex_t const& b) {
-        std::size_t a_degree = boost::degree(a, query);
-        int an = 0;
-        for (const vertex_t& e : label_classes.at(query[a].attributes.at("label"))) {
-            if (boost::degree(e, graph) >= a_degree) {
-                an++;
-            }
-        }
-
-        std::size_t b_degree = boost::degree(b, query);
-        int bn = 0;
-        for (const vertex_t& e : label_classes.at(query[b].attributes.at("label"))) {
-            if (boost::degree(e, graph) >= b_degree) {
-                bn++;
+    // every vertex has to have at least as many neighbours with each label as the pattern one
+    thread_local std::vector<CompactGraph::StringId> graph_labels;
+    thread_local std::vector<CompactGraph::StringId> query_labels;
+    GetNeighbourLabels(graph, v, graph_labels);
+    GetNeighbourLabels(query, u, query_labels);
+    return std::includes(graph_labels.begin(), graph_labels.end(), query_labels.begin(),
+                         query_labels.end());
+}
+
+void SortComplexity(std::vector<vertex_t>& order, CompactGraph const& graph,
+                    CompactGraph const& query) {
+    std::map<vertex_t, std::size_t> complexity;
+    for (vertex_t const& u : order) {
+        std::size_t degree = query.Degree(u);
+        std::size_t n = 0;
+        for (vertex_t e : graph.GetVerticesWithLabel(query.GetLabel(u))) {
+            if (graph.Degree(e) >= degree) {
+                n++;
             }
         }
-        return an / a_degree < bn / b_degree;
-    };
-    std::sort(order.begin(), order.end(), cmp_complexity);
+        complexity.emplace(u, n / degree);
+    }
+    std::sort(order.begin(), order.end(), [&complexity](vertex_t const& a, vertex_t const& b) {
+        return complexity.at(a) < complexity.at(b);
+    });
 }
 
-void SortAccurateComplexity(std::vector<vertex_t>& order, graph_t const& graph,
-                            graph_t const& query,
-                            std::map<std::string, std::set<vertex_t>> const& label_classes) {
+void SortAccurateComplexity(std::vector<vertex_t>& order, CompactGraph const& graph,
+                            CompactGraph const& query, config::ThreadNumType threads_num) {
     int top = std::min(int(order.size()), 3);
-    auto cmp_accurate_complexity = [&graph, &query, &label_classes](vertex_t const& a,
-                                                                    vertex_t const& b) {
-        int a_degree = boost::degree(a, query);
-        int an = 0;
-        for (const vertex_t& e : label_classes.at(query[a].attributes.at("label"))) {
-            if (CandVerify(graph, e, query, a)) {
-                an++;
-            }
-        }
-
-        int b_degree = boost::degree(b, query);
-        int bn = 0;
-        for (const vertex_t& e : label_classes.at(query[b].attributes.at("label"))) {
-            if (CandVerify(graph, e, query, b)) {
-                bn++;
-            }
-        }
-        return an / a_degree < bn / b_degree;
-    };
-    std::sort(order.begin(), std::next(order.begin(), top), cmp_accurate_complexity);
-}
-
-int GetRoot(graph_t const& graph, graph_t const& query, std::set<vertex_t> const& core) {
-    std::map<std::string, std::set<vertex_t>> label_classes;
-    typename boost::graph_traits<graph_t>::vertex_iterator it, end;
-    for (boost::tie(it, end) = vertices(graph); it != end; ++it) {
-        if (label_classes.find(graph[*it].attributes.at("label")) != label_classes.end()) {
-            label_classes[graph[*it].attributes.at("label")].insert(*it);
-        } else {
-            std::set<vertex_t> value = {*it};
-            label_classes.emplace(graph[*it].attributes.at("label"), value);
-        }
-    }
+    std::map<vertex_t, int> complexity;
+    for (int i = 0; i < top; ++i) {
+        vertex_t const u = order[i];
+        int degree = query.Degree(u);
+        int n = FilterVertices(
+                        graph.GetVerticesWithLabel(query.GetLabel(u)),
+                        [&graph, &query, u](vertex_t e) { return CandVerify(graph, e, query, u); },
+                        threads_num)
+                        .size();
+        complexity.emplace(u, n / degree);
+    }
+    std::sort(order.begin(), std::next(order.begin(), top),
+              [&complexity](vertex_t const& a, vertex_t const& b) {
+                  return complexity.at(a) < complexity.at(b);
+              });
+}
+
+int GetRoot(CompactGraph const& graph, CompactGraph const& query, std::set<vertex_t> const& core,
+            config::ThreadNumType threads_num) {
     std::vector<vertex_t> order(core.begin(), core.end());
 
-    SortComplexity(order, graph, query, label_classes);
-    SortAccurateComplexity(order, graph, query, label_classes);
+    SortComplexity(order, graph, query);
+    SortAccurateComplexity(order, graph, query, threads_num);
     return *order.begin();
 }
 
-void MakeLevels(graph_t const& query, vertex_t const& root, std::vector<std::set<vertex_t>>& levels,
-                std::map<vertex_t, vertex_t>& parent) {
+void MakeLevels(CompactGraph const& query, vertex_t const& root,
+                std::vector<std::set<vertex_t>>& levels, std::map<vertex_t, vertex_t>& parent) {
     std::set<vertex_t> current = {root};
     std::set<vertex_t> marked = {root};
     while (!current.empty()) {
         levels.push_back(current);
         std::set<vertex_t> next = {};
         for (vertex_t const& vertex : current) {
-            typename boost::graph_traits<graph_t>::adjacency_iterator adjacency_it, adjacency_end;
-            boost::tie(adjacency_it, adjacency_end) = boost::adjacent_vertices(vertex, query);
-            for (; adjacency_it != adjacency_end; ++adjacency_it) {
-                if (marked.find(*adjacency_it) == marked.end()) {
-                    marked.insert(*adjacency_it);
-                    next.insert(*adjacency_it);
-                    parent.emplace(*adjacency_it, vertex);
+            for (vertex_t adjacent : query.Neighbours(vertex)) {
+                if (marked.find(adjacent) == marked.end()) {
+                    marked.insert(adjacent);
+                    next.insert(adjacent);
+                    parent.emplace(adjacent, vertex);
                 }
             }
         }
-        current = next;
+        current = std::move(next);
     }
 }
 
-void MakeNte(graph_t const& query, std::vector<std::set<vertex_t>>& levels,
-             std::map<vertex_t, vertex_t>& parent, std::set<edge_t>& nte, std::set<edge_t>& snte) {
-    typename boost::graph_traits<graph_t>::edge_iterator it_edge, end_edge;
-    for (boost::tie(it_edge, end_edge) = edges(query); it_edge != end_edge; ++it_edge) {
-        vertex_t origin = boost::source(*it_edge, query);
-        vertex_t finish = boost::target(*it_edge, query);
-        if ((parent.find(origin) != parent.end()) && (parent.find(finish) != parent.end()) &&
-            (parent.at(origin) != finish) && (parent.at(finish) != origin)) {
-            int origin_level = 0;
-            int finish_level = 0;
-            for (std::size_t i = 0; i < levels.size(); ++i) {
-                if (levels.at(i).find(origin) != levels.at(i).end()) {
-                    origin_level = i;
+void MakeNte(CompactGraph const& query, std::vector<std::set<vertex_t>>& levels,
+             std::map<vertex_t, vertex_t>& parent, std::set<PatternEdge>& nte,
+             std::set<PatternEdge>& snte) {
+    for (vertex_t origin = 0; origin < query.NumVertices(); ++origin) {
+        for (vertex_t finish : query.Neighbours(origin)) {
+            if (finish < origin) {
+                continue;
+            }
+            if ((parent.find(origin) != parent.end()) && (parent.find(finish) != parent.end()) &&
+                (parent.at(origin) != finish) && (parent.at(finish) != origin)) {
+                int origin_level = 0;
+                int finish_level = 0;
+                for (std::size_t i = 0; i < levels.size(); ++i) {
+                    if (levels.at(i).find(origin) != levels.at(i).end()) {
+                        origin_level = i;
+                    }
+                    if (levels.at(i).find(finish) != levels.at(i).end()) {
+                        finish_level = i;
+                    }
                 }
-                if (levels.at(i).find(finish) != levels.at(i).end()) {
-                    finish_level = i;
+                if (origin_level == finish_level) {
+                    snte.insert(MakeEdge(origin, finish));
                 }
+                nte.insert(MakeEdge(origin, finish));
             }
-            if (origin_level == finish_level) {
-                snte.insert(*it_edge);
-            }
-            nte.insert(*it_edge);
         }
     }
 }
 
-void BfsTree(graph_t const& query, vertex_t const& root, std::vector<std::set<vertex_t>>& levels,
-             std::map<vertex_t, vertex_t>& parent, std::set<edge_t>& nte, std::set<edge_t>& snte) {
+void BfsTree(CompactGraph const& query, vertex_t const& root,
+             std::vector<std::set<vertex_t>>& levels, std::map<vertex_t, vertex_t>& parent,
+             std::set<PatternEdge>& nte, std::set<PatternEdge>& snte) {
     MakeLevels(query, root, levels, parent);
     MakeNte(query, levels, parent, nte, snte);
 }
 
-void DirectConstruction(std::set<vertex_t> const& lev, graph_t const& graph, graph_t const& query,
-                        std::map<vertex_t, std::set<vertex_t>>& candidates,
-                        std::map<vertex_t, int>& cnts,
+/* Counts for every neighbour of the candidates of u_neighbour that may be matched to u how many
+ * of the previous neighbours of u it is adjacent to */
+void CountAdjacent(CompactGraph const& graph, CompactGraph const& query, vertex_t const& u,
+                   std::set<vertex_t> const& neighbour_candidates, Counts& cnts, int cnt) {
+    for (vertex_t const& v : neighbour_candidates) {
+        for (vertex_t adjacent : graph.Neighbours(v)) {
+            if (graph.GetLabel(adjacent) != query.GetLabel(u) ||
+                graph.Degree(adjacent) < query.Degree(u)) {
+                continue;
+            }
+            auto it = cnts.find(adjacent);
+            if (it == cnts.end()) {
+                if (cnt == 0) {
+                    cnts.emplace(adjacent, 1);
+                }
+            } else if (it->second == cnt) {
+                it->second++;
+            }
+        }
+    }
+}
+
+void DirectConstruction(std::set<vertex_t> const& lev, CompactGraph const& graph,
+                        CompactGraph const& query,
+                        std::map<vertex_t, std::set<vertex_t>>& candidates, Counts& cnts,
                         std::map<vertex_t, std::set<vertex_t>>& unvisited_neighbours,
-                        std::set<edge_t> const& snte, std::set<vertex_t>& visited) {
+                        std::set<PatternEdge> const& snte, std::set<vertex_t>& visited,
+                        config::ThreadNumType threads_num) {
     for (vertex_t const& u : lev) {
         int cnt = 0;
-        typename boost::graph_traits<graph_t>::adjacency_iterator adjacency_it, adjacency_end;
-        boost::tie(adjacency_it, adjacency_end) = boost::adjacent_vertices(u, query);
-        for (; adjacency_it != adjacency_end; ++adjacency_it) {
-            if (visited.find(query[*adjacency_it].node_id) == visited.end() &&
-                snte.find(boost::edge(*adjacency_it, u, query).first) != snte.end()) {
-                if (unvisited_neighbours.find(u) != unvisited_neighbours.end()) {
-                    unvisited_neighbours.at(u).insert(*adjacency_it);
-                } else {
-                    std::set<vertex_t> value = {*adjacency_it};
-                    unvisited_neighbours.emplace(u, value);
-                }
-            } else if (visited.find(*adjacency_it) != visited.end()) {
-                for (vertex_t const& v : candidates.at(*adjacency_it)) {
-                    typename boost::graph_traits<graph_t>::adjacency_iterator g_adj_it, g_adj_end;
-                    boost::tie(g_adj_it, g_adj_end) = boost::adjacent_vertices(v, graph);
-                    for (; g_adj_it != g_adj_end; ++g_adj_it) {
-                        if (graph[*g_adj_it].attributes.at("label") ==
-                                    query[u].attributes.at("label") &&
-                            boost::degree(*g_adj_it, graph) >= boost::degree(u, query)) {
-                            if (cnts.find(*g_adj_it) == cnts.end()) {
-                                if (cnt == 0) {
-                                    cnts.emplace(*g_adj_it, 1);
-                                }
-                            } else {
-                                if (cnts.at(*g_adj_it) == cnt) {
-                                    cnts[*g_adj_it]++;
-                                }
-                            }
-                        }
-                    }
-                }
+        for (vertex_t adjacent : query.Neighbours(u)) {
+            if (visited.find(adjacent) == visited.end() &&
+                snte.find(MakeEdge(adjacent, u)) != snte.end()) {
+                unvisited_neighbours[u].insert(adjacent);
+            } else if (visited.find(adjacent) != visited.end()) {
+                CountAdjacent(graph, query, u, candidates.at(adjacent), cnts, cnt);
                 cnt++;
             }
         }
-        typename boost::graph_traits<graph_t>::vertex_iterator g_it, g_end;
-        for (boost::tie(g_it, g_end) = vertices(graph); g_it != g_end; ++g_it) {
-            if (((cnts.find(*g_it) == cnts.end()) && (cnt == 0)) ||
-                ((cnts.find(*g_it) != cnts.end()) && (cnts.at(*g_it) == cnt))) {
-                if (CandVerify(graph, *g_it, query, u)) {
-                    candidates.at(u).insert(*g_it);
+
+        // vertices adjacent to the candidates of all visited neighbours, every vertex if there
+        // are none
+        auto cand_verify = [&graph, &query, &u](vertex_t v) {
+            return CandVerify(graph, v, query, u);
+        };
+        std::vector<vertex_t> verified;
+        if (cnt == 0) {
+            verified = FilterVertices(std::views::iota(vertex_t{0}, graph.NumVertices()),
+                                      cand_verify, threads_num);
+        } else {
+            std::vector<vertex_t> counted;
+            for (auto const& [v, count] : cnts) {
+                if (count == cnt) {
+                    counted.push_back(v);
                 }
             }
+            verified = FilterVertices(counted, cand_verify, threads_num);
         }
+        candidates.at(u).insert(verified.begin(), verified.end());
         visited.insert(u);
         cnts.clear();
     }
 }
 
-void ReverseConstruction(std::set<vertex_t> const& lev, graph_t const& graph, graph_t const& query,
-                         std::map<vertex_t, std::set<vertex_t>>& candidates,
-                         std::map<vertex_t, int>& cnts,
+void ReverseConstruction(std::set<vertex_t> const& lev, CompactGraph const& graph,
+                         CompactGraph const& query,
+                         std::map<vertex_t, std::set<vertex_t>>& candidates, Counts& cnts,
                          std::map<vertex_t, std::set<vertex_t>>& unvisited_neighbours) {
-    for (std::set<vertex_t>::iterator j = --lev.end(); j != std::next(lev.begin(), -1); --j) {
+    for (auto j = lev.rbegin(); j != lev.rend(); ++j) {
         vertex_t u = *j;
         int cnt = 0;
         if (unvisited_neighbours.find(u) != unvisited_neighbours.end()) {
             for (vertex_t const& un : unvisited_neighbours.at(u)) {
-                for (vertex_t const& v : candidates.at(un)) {
-                    typename boost::graph_traits<graph_t>::adjacency_iterator g_adj_it, g_adj_end;
-                    boost::tie(g_adj_it, g_adj_end) =
-                            boost::adjacent_vertices(boost::vertex(v, graph), graph);
-                    for (; g_adj_it != g_adj_end; ++g_adj_it) {
-                        if (graph[*g_adj_it].attributes.at("label") ==
-                                    query[u].attributes.at("label") &&
-                            boost::degree(*g_adj_it, graph) >= boost::degree(u, query)) {
-                            if (cnts.find(*g_adj_it) == cnts.end()) {
-                                if (cnt == 0) {
-                                    cnts.emplace(*g_adj_it, 1);
-                                }
-                            } else {
-                                if (cnts.at(*g_adj_it) == cnt) {
-                                    cnts[*g_adj_it]++;
-                                }
-                            }
-                        }
-                    }
-                }
+                CountAdjacent(graph, query, u, candidates.at(un), cnts, cnt);
                 cnt++;
             }
         }
 
-        std::set<vertex_t> to_delete = {};
-        for (vertex_t const& v : candidates.at(u)) {
-            if (!(((cnts.find(v) == cnts.end()) && (cnt == 0)) ||
-                  ((cnts.find(v) != cnts.end()) && (cnts.at(v) == cnt)))) {
-                to_delete.insert(v);
-            }
-        }
-        for (vertex_t const& d : to_delete) {
-            candidates.at(u).erase(d);
-        }
+        std::erase_if(candidates.at(u), [&cnts, cnt](vertex_t v) {
+            auto it = cnts.find(v);
+            return !((it == cnts.end() && cnt == 0) || (it != cnts.end() && it->second == cnt));
+        });
         cnts.clear();
     }
 }
 
-void FinalConstruction(std::set<vertex_t> const& lev, CPI& cpi, graph_t const& graph,
-                       graph_t const& query, std::map<vertex_t, vertex_t> const& parent,
+void FinalConstruction(std::set<vertex_t> const& lev, CPI& cpi, CompactGraph const& graph,
+                       CompactGraph const& query, std::map<vertex_t, vertex_t> const& parent,
                        std::map<vertex_t, std::set<vertex_t>>& candidates) {
     for (vertex_t const& u : lev) {
         vertex_t up = parent.at(u);
+        CompactGraph::StringId const edge_label = query.GetEdgeLabel(up, u);
+        std::set<vertex_t> const& u_candidates = candidates.at(u);
+        // every candidate of up gets an entry, maybe empty, so the lookups don't fail
+        std::map<vertex_t, std::set<vertex_t>>& edge_candidates = cpi[{up, u}];
         for (vertex_t const& vp : candidates.at(up)) {
-            typename boost::graph_traits<graph_t>::adjacency_iterator g_adj_it, g_adj_end;
-            boost::tie(g_adj_it, g_adj_end) = boost::adjacent_vertices(vp, graph);
-            for (; g_adj_it != g_adj_end; ++g_adj_it) {
-                if (graph[*g_adj_it].attributes.at("label") == query[u].attributes.at("label") &&
-                    boost::degree(*g_adj_it, graph) >= boost::degree(u, query) &&
-                    candidates.at(u).find(*g_adj_it) != candidates.at(u).end() &&
-                    query[boost::edge(up, u, query).first].label ==
-                            graph[boost::edge(vp, *g_adj_it, graph).first].label) {
-                    std::pair<vertex_t, vertex_t> cpi_edge(up, u);
-                    if (cpi.find(cpi_edge) != cpi.end()) {
-                        if (cpi.at(cpi_edge).find(vp) != cpi.at(cpi_edge).end()) {
-                            cpi.at(cpi_edge).at(vp).insert(*g_adj_it);
-                        } else {
-                            std::set<vertex_t> value = {*g_adj_it};
-                            cpi.at(cpi_edge).emplace(vp, value);
-                        }
-                    } else {
-                        std::map<vertex_t, std::set<vertex_t>> edge_map;
-                        std::set<vertex_t> value = {*g_adj_it};
-                        edge_map.emplace(vp, value);
-                        cpi.emplace(cpi_edge, edge_map);
-                    }
+            std::set<vertex_t>& children = edge_candidates[vp];
+            std::span<CompactGraph::VertexId const> neighbours = graph.Neighbours(vp);
+            std::span<CompactGraph::StringId const> edge_labels = graph.EdgeLabels(vp);
+            for (size_t i = 0; i < neighbours.size(); ++i) {
+                vertex_t adjacent = neighbours[i];
+                if (graph.GetLabel(adjacent) == query.GetLabel(u) &&
+                    graph.Degree(adjacent) >= query.Degree(u) &&
+                    u_candidates.find(adjacent) != u_candidates.end() &&
+                    edge_labels[i] == edge_label) {
+                    children.insert(adjacent);
                 }
             }
         }
     }
 }
 
-void TopDownConstruct(CPI& cpi, graph_t const& graph, graph_t const& query,
+void TopDownConstruct(CPI& cpi, CompactGraph const& graph, CompactGraph const& query,
                       std::vector<std::set<vertex_t>> const& levels,
                       std::map<vertex_t, vertex_t> const& parent,
                       std::map<vertex_t, std::set<vertex_t>>& candidates,
-                      std::set<edge_t> const& snte) {
+                      std::set<PatternEdge> const& snte, config::ThreadNumType threads_num) {
     vertex_t root = *levels.at(0).begin();
-    typename boost::graph_traits<graph_t>::vertex_iterator it, end;
-    for (boost::tie(it, end) = vertices(query); it != end; ++it) {
-        std::set<vertex_t> empty = {};
-        candidates.emplace(*it, empty);
+    for (vertex_t u = 0; u < query.NumVertices(); ++u) {
+        candidates.emplace(u, std::set<vertex_t>{});
     }
 
-    for (boost::tie(it, end) = vertices(graph); it != end; ++it) {
-        if (graph[*it].attributes.at("label") == query[root].attributes.at("label") &&
-            boost::degree(*it, graph) >= boost::degree(root, query) &&
-            CandVerify(graph, *it, query, root)) {
-            candidates.at(root).insert(*it);
-        }
-    }
+    std::vector<vertex_t> root_candidates = FilterVertices(
+            graph.GetVerticesWithLabel(query.GetLabel(root)),
+            [&graph, &query, root](vertex_t v) {
+                return graph.Degree(v) >= query.Degree(root) && CandVerify(graph, v, query, root);
+            },
+            threads_num);
+    candidates.at(root).insert(root_candidates.begin(), root_candidates.end());
     std::set<vertex_t> visited = {root};
     std::map<vertex_t, std::set<vertex_t>> unvisited_neighbours;
-    std::map<vertex_t, int> cnts;
+    Counts cnts;
 
-    std::vector<std::set<vertex_t>>::const_iterator i = std::next(levels.cbegin());
-    for (; i != levels.cend(); ++i) {
-        std::set<vertex_t> lev = *i;
+    for (auto i = std::next(levels.cbegin()); i != levels.cend(); ++i) {
+        std::set<vertex_t> const& lev = *i;
         DirectConstruction(lev, graph, query, candidates, cnts, unvisited_neighbours, snte,
-                           visited);
+                           visited, threads_num);
         ReverseConstruction(lev, graph, query, candidates, cnts, unvisited_neighbours);
         FinalConstruction(lev, cpi, graph, query, parent, candidates);
     }
 }
 
-void InitialRefinement(vertex_t const& u, graph_t const& graph, graph_t const& query,
+void InitialRefinement(vertex_t const& u, CompactGraph const& graph, CompactGraph const& query,
                        std::map<vertex_t, vertex_t> const& parent,
-                       std::map<vertex_t, std::set<vertex_t>>& candidates,
-                       std::map<vertex_t, int>& cnts, int& cnt) {
-    typename boost::graph_traits<graph_t>::adjacency_iterator q_adj_it, q_adj_end;
-    boost::tie(q_adj_it, q_adj_end) = boost::adjacent_vertices(u, query);
-    for (; q_adj_it != q_adj_end; ++q_adj_it) {
-        if ((parent.find(*q_adj_it) != parent.end()) && (parent.at(*q_adj_it) == u)) {
-            for (vertex_t const& v : candidates.at(*q_adj_it)) {
-                typename boost::graph_traits<graph_t>::adjacency_iterator g_adj_it, g_adj_end;
-                boost::tie(g_adj_it, g_adj_end) = boost::adjacent_vertices(v, graph);
-                for (; g_adj_it != g_adj_end; ++g_adj_it) {
-                    if (graph[*g_adj_it].attributes.at("label") ==
-                                query[u].attributes.at("label") &&
-                        boost::degree(*g_adj_it, graph) >= boost::degree(u, query)) {
-                        if (cnts.find(*g_adj_it) == cnts.end()) {
-                            if (cnt == 0) {
-                                cnts.emplace(*g_adj_it, 1);
-                            }
-                        } else {
-                            if (cnts.at(*g_adj_it) == cnt) {
-                                cnts[*g_adj_it]++;
-                            }
-                        }
-                    }
-                }
-            }
+                       std::map<vertex_t, std::set<vertex_t>>& candidates, Counts& cnts,
+                       int& cnt) {
+    for (vertex_t child : query.Neighbours(u)) {
+        if ((parent.find(child) != parent.end()) && (parent.at(child) == u)) {
+            CountAdjacent(graph, query, u, candidates.at(child), cnts, cnt);
             cnt++;
         }
     }
 }
 
 void OddDeletion(vertex_t const& u, CPI& cpi, std::map<vertex_t, std::set<vertex_t>>& candidates,
-                 std::map<vertex_t, int>& cnts, int& cnt) {
+                 Counts& cnts, int& cnt) {
     std::set<vertex_t> to_delete = {};
     for (vertex_t const& v : candidates.at(u)) {
-        if (!(((cnts.find(v) == cnts.end()) && (cnt == 0)) ||
-              ((cnts.find(v) != cnts.end()) && (cnts.at(v) == cnt)))) {
+        auto it = cnts.find(v);
+        if (!((it == cnts.end() && cnt == 0) || (it != cnts.end() && it->second == cnt))) {
             to_delete.insert(v);
         }
     }
     for (vertex_t const& d : to_delete) {
         candidates.at(u).erase(d);
-        for (auto const& e : cpi) {
-            if (e.second.find(d) != e.second.end()) {
-                cpi.at(e.first).erase(d);
+        for (auto& [edge, edge_candidates] : cpi) {
+            if (edge.first == u) {
+                edge_candidates.erase(d);
             }
         }
     }
     cnts.clear();
 }
 
-void FinalRefinement(vertex_t const& u, CPI& cpi, graph_t const& query,
+void FinalRefinement(vertex_t const& u, CPI& cpi, CompactGraph const& query,
                      std::map<vertex_t, vertex_t> const& parent,
                      std::map<vertex_t, std::set<vertex_t>>& candidates) {
     for (vertex_t const& v : candidates.at(u)) {
-        typename boost::graph_traits<graph_t>::adjacency_iterator q_adj_it, q_adj_end;
-        boost::tie(q_adj_it, q_adj_end) = boost::adjacent_vertices(u, query);
-        for (; q_adj_it != q_adj_end; ++q_adj_it) {
-            vertex_t u2 = *q_adj_it;
+        for (vertex_t u2 : query.Neighbours(u)) {
             if ((parent.find(u2) != parent.end()) && (parent.at(u2) == u)) {
-                std::pair<vertex_t, vertex_t> cpi_edge(u, u2);
-                for (vertex_t const& v2 : cpi.at(cpi_edge).at(v)) {
-                    if (candidates.at(u2).find(v2) == candidates.at(u2).end()) {
-                        cpi.at(cpi_edge).at(v).erase(v2);
-                    }
-                }
+                std::set<vertex_t> const& u2_candidates = candidates.at(u2);
+                std::erase_if(cpi.at({u, u2}).at(v), [&u2_candidates](vertex_t v2) {
+                    return u2_candidates.find(v2) == u2_candidates.end();
+                });
             }
         }
     }
 }
 
-void BottomUpRefinement(CPI& cpi, graph_t const& graph, graph_t const& query,
+void BottomUpRefinement(CPI& cpi, CompactGraph const& graph, CompactGraph const& query,
                         std::vector<std::set<vertex_t>> const& levels,
                         std::map<vertex_t, vertex_t> const& parent,
                         std::map<vertex_t, std::set<vertex_t>>& candidates) {
-    std::map<vertex_t, int> cnts;
+    Counts cnts;
 
-    std::vector<std::set<vertex_t>>::const_iterator lev_it;
-    for (lev_it = --levels.cend(); lev_it != std::next(levels.begin(), -1); --lev_it) {
+    for (auto lev_it = levels.crbegin(); lev_it != levels.crend(); ++lev_it) {
         for (vertex_t const& u : *lev_it) {
             int cnt = 0;
             InitialRefinement(u, graph, query, parent, candidates, cnts, cnt);
@@ -557,12 +500,8 @@ int NumOfEmbeddings(const CPI& cpi, std::vector<vertex_t> const& path, vertex_t
         for (auto& vert_cans : cpi.at(cur_edge)) {
             for (vertex_t const& can : vert_cans.second) {
                 std::pair<vertex_t, vertex_t> key(path.at(i - 1), vert_cans.first);
-                std::pair<vertex_t, vertex_t> counted(path.at(i), can);
-                if (new_result.find(key) != new_result.end()) {
-                    new_result[key] += result.at(counted);
-                } else {
-                    new_result.emplace(key, result.at(counted));
-                }
+                auto counted = result.find({path.at(i), can});
+                new_result[key] += counted == result.end() ? 0 : counted->second;
             }
         }
         result = new_result;
@@ -578,7 +517,7 @@ int CandidatesCardinality(const CPI& cpi, vertex_t const& u) {
     for (auto& edge_cans : cpi) {
         auto edge = edge_cans.first;
         if (edge.first == u) {
-            return edge_cans.second.size();
+            return std::max(edge_cans.second.size(), std::size_t{1});
         }
     }
     return 1;
@@ -658,15 +597,13 @@ std::vector<vertex_t> MatchingOrder(const CPI& cpi,
     return seq;
 }
 
-bool ValidateNt(graph_t const& graph, vertex_t const& v, graph_t const& query, vertex_t const& u,
-                std::vector<vertex_t> const& seq, std::map<vertex_t, vertex_t> const& parent,
-                Match match) {
+bool ValidateNt(CompactGraph const& graph, vertex_t const& v, CompactGraph const& query,
+                vertex_t const& u, std::vector<vertex_t> const& seq,
+                std::map<vertex_t, vertex_t> const& parent, Match const& match) {
     int index = std::find(seq.begin(), seq.end(), u) - seq.begin();
     for (int i = 0; i < index; ++i) {
-        if ((seq.at(i) != parent.at(u)) && boost::edge(seq.at(i), u, query).second) {
-            if (!boost::edge(*match.at(i).first, v, graph).second ||
-                graph[boost::edge(*match.at(i).first, v, graph).first].label !=
-                        query[boost::edge(seq.at(i), u, query).first].label) {
+        if ((seq.at(i) != parent.at(u)) && query.HasEdge(seq.at(i), u)) {
+            if (!graph.HasEdge(*match.at(i).first, v, query.GetEdgeLabel(seq.at(i), u))) {
                 return false;
             }
         }
@@ -721,53 +658,19 @@ bool Visited(Match const& match, vertex_t const& v, std::size_t const& index) {
     return false;
 }
 
-bool Satisfied(graph_t const& graph, graph_t const& query, std::vector<vertex_t> const& seq,
-               Match const& match, std::vector<Literal> const& literals) {
-    for (Literal const& l : literals) {
-        auto fst_token = l.first;
-        auto snd_token = l.second;
-        std::string fst;
-        std::string snd;
-        if (fst_token.first == -1) {
-            fst = fst_token.second;
-        } else {
-            vertex_t v;
-            vertex_t u = boost::vertex(fst_token.first, query);
-            int index = std::find(seq.begin(), seq.end(), u) - seq.begin();
-            v = *match.at(index).first;
-            auto attrs = graph[v].attributes;
-            if (attrs.find(fst_token.second) == attrs.end()) {
-                return false;
-            }
-            fst = attrs.at(fst_token.second);
-        }
-        if (snd_token.first == -1) {
-            snd = snd_token.second;
-        } else {
-            vertex_t v;
-            vertex_t u = boost::vertex(snd_token.first, query);
-            int index = std::find(seq.begin(), seq.end(), u) - seq.begin();
-            v = *match.at(index).first;
-            auto attrs = graph[v].attributes;
-            if (attrs.find(snd_token.second) == attrs.end()) {
-                return false;
-            }
-            snd = attrs.at(snd_token.second);
-        }
-        if (fst != snd) {
-            return false;
-        }
-    }
-    return true;
+bool Satisfied(CompactGraph const& graph, std::vector<vertex_t> const& seq, Match const& match,
+               CompactLiterals const& literals) {
+    return literals.Hold(graph, [&seq, &match](int u) {
+        int index = std::find(seq.begin(), seq.end(), u) - seq.begin();
+        return static_cast<CompactGraph::VertexId>(*match.at(index).first);
+    });
 }
 
-void FullNTs(std::vector<std::vector<vertex_t>> const& paths, std::set<edge_t> const& nte,
-             graph_t const& query, std::vector<vertex_t>& NTs) {
+void FullNTs(std::vector<std::vector<vertex_t>> const& paths, std::set<PatternEdge> const& nte,
+             std::vector<vertex_t>& NTs) {
     for (auto& path : paths) {
         int nt = 0;
-        for (auto& desc : nte) {
-            vertex_t source = boost::source(desc, query);
-            vertex_t target = boost::target(desc, query);
+        for (auto& [source, target] : nte) {
             if ((std::find(path.begin(), path.end(), source) != path.end()) ||
                 (std::find(path.begin(), path.end(), target) != path.end())) {
                 nt++;
@@ -777,72 +680,31 @@ void FullNTs(std::vector<std::vector<vertex_t>> const& paths, std::set<edge_t> c
     }
 }
 
-void CompleteSeq(CPI& cpi, std::vector<std::set<vertex_t>> const& forest,
-                 std::map<vertex_t, vertex_t> const& parent, graph_t const& query,
-                 std::set<edge_t> const& nte, std::vector<vertex_t>& seq) {
+void CompleteSeq(CPI const& cpi, std::vector<std::set<vertex_t>> const& forest,
+                 std::map<vertex_t, vertex_t> const& parent, std::set<PatternEdge> const& nte,
+                 std::vector<vertex_t>& seq) {
     for (auto& tree : forest) {
         std::vector<std::vector<vertex_t>> tree_paths = GetPaths(tree, parent);
 
         std::vector<vertex_t> tree_nts = {};
-        for (auto& path : tree_paths) {
-            int nt = 0;
-            for (auto& desc : nte) {
-                vertex_t source = boost::source(desc, query);
-                vertex_t target = boost::target(desc, query);
-                if ((std::find(path.begin(), path.end(), source) != path.end()) ||
-                    (std::find(path.begin(), path.end(), target) != path.end())) {
-                    nt++;
-                }
-            }
-            tree_nts.push_back(nt);
-        }
+        FullNTs(tree_paths, nte, tree_nts);
         std::vector<vertex_t> tree_seq = MatchingOrder(cpi, tree_paths, tree_nts);
 
         seq.insert(seq.end(), ++tree_seq.begin(), tree_seq.end());
     }
 }
 
-bool FullMatch(CPI& cpi, Match& match, std::set<vertex_t> const& root_candidates,
-               std::set<vertex_t> const& core, std::vector<vertex_t> const& seq,
-               std::map<vertex_t, vertex_t> const& parent, graph_t const& graph,
-               graph_t const& query) {
-    match.push_back({root_candidates.begin(), root_candidates.end()});
-    for (std::size_t i = 1; i < core.size(); ++i) {
-        std::pair<vertex_t, vertex_t> edge(parent.at(seq.at(i)), seq.at(i));
-        int index = std::find(seq.begin(), seq.end(), parent.at(seq.at(i))) - seq.begin();
-        std::pair<std::set<vertex_t>::iterator, std::set<vertex_t>::iterator> its(
-                cpi.at(edge).at(*match.at(index).first).begin(),
-                cpi.at(edge).at(*match.at(index).first).end());
-        match.push_back(its);
-
-        while ((match.at(i).first != match.at(i).second) &&
-               (Visited(match, *match.at(i).first, i) ||
-                !ValidateNt(graph, *match.at(i).first, query, seq.at(i), seq, parent, match))) {
-            match.at(i).first++;
-        }
-        if (match.at(i).first == match.at(i).second) {
-            LOG(DEBUG) << "Trivially satisfied";
-            return true;
-        }
-    }
-    for (std::size_t i = core.size(); i < seq.size(); ++i) {
-        match.push_back({root_candidates.end(), root_candidates.end()});
-    }
-    return false;
-}
-
 void IncrementMatch(int& i, const CPI& cpi, Match& match,
                     std::map<vertex_t, vertex_t> const& parent, std::set<vertex_t> const& core,
-                    std::vector<vertex_t> const& seq, graph_t const& graph, graph_t const& query) {
+                    std::vector<vertex_t> const& seq, CompactGraph const& graph,
+                    CompactGraph const& query) {
     while ((i != static_cast<int>(core.size())) && (i != -1)) {
         if (match.at(i).first == match.at(i).second) {
             std::pair<vertex_t, vertex_t> edge(parent.at(seq.at(i)), seq.at(i));
             std::size_t index =
                     std::find(seq.begin(), seq.end(), parent.at(seq.at(i))) - seq.begin();
-            std::pair<std::set<vertex_t>::iterator, std::set<vertex_t>::iterator> its(
-                    cpi.at(edge).at(*match.at(index).first).begin(),
-                    cpi.at(edge).at(*match.at(index).first).end());
-            match[i] = its;
+            std::set<vertex_t> const& children = cpi.at(edge).at(*match.at(index).first);
+            match[i] = {children.begin(), children.end()};
         } else {
             match.at(i).first++;
         }
@@ -861,41 +723,20 @@ void IncrementMatch(int& i, const CPI& cpi, Match& match,
     }
 }
 
-bool CheckTrivially(const CPI& cpi, Match& match, std::map<vertex_t, vertex_t> const& parent,
-                    std::set<vertex_t> const& core, std::vector<vertex_t> const& seq) {
-    for (std::size_t k = core.size(); k < seq.size(); ++k) {
-        std::pair<vertex_t, vertex_t> edge(parent.at(seq.at(k)), seq.at(k));
-        std::size_t index = std::find(seq.begin(), seq.end(), parent.at(seq.at(k))) - seq.begin();
-        std::pair<std::set<vertex_t>::iterator, std::set<vertex_t>::iterator> its(
-                cpi.at(edge).at(*match.at(index).first).begin(),
-                cpi.at(edge).at(*match.at(index).first).end());
-        match[k] = its;
-
-        while ((match.at(k).first != match.at(k).second) && Visited(match, *match.at(k).first, k)) {
-            match.at(k).first++;
-        }
-        if (match.at(k).first == match.at(k).second) {
-            LOG(DEBUG) << "Trivially satisfied";
-            return true;
-        }
-    }
-    return false;
-}
-
+/* Checks the matches extending the current match of the core to the forest */
 bool CheckMatch(const CPI& cpi, Match& match, std::map<vertex_t, vertex_t> const& parent,
                 std::set<vertex_t> const& core, std::vector<vertex_t> const& seq,
-                graph_t const& graph, graph_t const& query, Gfd const& gfd, int& amount) {
-    while (true) {
-        std::size_t j = seq.size() - 1;
+                CompactGraph const& graph, CompactGfd const& gfd, int& amount,
+                std::atomic<bool> const& stop) {
+    std::size_t j = core.size();
+    while (!stop.load(std::memory_order_relaxed)) {
         while ((j != seq.size()) && (j != core.size() - 1)) {
             if (match.at(j).first == match.at(j).second) {
                 std::pair<vertex_t, vertex_t> edge(parent.at(seq.at(j)), seq.at(j));
                 std::size_t index =
                         std::find(seq.begin(), seq.end(), parent.at(seq.at(j))) - seq.begin();
-                std::pair<std::set<vertex_t>::iterator, std::set<vertex_t>::iterator> its(
-                        cpi.at(edge).at(*match.at(index).first).begin(),
-                        cpi.at(edge).at(*match.at(index).first).end());
-                match[j] = its;
+                std::set<vertex_t> const& children = cpi.at(edge).at(*match.at(index).first);
+                match[j] = {children.begin(), children.end()};
             } else {
                 match.at(j).first++;
             }
@@ -916,50 +757,28 @@ bool CheckMatch(const CPI& cpi, Match& match, std::map<vertex_t, vertex_t> const
 
         amount++;
         // check
-        if (!Satisfied(graph, query, seq, match, gfd.GetPremises())) {
-            continue;
-        }
-        if (!Satisfied(graph, query, seq, match, gfd.GetConclusion())) {
-            LOG(DEBUG) << "Checked embeddings: " << amount;
+        if (Satisfied(graph, seq, match, gfd.premises) &&
+            !Satisfied(graph, seq, match, gfd.conclusion)) {
             return false;
         }
+        j = seq.size() - 1;
     }
     return true;
 }
 
-bool Check(CPI& cpi, graph_t const& graph, Gfd const& gfd, std::set<vertex_t> const& core,
-           std::vector<std::set<vertex_t>> const& forest,
-           std::map<vertex_t, vertex_t> const& parent, std::set<edge_t> const& nte) {
-    graph_t query = gfd.GetPattern();
-    std::vector<std::vector<vertex_t>> paths = GetPaths(core, parent);
-
-    std::vector<vertex_t> nts = {};
-    FullNTs(paths, nte, query, nts);
-    std::vector<vertex_t> seq = MatchingOrder(cpi, paths, nts);
-
-    CompleteSeq(cpi, forest, parent, query, nte, seq);
-
-    std::set<vertex_t> root_candidates = {};
-    std::pair<vertex_t, vertex_t> edge(*seq.begin(), *(++seq.begin()));
-    for (auto& vertices : cpi.at(edge)) {
-        root_candidates.insert(vertices.first);
-    }
-
-    std::vector<std::pair<std::set<vertex_t>::iterator, std::set<vertex_t>::iterator>> match = {};
+/* Checks the embeddings mapping the first vertex of seq to root, stops early if stop is set by
+ * another root. Returns false if an embedding violates the GFD. */
+bool CheckRoot(CPI const& cpi, CompactGraph const& graph, CompactGfd const& gfd,
+               std::set<vertex_t> const& core, std::vector<std::set<vertex_t>> const& forest,
+               std::map<vertex_t, vertex_t> const& parent, std::vector<vertex_t> const& seq,
+               vertex_t root, int& amount, std::atomic<bool> const& stop) {
+    CompactGraph const& query = gfd.pattern;
+    std::set<vertex_t> const root_candidates = {root};
+    // vertices after the first one are not matched yet, their candidates are taken on the way
+    Match match(seq.size(), {root_candidates.end(), root_candidates.end()});
+    match[0] = {root_candidates.begin(), root_candidates.end()};
 
-    if (FullMatch(cpi, match, root_candidates, core, seq, parent, graph, query)) {
-        return true;
-    }
-    int amount = 1;
-    // check
-    if (Satisfied(graph, query, seq, match, gfd.GetPremises()) &&
-        !Satisfied(graph, query, seq, match, gfd.GetConclusion())) {
-        LOG(DEBUG) << "Checked embeddings: " << amount;
-        return false;
-    }
-
-    while (true) {
-        int i = static_cast<int>(core.size()) - 1;
+    for (int i = 1; !stop.load(std::memory_order_relaxed); i = static_cast<int>(core.size()) - 1) {
         IncrementMatch(i, cpi, match, parent, core, seq, graph, query);
         if (i == -1) {
             break;
@@ -968,43 +787,65 @@ bool Check(CPI& cpi, graph_t const& graph, Gfd const& gfd, std::set<vertex_t> co
         if (forest.empty()) {
             amount++;
             // check
-            if (!Satisfied(graph, query, seq, match, gfd.GetPremises())) {
-                continue;
-            }
-            if (!Satisfied(graph, query, seq, match, gfd.GetConclusion())) {
-                LOG(DEBUG) << "Checked embeddings: " << amount;
+            if (Satisfied(graph, seq, match, gfd.premises) &&
+                !Satisfied(graph, seq, match, gfd.conclusion)) {
                 return false;
             }
             continue;
         }
 
-        if (CheckTrivially(cpi, match, parent, core, seq)) {
-            return true;
-        }
-
-        if (!CheckMatch(cpi, match, parent, core, seq, graph, query, gfd, amount)) {
+        if (!CheckMatch(cpi, match, parent, core, seq, graph, gfd, amount, stop)) {
             return false;
         }
     }
-    LOG(DEBUG) << "total number of embeddings: " << amount;
     return true;
 }
 
-bool Validate(graph_t const& graph, Gfd const& gfd) {
-    auto start_time = std::chrono::system_clock::now();
+bool Check(CPI const& cpi, CompactGraph const& graph, CompactGfd const& gfd,
+           std::set<vertex_t> const& core, std::vector<std::set<vertex_t>> const& forest,
+           std::map<vertex_t, vertex_t> const& parent, std::set<PatternEdge> const& nte,
+           config::ThreadNumType threads_num) {
+    std::vector<std::vector<vertex_t>> paths = GetPaths(core, parent);
+
+    std::vector<vertex_t> nts = {};
+    FullNTs(paths, nte, nts);
+    std::vector<vertex_t> seq = MatchingOrder(cpi, paths, nts);
+
+    CompleteSeq(cpi, forest, parent, nte, seq);
 
-    graph_t pat = gfd.GetPattern();
-    std::set<std::string> graph_labels = {};
-    std::set<std::string> pat_labels = {};
-    typename boost::graph_traits<graph_t>::vertex_iterator it, end;
-    for (boost::tie(it, end) = vertices(graph); it != end; ++it) {
-        graph_labels.insert(graph[*it].attributes.at("label"));
+    std::vector<vertex_t> roots = {};
+    auto edge_it = cpi.find({*seq.begin(), *(++seq.begin())});
+    if (edge_it == cpi.end()) {
+        return true;
     }
-    for (boost::tie(it, end) = vertices(pat); it != end; ++it) {
-        pat_labels.insert(pat[*it].attributes.at("label"));
+    for (auto& vertices : edge_it->second) {
+        roots.push_back(vertices.first);
     }
-    for (auto const& label : pat_labels) {
-        if (graph_labels.find(label) == graph_labels.end()) {
+
+    // embeddings with different roots are enumerated independently
+    std::atomic<bool> violated = false;
+    std::atomic<int> total_amount = 0;
+    ForEachIndex(roots.size(), threads_num, [&](size_t i) {
+        if (violated.load(std::memory_order_relaxed)) {
+            return;
+        }
+        int amount = 0;
+        if (!CheckRoot(cpi, graph, gfd, core, forest, parent, seq, roots[i], amount, violated)) {
+            violated.store(true, std::memory_order_relaxed);
+        }
+        total_amount += amount;
+    });
+    LOG(DEBUG) << "Checked embeddings: " << total_amount;
+    return !violated;
+}
+
+bool Validate(CompactGraph const& graph, Gfd const& gfd, config::ThreadNumType threads_num) {
+    auto start_time = std::chrono::system_clock::now();
+
+    CompactGfd const compact_gfd(gfd, graph);
+    CompactGraph const& pat = compact_gfd.pattern;
+    for (vertex_t u = 0; u < pat.NumVertices(); ++u) {
+        if (graph.GetVerticesWithLabel(pat.GetLabel(u)).empty()) {
             return true;
         }
     }
@@ -1013,32 +854,37 @@ bool Validate(graph_t const& graph, Gfd const& gfd) {
     std::vector<std::set<vertex_t>> forest = {};
     CfDecompose(pat, core, forest);
 
-    int root = GetRoot(graph, pat, core);
+    int root = GetRoot(graph, pat, core, threads_num);
     std::vector<std::set<vertex_t>> levels = {};
     std::map<vertex_t, vertex_t> parent;
-    std::set<edge_t> snte = {};
-    std::set<edge_t> nte = {};
+    std::set<PatternEdge> snte = {};
+    std::set<PatternEdge> nte = {};
     BfsTree(pat, root, levels, parent, nte, snte);
 
     std::map<vertex_t, std::set<vertex_t>> candidates;
     CPI cpi;
-    TopDownConstruct(cpi, graph, pat, levels, parent, candidates, snte);
+    TopDownConstruct(cpi, graph, pat, levels, parent, candidates, snte, threads_num);
     BottomUpRefinement(cpi, graph, pat, levels, parent, candidates);
     auto elapsed_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now() - start_time);
 
     LOG(DEBUG) << "CPI constructed in " << elapsed_milliseconds.count() << ". Matching...";
-    return Check(cpi, graph, gfd, core, forest, parent, nte);
+    return Check(cpi, graph, compact_gfd, core, forest, parent, nte, threads_num);
 }
 
 }  // namespace
 
 namespace algos {
 
-std::vector<Gfd> EGfdValidation::GenerateSatisfiedGfds(graph_t const& graph,
+EGfdValidation::EGfdValidation() : GfdHandler() {
+    RegisterOption(config::kThreadNumberOpt(&threads_num_));
+    MakeOptionsAvailable({config::kThreadNumberOpt.GetName()});
+};
+
+std::vector<Gfd> EGfdValidation::GenerateSatisfiedGfds(CompactGraph const& graph,
                                                        std::vector<Gfd> const& gfds) {
     for (auto& gfd : gfds) {
-        if (Validate(graph, gfd)) {
+        if (Validate(graph, gfd, threads_num_)) {
             result_.push_back(gfd);
         }
     }
@@ -1,6 +1,12 @@
 #pragma once
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
 #include "algorithms/gfd/gfd_handler.h"
 #include "config/names_and_descriptions.h"
+#include "config/thread_number/type.h"
 #include "gfd.h"
 
 namespace algos {
@@ -8,10 +14,14 @@ namespace algos {
 using CPI = std::map<std::pair<vertex_t, vertex_t>, std::map<vertex_t, std::set<vertex_t>>>;
 
 class EGfdValidation : public GfdHandler {
+private:
+    config::ThreadNumType threads_num_ = 1;
+
 public:
-    std::vector<Gfd> GenerateSatisfiedGfds(graph_t const& graph, std::vector<Gfd> const& gfds);
+    std::vector<Gfd> GenerateSatisfiedGfds(CompactGraph const& graph,
+                                           std::vector<Gfd> const& gfds);
 
-    EGfdValidation() : GfdHandler(){};
+    EGfdValidation();
 
     EGfdValidation(graph_t graph_, std::vector<Gfd> gfds_) : GfdHandler(graph_, gfds_) {}
 };
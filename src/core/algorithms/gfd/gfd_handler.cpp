@@ -35,7 +35,7 @@ void GfdHandler::RegisterOptions() {
 
 void GfdHandler::LoadDataInternal() {
     std::ifstream f(graph_path_);
-    graph_ = parser::graph_parser::ReadGraph(f);
+    graph_ = CompactGraph(parser::graph_parser::ReadGraph(f));
     f.close();
     for (auto const& path : gfd_paths_) {
         auto gfd_path = path;
@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "algorithms/algorithm.h"
+#include "compact_graph.h"
 #include "config/names_and_descriptions.h"
 #include "gfd.h"
 #include "parser/graph_parser/graph_parser.h"
@@ -13,7 +14,7 @@ protected:
     std::filesystem::path graph_path_;
     std::vector<std::filesystem::path> gfd_paths_;
 
-    graph_t graph_;
+    CompactGraph graph_;
     std::vector<Gfd> gfds_;
     std::vector<Gfd> result_;
 
@@ -25,7 +26,7 @@ protected:
     void RegisterOptions();
 
 public:
-    virtual std::vector<Gfd> GenerateSatisfiedGfds(graph_t const& graph,
+    virtual std::vector<Gfd> GenerateSatisfiedGfds(CompactGraph const& graph,
                                                    std::vector<Gfd> const& gfds) = 0;
 
     GfdHandler();
@@ -2,20 +2,23 @@
 
 #include <iostream>
 #include <set>
+#include <span>
 #include <thread>
+#include <utility>
 
 #include <boost/graph/eccentricity.hpp>
 #include <boost/graph/exterior_property.hpp>
 #include <boost/graph/floyd_warshall_shortest.hpp>
-#include <boost/graph/vf2_sub_graph_iso.hpp>
 #include <easylogging++.h>
 
 #include "balancer.h"
+#include "compact_graph.h"
 #include "config/equal_nulls/option.h"
 #include "config/names_and_descriptions.h"
 #include "config/option_using.h"
 #include "config/tabular_data/input_table/option.h"
 #include "config/thread_number/option.h"
+#include "subgraph_matcher.h"
 
 namespace {
 
@@ -48,18 +51,6 @@ std::vector<std::vector<vertex_t>> GetPartition(std::vector<vertex_t> const& can
     return result;
 }
 
-std::vector<vertex_t> GetCandidates(graph_t const& graph, std::string const& label) {
-    std::vector<vertex_t> result = {};
-
-    BGL_FORALL_VERTICES_T(v, graph, graph_t) {
-        if (graph[v].attributes.at("label") == label) {
-            result.push_back(v);
-        }
-    }
-
-    return result;
-}
-
 vertex_t GetCenter(graph_t const& pattern, int& radius) {
     using DistanceProperty = boost::exterior_vertex_property<graph_t, int>;
     using DistanceMatrix = typename DistanceProperty::matrix_type;
@@ -102,7 +93,7 @@ vertex_t GetCenter(graph_t const& pattern, int& radius) {
     return result;
 }
 
-void CalculateMessages(graph_t const& graph, std::vector<Request> const& requests,
+void CalculateMessages(CompactGraph const& graph, std::vector<Request> const& requests,
                        std::map<int, std::vector<Message>>& weighted_messages) {
     for (Request const& request : requests) {
         int gfd_index = std::get<0>(request);
@@ -111,137 +102,38 @@ void CalculateMessages(graph_t const& graph, std::vector<Request> const& request
         std::vector<vertex_t> candidates = std::get<3>(request);
         for (vertex_t const& candidate : candidates) {
             std::set<vertex_t> vertices = {candidate};
-            std::set<vertex_t> current = {candidate};
+            std::vector<vertex_t> current = {candidate};
             for (int i = 0; i < radius; ++i) {
-                std::set<vertex_t> temp = {};
-                for (auto& v : current) {
-                    typename boost::graph_traits<graph_t>::adjacency_iterator adjacency_it,
-                            adjacency_end;
-                    boost::tie(adjacency_it, adjacency_end) = boost::adjacent_vertices(v, graph);
-                    for (; adjacency_it != adjacency_end; ++adjacency_it) {
-                        if (vertices.find(*adjacency_it) == vertices.end()) {
-                            vertices.insert(*adjacency_it);
-                            temp.insert(*adjacency_it);
+                std::vector<vertex_t> temp = {};
+                for (vertex_t v : current) {
+                    for (CompactGraph::VertexId u : graph.Neighbours(v)) {
+                        if (vertices.insert(u).second) {
+                            temp.push_back(u);
                         }
                     }
                 }
-                current = temp;
+                current = std::move(temp);
             }
+            // every pair of adjacent vertices of the ball is counted once in both orders
             int weight = vertices.size();
-            for (auto& v : vertices) {
-                for (auto& u : vertices) {
-                    if (boost::edge(v, u, graph).second) {
+            for (vertex_t v : vertices) {
+                std::span<CompactGraph::VertexId const> neighbours = graph.Neighbours(v);
+                for (size_t j = 0; j < neighbours.size(); ++j) {
+                    if ((j == 0 || neighbours[j] != neighbours[j - 1]) &&
+                        vertices.find(neighbours[j]) != vertices.end()) {
                         weight++;
                     }
                 }
             }
             Message message(gfd_index, center, candidate);
-            if (weighted_messages.find(weight) != weighted_messages.end()) {
-                weighted_messages.at(weight).push_back(message);
-            } else {
-                std::vector<Message> current = {message};
-                weighted_messages.emplace(weight, current);
-            }
+            weighted_messages[weight].push_back(message);
         }
     }
 }
 
-class CheckCallback {
-private:
-    graph_t const& query_;
-    graph_t const& graph_;
-    std::vector<Literal> const premises_;
-    std::vector<Literal> const conclusion_;
-    bool& res_;
-
-public:
-    CheckCallback(graph_t const& query_, graph_t const& graph_,
-                  std::vector<Literal> const& premises_, std::vector<Literal> const& conclusion_,
-                  bool& res_)
-        : query_(query_),
-          graph_(graph_),
-          premises_(premises_),
-          conclusion_(conclusion_),
-          res_(res_) {}
-
-    template <typename CorrespondenceMap1To2, typename CorrespondenceMap2To1>
-    bool operator()(CorrespondenceMap1To2 f, CorrespondenceMap2To1) const {
-        auto satisfied = [this, &f](std::vector<Literal> const literals) {
-            for (const Literal& l : literals) {
-                auto fst_token = l.first;
-                auto snd_token = l.second;
-                std::string fst;
-                std::string snd;
-                if (fst_token.first == -1) {
-                    fst = fst_token.second;
-                } else {
-                    vertex_t v;
-                    vertex_t u = boost::vertex(fst_token.first, query_);
-                    v = get(f, u);
-                    auto attrs = graph_[v].attributes;
-                    if (attrs.find(fst_token.second) == attrs.end()) {
-                        return false;
-                    }
-                    fst = attrs.at(fst_token.second);
-                }
-                if (snd_token.first == -1) {
-                    snd = snd_token.second;
-                } else {
-                    vertex_t v;
-                    vertex_t u = boost::vertex(snd_token.first, query_);
-                    v = get(f, u);
-                    auto attrs = graph_[v].attributes;
-                    if (attrs.find(snd_token.second) == attrs.end()) {
-                        return false;
-                    }
-                    snd = attrs.at(snd_token.second);
-                }
-                if (fst != snd) {
-                    return false;
-                }
-            }
-            return true;
-        };
-
-        if (!satisfied(premises_)) {
-            return true;
-        }
-        if (!satisfied(conclusion_)) {
-            res_ = false;
-            return false;
-        }
-        return true;
-    }
-};
-
-struct VCompare {
-    graph_t const& pattern;
-    graph_t const& graph;
-    vertex_t pinted_fr;
-    vertex_t pinted_to;
-
-    bool operator()(vertex_t fr, vertex_t to) const {
-        if (fr == pinted_fr && to == pinted_to) {
-            return true;
-        }
-        if (fr == pinted_fr || to == pinted_to) {
-            return false;
-        }
-        return pattern[fr].attributes.at("label") == graph[to].attributes.at("label");
-    }
-};
-
-struct ECompare {
-    graph_t const& pattern;
-    graph_t const& graph;
-
-    bool operator()(edge_t fr, edge_t to) const {
-        return pattern[fr].label == graph[to].label;
-    }
-};
-
-void CalculateUnsatisfied(graph_t const& graph, std::vector<Message> const& messages,
-                          std::map<int, Gfd> const& indexed_gfds, std::set<int>& unsatisfied) {
+void CalculateUnsatisfied(CompactGraph const& graph, std::vector<Message> const& messages,
+                          std::vector<CompactGfd> const& compact_gfds,
+                          std::set<int>& unsatisfied) {
     for (auto& message : messages) {
         int gfd_index = std::get<0>(message);
         if (unsatisfied.find(gfd_index) != unsatisfied.end()) {
@@ -251,18 +143,21 @@ void CalculateUnsatisfied(graph_t const& graph, std::vector<Message> const& mess
         vertex_t u = std::get<1>(message);
         vertex_t v = std::get<2>(message);
 
-        Gfd gfd = indexed_gfds.at(gfd_index);
-        graph_t pattern = gfd.GetPattern();
-
-        VCompare vcompare{pattern, graph, u, v};
-        ECompare ecompare{pattern, graph};
-
+        CompactGfd const& gfd = compact_gfds.at(gfd_index);
         bool satisfied = true;
-        CheckCallback callback(pattern, graph, gfd.GetPremises(), gfd.GetConclusion(), satisfied);
+        auto callback = [&graph, &gfd, &satisfied](Embedding const& embedding) {
+            auto get_vertex = [&embedding](int w) { return embedding[w]; };
+            if (!gfd.premises.Hold(graph, get_vertex)) {
+                return true;
+            }
+            if (!gfd.conclusion.Hold(graph, get_vertex)) {
+                satisfied = false;
+                return false;
+            }
+            return true;
+        };
 
-        boost::vf2_subgraph_iso(pattern, graph, callback, get(boost::vertex_index, pattern),
-                                get(boost::vertex_index, graph), vertex_order_by_mult(pattern),
-                                ecompare, vcompare);
+        EnumerateEmbeddings(gfd.pattern, graph, callback, std::make_pair(u, v));
         if (!satisfied) {
             unsatisfied.insert(gfd_index);
         }
@@ -278,7 +173,7 @@ GfdValidation::GfdValidation() : GfdHandler() {
     MakeOptionsAvailable({config::kThreadNumberOpt.GetName()});
 };
 
-std::vector<Gfd> GfdValidation::GenerateSatisfiedGfds(graph_t const& graph,
+std::vector<Gfd> GfdValidation::GenerateSatisfiedGfds(CompactGraph const& graph,
                                                       std::vector<Gfd> const& gfds) {
     std::vector<std::vector<Request>> requests = {};
     for (int i = 0; i < threads_num_; ++i) {
@@ -287,12 +182,15 @@ std::vector<Gfd> GfdValidation::GenerateSatisfiedGfds(graph_t const& graph,
     }
 
     std::map<int, Gfd> indexed_gfds;
+    std::vector<CompactGfd> compact_gfds;
     int index = 0;
     for (auto& gfd : gfds) {
         int radius = 0;
         vertex_t center = GetCenter(gfd.GetPattern(), radius);
-        std::vector<vertex_t> candidates =
-                GetCandidates(graph, gfd.GetPattern()[center].attributes.at("label"));
+        CompactGfd const& compact_gfd = compact_gfds.emplace_back(gfd, graph);
+        std::span<CompactGraph::VertexId const> labelled =
+                graph.GetVerticesWithLabel(compact_gfd.pattern.GetLabel(center));
+        std::vector<vertex_t> candidates(labelled.begin(), labelled.end());
         auto partition = GetPartition(candidates, threads_num_);
         for (std::size_t i = 0; i < partition.size(); ++i) {
             if (!partition.at(i).empty()) {
@@ -322,18 +220,17 @@ std::vector<Gfd> GfdValidation::GenerateSatisfiedGfds(graph_t const& graph,
         }
     }
 
+    // every message is balanced, several messages may have the same weight
     std::map<int, std::vector<Message>> all_weighted_messages;
+    std::vector<int> weights = {};
     for (int i = 0; i < threads_num_; ++i) {
-        for (auto& kv : weighted_messages.at(i)) {
-            all_weighted_messages.emplace(kv.first, kv.second);
+        for (auto& [weight, messages] : weighted_messages.at(i)) {
+            std::vector<Message>& all_messages = all_weighted_messages[weight];
+            all_messages.insert(all_messages.end(), messages.begin(), messages.end());
+            weights.insert(weights.end(), messages.size(), weight);
         }
     }
 
-    std::vector<int> weights = {};
-    for (auto& kv : all_weighted_messages) {
-        weights.push_back(kv.first);
-    }
-
     // balance
     Balancer balancer;
     std::vector<std::vector<int>> balanced_weights = balancer.Balance(weights, threads_num_);
@@ -341,9 +238,9 @@ std::vector<Gfd> GfdValidation::GenerateSatisfiedGfds(graph_t const& graph,
     for (std::size_t i = 0; i < balanced_weights.size(); ++i) {
         std::vector<Message> messages = {};
         for (int const& weight : balanced_weights.at(i)) {
-            Message message = *all_weighted_messages.at(weight).begin();
-            all_weighted_messages.at(weight).erase(all_weighted_messages.at(weight).begin());
-            messages.push_back(message);
+            std::vector<Message>& weight_messages = all_weighted_messages.at(weight);
+            messages.push_back(weight_messages.back());
+            weight_messages.pop_back();
         }
         balanced_messages.push_back(messages);
     }
@@ -360,7 +257,7 @@ std::vector<Gfd> GfdValidation::GenerateSatisfiedGfds(graph_t const& graph,
     threads.clear();
     for (int i = 0; i < threads_num_; ++i) {
         std::thread thrd(CalculateUnsatisfied, std::cref(graph), std::cref(balanced_messages.at(i)),
-                         std::cref(indexed_gfds), std::ref(unsatisfied.at(i)));
+                         std::cref(compact_gfds), std::ref(unsatisfied.at(i)));
         threads.push_back(std::move(thrd));
     }
     for (std::thread& thrd : threads) {
@@ -17,7 +17,8 @@ private:
     config::ThreadNumType threads_num_;
 
 public:
-    std::vector<Gfd> GenerateSatisfiedGfds(graph_t const& graph, std::vector<Gfd> const& gfds);
+    std::vector<Gfd> GenerateSatisfiedGfds(CompactGraph const& graph,
+                                           std::vector<Gfd> const& gfds);
 
     GfdValidation();
 
@@ -9,7 +9,8 @@ namespace algos {
 
 class NaiveGfdValidation : public GfdHandler {
 public:
-    std::vector<Gfd> GenerateSatisfiedGfds(graph_t const& graph, std::vector<Gfd> const& gfds);
+    std::vector<Gfd> GenerateSatisfiedGfds(CompactGraph const& graph,
+                                           std::vector<Gfd> const& gfds);
 
     NaiveGfdValidation() : GfdHandler(){};
 
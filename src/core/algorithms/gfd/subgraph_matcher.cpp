@@ -0,0 +1,154 @@
+#include "subgraph_matcher.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+using VertexId = CompactGraph::VertexId;
+
+constexpr size_t kNoAnchor = std::numeric_limits<size_t>::max();
+
+class Matcher {
+private:
+    CompactGraph const& pattern_;
+    CompactGraph const& graph_;
+    EmbeddingCallback const& callback_;
+    std::optional<std::pair<VertexId, VertexId>> pinned_;
+
+    /* pattern vertices in the order they are matched */
+    std::vector<VertexId> order_;
+    /* matched pattern neighbour of every vertex of the order, kNoAnchor for the first vertex of a
+     * component */
+    std::vector<size_t> anchors_;
+    Embedding embedding_;
+    bool found_ = false;
+
+    size_t NumLabelled(VertexId u) const {
+        return graph_.GetVerticesWithLabel(pattern_.GetLabel(u)).size();
+    }
+
+    void MakeOrder();
+    bool IsFeasible(size_t position, VertexId v) const;
+    bool TryCandidate(size_t position, VertexId v);
+    bool Extend(size_t position);
+
+public:
+    Matcher(CompactGraph const& pattern, CompactGraph const& graph,
+            EmbeddingCallback const& callback,
+            std::optional<std::pair<VertexId, VertexId>> pinned)
+        : pattern_(pattern),
+          graph_(graph),
+          callback_(callback),
+          pinned_(pinned),
+          embedding_(pattern.NumVertices()) {
+        MakeOrder();
+    }
+
+    bool Run() {
+        if (pattern_.NumVertices() != 0) {
+            Extend(0);
+        }
+        return found_;
+    }
+};
+
+void Matcher::MakeOrder() {
+    // greedily take the vertex with the most matched neighbours, the rarest label starts a
+    // component
+    size_t const num_vertices = pattern_.NumVertices();
+    std::vector<size_t> matched_neighbours(num_vertices, 0);
+    std::vector<bool> ordered(num_vertices, false);
+    while (order_.size() < num_vertices) {
+        std::optional<VertexId> next;
+        for (VertexId u = 0; u < num_vertices; ++u) {
+            if (ordered[u] || matched_neighbours[u] == 0) continue;
+            if (!next || matched_neighbours[u] > matched_neighbours[*next]) next = u;
+        }
+        size_t anchor = kNoAnchor;
+        if (next) {
+            auto is_anchor = [this, &next](VertexId u) { return pattern_.HasEdge(u, *next); };
+            anchor = std::find_if(order_.begin(), order_.end(), is_anchor) - order_.begin();
+        } else if (order_.empty() && pinned_) {
+            next = pinned_->first;
+        } else {
+            for (VertexId u = 0; u < num_vertices; ++u) {
+                if (ordered[u]) continue;
+                if (!next || NumLabelled(u) < NumLabelled(*next)) next = u;
+            }
+        }
+        order_.push_back(*next);
+        anchors_.push_back(anchor);
+        ordered[*next] = true;
+        for (VertexId w : pattern_.Neighbours(*next)) {
+            ++matched_neighbours[w];
+        }
+    }
+}
+
+bool Matcher::IsFeasible(size_t position, VertexId v) const {
+    VertexId const u = order_[position];
+    if (pinned_ && (u == pinned_->first) != (v == pinned_->second)) {
+        return false;
+    }
+    if (graph_.GetLabel(v) != pattern_.GetLabel(u)) {
+        return false;
+    }
+    for (size_t i = 0; i <= position; ++i) {
+        VertexId const matched_u = order_[i];
+        VertexId const matched_v = i == position ? v : embedding_[matched_u];
+        if (i != position && matched_v == v) {
+            return false;
+        }
+        std::span<CompactGraph::StringId const> labels = pattern_.GetEdgeLabels(u, matched_u);
+        if (labels.empty()) {
+            if (graph_.HasEdge(v, matched_v)) return false;
+            continue;
+        }
+        for (CompactGraph::StringId label : labels) {
+            if (!graph_.HasEdge(v, matched_v, label)) return false;
+        }
+    }
+    return true;
+}
+
+bool Matcher::TryCandidate(size_t position, VertexId v) {
+    if (!IsFeasible(position, v)) {
+        return true;
+    }
+    embedding_[order_[position]] = v;
+    return Extend(position + 1);
+}
+
+bool Matcher::Extend(size_t position) {
+    if (position == order_.size()) {
+        found_ = true;
+        return callback_(embedding_);
+    }
+    VertexId const u = order_[position];
+    if (pinned_ && u == pinned_->first) {
+        return TryCandidate(position, pinned_->second);
+    }
+    if (anchors_[position] == kNoAnchor) {
+        for (VertexId v : graph_.GetVerticesWithLabel(pattern_.GetLabel(u))) {
+            if (!TryCandidate(position, v)) return false;
+        }
+        return true;
+    }
+    std::span<VertexId const> neighbours =
+            graph_.Neighbours(embedding_[order_[anchors_[position]]]);
+    for (size_t i = 0; i < neighbours.size(); ++i) {
+        // parallel edges give the same candidate several times
+        if (i != 0 && neighbours[i] == neighbours[i - 1]) continue;
+        if (!TryCandidate(position, neighbours[i])) return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+bool EnumerateEmbeddings(CompactGraph const& pattern, CompactGraph const& graph,
+                         EmbeddingCallback const& callback,
+                         std::optional<std::pair<VertexId, VertexId>> pinned) {
+    return Matcher(pattern, graph, callback, pinned).Run();
+}
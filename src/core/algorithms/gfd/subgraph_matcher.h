@@ -0,0 +1,23 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "compact_graph.h"
+
+/* Maps every vertex of the pattern to a vertex of the graph */
+using Embedding = std::vector<CompactGraph::VertexId>;
+/* Returns false to stop the enumeration */
+using EmbeddingCallback = std::function<bool(Embedding const&)>;
+
+/* Calls callback for every induced subgraph isomorphism from pattern to graph, like
+ * boost::vf2_subgraph_iso: matched vertices and edges have equal labels and matched vertices are
+ * adjacent in the graph iff they are adjacent in the pattern. If pinned is set, its pattern vertex
+ * is mapped only to its graph vertex. Pattern vertices are matched one by one, every vertex after
+ * the first one of its component among the neighbours of an already matched vertex. Returns true
+ * if at least one embedding was found. */
+bool EnumerateEmbeddings(
+        CompactGraph const& pattern, CompactGraph const& graph, EmbeddingCallback const& callback,
+        std::optional<std::pair<CompactGraph::VertexId, CompactGraph::VertexId>> pinned = {});
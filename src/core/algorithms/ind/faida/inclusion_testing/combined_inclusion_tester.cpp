@@ -140,19 +140,21 @@ void CombinedInclusionTester::InsertRows(IRowIterator::Block const& hashed_cols,
 #endif
                 }
 
+                /* Rows that do not contain null values and are not found in the inverted index
+                 * (cc is not covered) are inserted into hll, all at once. Their hashes are
+                 * compacted to the beginning of combined_hashes
+                 */
+                size_t num_uncovered = 0;
                 for (unsigned int i = 0; i < chunk_size; i++) {
                     size_t const combined_hash = combined_hashes[i];
                     bool const has_null = nul_combs[i];
-                    if (!has_null) {
-                        if (!sampled_inverted_index_.Update(*cc, combined_hash)) {
-                            /* Row is not found in the inverted index (cc is not covered)
-                             * so we insert cc into hll if row does not contain null value
-                             * and is not covered by inv_index
-                             */
-                            InsertRowIntoHLL(combined_hash, hll_data);
-                        }
+                    if (!has_null && !sampled_inverted_index_.Update(*cc, combined_hash)) {
+                        combined_hashes[num_uncovered++] = combined_hash;
                     }
                 }
+                if (num_uncovered != 0) {
+                    InsertRowsIntoHLL({combined_hashes.data(), num_uncovered}, hll_data);
+                }
             });
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <hash_table8.hpp>
+#include <span>
 
 #include "algorithms/ind/faida/preprocessing/preprocessor.h"
 #include "hll_data.h"
@@ -29,16 +30,16 @@ private:
 
     HLLData CreateApproxDataStructure() const {
         HLLData data;
-        data.SetHll(hll::HyperLogLog(CalcNumBits(error_)));
+        data.SetHll(PackedHLL(CalcNumBits(error_)));
         return data;
     }
 
-    void InsertRowIntoHLL(size_t row_hash, HLLData& data) const {
-        std::optional<hll::HyperLogLog>& hll = data.GetHll();
+    void InsertRowsIntoHLL(std::span<size_t const> row_hashes, HLLData& data) const {
+        std::optional<PackedHLL>& hll = data.GetHll();
         if (!hll.has_value()) {
-            data.SetHll(hll::HyperLogLog(CalcNumBits(error_)));
+            data.SetHll(PackedHLL(CalcNumBits(error_)));
         }
-        hll->add_hash(row_hash);
+        hll->AddHashes(row_hashes);
     }
 
     bool TestWithHLLs(HLLData const& dep_hll, HLLData const& ref_hll) const {
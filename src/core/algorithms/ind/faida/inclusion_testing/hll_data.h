@@ -2,26 +2,26 @@
 
 #include <optional>
 
-#include "hyperloglog.h"
+#include "packed_hll.h"
 
 namespace algos::faida {
 
 class HLLData {
 private:
-    std::optional<hll::HyperLogLog> hll_;
+    std::optional<PackedHLL> hll_;
 
 public:
     HLLData() : hll_(std::nullopt) {}
 
-    std::optional<hll::HyperLogLog>& GetHll() {
+    std::optional<PackedHLL>& GetHll() {
         return hll_;
     }
 
-    std::optional<hll::HyperLogLog> const& GetHll() const {
+    std::optional<PackedHLL> const& GetHll() const {
         return hll_;
     }
 
-    void SetHll(hll::HyperLogLog hll) {
+    void SetHll(PackedHLL hll) {
         hll_ = std::move(hll);
     }
 
@@ -31,7 +31,7 @@ public:
         } else if (!other.GetHll().has_value()) {
             return false;
         } else {
-            return hll_->is_included_in(other.GetHll().value());
+            return hll_->IsIncludedIn(other.GetHll().value());
         }
     }
 };
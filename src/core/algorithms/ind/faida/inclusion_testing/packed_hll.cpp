@@ -0,0 +1,140 @@
+#include "packed_hll.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace algos::faida {
+
+namespace {
+
+double CalcAlphaMM(uint32_t num_registers) {
+    double alpha;
+    switch (num_registers) {
+        case 16:
+            alpha = 0.673;
+            break;
+        case 32:
+            alpha = 0.697;
+            break;
+        case 64:
+            alpha = 0.709;
+            break;
+        default:
+            alpha = 0.7213 / (1.0 + 1.079 / num_registers);
+            break;
+    }
+    return alpha * num_registers * num_registers;
+}
+
+}  // namespace
+
+PackedHLL::PackedHLL(uint8_t num_bits) : num_bits_(num_bits) {
+    if (num_bits < 4 || 30 < num_bits) {
+        throw std::invalid_argument("HLL bit width must be in the range [4, 30], got " +
+                                    std::to_string(num_bits));
+    }
+    num_registers_ = uint32_t{1} << num_bits;
+    registers_.assign(CalcNumRegistersPadded(num_registers_), 0);
+}
+
+void PackedHLL::AddHashes(std::span<size_t const> hashes) noexcept {
+    // prefetching the register of a hash a few iterations ahead hides the cache misses on large
+    // sketches, where registers are accessed randomly
+    constexpr size_t kPrefetchDistance = 8;
+    size_t const shift = 8 * sizeof(size_t) - num_bits_;
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        if (i + kPrefetchDistance < hashes.size()) {
+            __builtin_prefetch(&registers_[hashes[i + kPrefetchDistance] >> shift], 1);
+        }
+        AddHash(hashes[i]);
+    }
+}
+
+void PackedHLL::Merge(PackedHLL const& other) {
+    if (num_registers_ != other.num_registers_) {
+        throw std::invalid_argument("Number of HLL registers doesn't match: " +
+                                    std::to_string(num_registers_) +
+                                    " != " + std::to_string(other.num_registers_));
+    }
+    uint8_t* registers = registers_.data();
+    uint8_t const* other_registers = other.registers_.data();
+#ifdef __AVX2__
+    for (size_t i = 0; i < registers_.size(); i += 32) {
+        __m256i const a = _mm256_load_si256(reinterpret_cast<__m256i const*>(registers + i));
+        __m256i const b = _mm256_load_si256(reinterpret_cast<__m256i const*>(other_registers + i));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(registers + i), _mm256_max_epu8(a, b));
+    }
+#elif defined(__SSE2__)
+    for (size_t i = 0; i < registers_.size(); i += 16) {
+        __m128i const a = _mm_load_si128(reinterpret_cast<__m128i const*>(registers + i));
+        __m128i const b = _mm_load_si128(reinterpret_cast<__m128i const*>(other_registers + i));
+        _mm_store_si128(reinterpret_cast<__m128i*>(registers + i), _mm_max_epu8(a, b));
+    }
+#else
+    for (size_t i = 0; i < registers_.size(); ++i) {
+        if (registers[i] < other_registers[i]) registers[i] = other_registers[i];
+    }
+#endif
+}
+
+bool PackedHLL::IsIncludedIn(PackedHLL const& other) const {
+    assert(num_registers_ == other.num_registers_);
+    uint8_t const* registers = registers_.data();
+    uint8_t const* other_registers = other.registers_.data();
+#ifdef __AVX2__
+    for (size_t i = 0; i < registers_.size(); i += 32) {
+        __m256i const a = _mm256_load_si256(reinterpret_cast<__m256i const*>(registers + i));
+        __m256i const b = _mm256_load_si256(reinterpret_cast<__m256i const*>(other_registers + i));
+        // a <= b iff max(a, b) == b
+        __m256i const not_greater = _mm256_cmpeq_epi8(_mm256_max_epu8(a, b), b);
+        if (_mm256_movemask_epi8(not_greater) != -1) return false;
+    }
+#elif defined(__SSE2__)
+    for (size_t i = 0; i < registers_.size(); i += 16) {
+        __m128i const a = _mm_load_si128(reinterpret_cast<__m128i const*>(registers + i));
+        __m128i const b = _mm_load_si128(reinterpret_cast<__m128i const*>(other_registers + i));
+        __m128i const not_greater = _mm_cmpeq_epi8(_mm_max_epu8(a, b), b);
+        if (_mm_movemask_epi8(not_greater) != 0xFFFF) return false;
+    }
+#else
+    for (size_t i = 0; i < registers_.size(); ++i) {
+        if (registers[i] > other_registers[i]) return false;
+    }
+#endif
+    return true;
+}
+
+double PackedHLL::Estimate() const {
+    // ranks never exceed 64 - num_bits + 1, so a histogram of register values replaces the
+    // per-register powers of two
+    std::array<uint32_t, 8 * sizeof(size_t) + 2> histogram{};
+    for (uint32_t i = 0; i < num_registers_; ++i) ++histogram[registers_[i]];
+
+    double sum = 0.0;
+    for (int rank = 0; rank < static_cast<int>(histogram.size()); ++rank) {
+        if (histogram[rank] != 0) sum += std::ldexp(static_cast<double>(histogram[rank]), -rank);
+    }
+    double estimate = CalcAlphaMM(num_registers_) / sum;
+
+    double constexpr kPow232 = 4294967296.0;
+    uint32_t const zeros = histogram[0];
+    if (estimate <= 2.5 * num_registers_) {
+        if (zeros != 0) {
+            estimate = num_registers_ * std::log(static_cast<double>(num_registers_) / zeros);
+        }
+    } else if (estimate > (1.0 / 30.0) * kPow232) {
+        estimate = -kPow232 * std::log(1.0 - (estimate / kPow232));
+    }
+    return estimate;
+}
+
+}  // namespace algos::faida
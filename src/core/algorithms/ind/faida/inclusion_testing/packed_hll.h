@@ -0,0 +1,60 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <boost/align/aligned_allocator.hpp>
+
+namespace algos::faida {
+
+/* HyperLogLog sketch with its registers packed into one aligned byte array. The array is padded
+ * to a whole number of vector registers, so merging, estimating and inclusion testing run over
+ * it with SIMD instructions. Hashes are expected to be 64-bit.
+ */
+class PackedHLL {
+private:
+    using Registers = std::vector<uint8_t, boost::alignment::aligned_allocator<uint8_t, 32>>;
+
+    /* Padding registers are always zero */
+    static constexpr size_t kRegistersAlignment = 32;
+
+    uint8_t num_bits_;
+    uint32_t num_registers_;
+    Registers registers_;
+
+    static size_t CalcNumRegistersPadded(uint32_t num_registers) {
+        return (num_registers + kRegistersAlignment - 1) / kRegistersAlignment *
+               kRegistersAlignment;
+    }
+
+public:
+    /* There are 2^num_bits registers, num_bits must be in the range [4, 30] */
+    explicit PackedHLL(uint8_t num_bits);
+
+    void AddHash(size_t hash) noexcept {
+        size_t const index = hash >> (8 * sizeof(size_t) - num_bits_);
+        uint8_t const rank =
+                std::countl_zero((hash << num_bits_) | ((size_t{1} << (num_bits_ - 1)) + 1)) + 1;
+        if (rank > registers_[index]) registers_[index] = rank;
+    }
+
+    void AddHashes(std::span<size_t const> hashes) noexcept;
+
+    /* Makes the sketch represent the union with other, the number of registers must match */
+    void Merge(PackedHLL const& other);
+
+    /* Whether every register is not greater than the corresponding register of other */
+    bool IsIncludedIn(PackedHLL const& other) const;
+
+    /* Estimated number of distinct hashes added */
+    double Estimate() const;
+
+    uint32_t GetNumRegisters() const noexcept {
+        return num_registers_;
+    }
+};
+
+}  // namespace algos::faida
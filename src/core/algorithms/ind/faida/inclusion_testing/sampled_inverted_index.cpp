@@ -3,13 +3,11 @@
 namespace algos::faida {
 
 void SampledInvertedIndex::Init(std::vector<size_t> const& sampled_hashes, int max_id) {
-    int constexpr initial_bucket_count = 4;
     for (size_t combined_hash : sampled_hashes) {
-        inverted_index_.try_emplace(combined_hash,
-                                    std::make_pair(emhash2::HashSet<int>(initial_bucket_count),
-                                                   std::make_unique<LockPrimitive>()));
+        inverted_index_.try_emplace(combined_hash, inverted_index_.size());
     }
     max_id_ = max_id;
+    buckets_by_cc_.assign(max_id, {});
 
     seen_cc_indices_ = boost::dynamic_bitset<>(max_id);
     non_covered_cc_indices_ = atomicbitvector::atomic_bv_t(max_id);
@@ -29,9 +27,16 @@ void SampledInvertedIndex::FinalizeInsertion(
         }
     }
 
-    for (auto const& [hash, record] : inverted_index_) {
-        emhash2::HashSet<int> const& cc_indices = record.first;
+    int constexpr initial_bucket_count = 4;
+    std::vector<emhash2::HashSet<int>> ccs_by_bucket(inverted_index_.size(),
+                                                     emhash2::HashSet<int>(initial_bucket_count));
+    for (int cc_index = 0; cc_index != static_cast<int>(buckets_by_cc_.size()); ++cc_index) {
+        for (BucketIndex bucket : buckets_by_cc_[cc_index]) {
+            ccs_by_bucket[bucket].insert(cc_index);
+        }
+    }
 
+    for (emhash2::HashSet<int> const& cc_indices : ccs_by_bucket) {
         for (int dep_cc_index : cc_indices) {
             seen_cc_indices_.set(dep_cc_index);
             auto ref_ccs_iter = ref_by_dep_ccs.find(dep_cc_index);
@@ -60,6 +65,7 @@ void SampledInvertedIndex::FinalizeInsertion(
     }
 
     inverted_index_.clear();
+    buckets_by_cc_.clear();
 
     for (auto const& [lhs_idx, rhss] : ref_by_dep_ccs) {
         for (int rhs_idx : rhss) {
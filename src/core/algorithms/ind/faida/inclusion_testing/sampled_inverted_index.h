@@ -3,8 +3,8 @@
 #include <atomic_bitvector.hpp>
 #include <hash_set2.hpp>
 #include <hash_table8.hpp>
-#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <boost/dynamic_bitset.hpp>
 
@@ -15,11 +15,13 @@ namespace algos::faida {
 
 class SampledInvertedIndex {
 private:
-    using LockPrimitive = std::mutex;
+    using BucketIndex = unsigned;
 
-    // Maps combined hash to the column combination IDs
-    emhash8::HashMap<size_t, std::pair<emhash2::HashSet<int>, std::unique_ptr<LockPrimitive>>>
-            inverted_index_;
+    // Maps combined hash to the index of its bucket
+    emhash8::HashMap<size_t, BucketIndex> inverted_index_;
+    // Buckets containing values of every column combination. A combination is updated by one
+    // thread at a time, so the index is filled without locking
+    std::vector<emhash2::HashSet<BucketIndex>> buckets_by_cc_;
 
     emhash2::HashSet<SimpleIND> discovered_inds_;
 
@@ -43,9 +45,7 @@ public:
             return false;
         }
 
-        auto& [set, lock_primitive] = set_iter->second;
-        std::lock_guard lock(*lock_primitive);
-        set.insert(combination.GetIndex());
+        buckets_by_cc_[combination.GetIndex()].insert(set_iter->second);
         return true;
     }
 
@@ -0,0 +1,38 @@
+/** \file
+ * \brief Mind algorithm
+ *
+ * Dictionary-encoded in-memory representation of the input tables.
+ */
+#include "encoded_tables.h"
+
+#include <string>
+#include <unordered_map>
+
+#include "model/table/dataset_stream_fixed.h"
+
+namespace algos::mind {
+
+EncodedTables EncodedTables::CreateFrom(config::InputTables const& input_tables) {
+    EncodedTables encoded;
+    std::unordered_map<std::string, ValueId> dictionary;
+    for (config::InputTable const& table : input_tables) {
+        table->Reset();
+        model::DatasetStreamFixed<> stream{table};
+        std::vector<Column> columns(stream.GetNumberOfColumns());
+        model::TupleIndex rows_num = 0;
+        while (stream.HasNextRow()) {
+            std::vector<std::string> row = stream.GetNextRow();
+            for (model::ColumnIndex i = 0; i != columns.size(); ++i) {
+                ValueId const next_id = dictionary.size();
+                auto const [it, inserted] = dictionary.try_emplace(std::move(row[i]), next_id);
+                columns[i].push_back(it->second);
+            }
+            ++rows_num;
+        }
+        encoded.tables_.push_back(std::move(columns));
+        encoded.rows_nums_.push_back(rows_num);
+    }
+    return encoded;
+}
+
+}  // namespace algos::mind
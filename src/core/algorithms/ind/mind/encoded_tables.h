@@ -0,0 +1,59 @@
+/** \file
+ * \brief Mind algorithm
+ *
+ * Dictionary-encoded in-memory representation of the input tables.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "model/table/column_combination.h"
+#include "model/table/tuple_index.h"
+#include "tabular_data/input_tables_type.h"
+
+namespace algos::mind {
+
+///
+/// \brief input tables stored column-wise with every value replaced by an integer identifier
+///
+/// \note Identifiers are shared by all tables: equal strings get the same identifier wherever
+///       they occur, so projections of different tables can be compared directly.
+///
+class EncodedTables {
+public:
+    using ValueId = std::uint32_t;
+    using Column = std::vector<ValueId>;
+    /// values of a column combination in one row
+    using Tuple = std::vector<ValueId>;
+
+private:
+    /* tables_[table][column][row] */
+    std::vector<std::vector<Column>> tables_;
+    std::vector<model::TupleIndex> rows_nums_;
+
+public:
+    EncodedTables() = default;
+
+    ///
+    /// \brief read every table once and encode its values
+    ///
+    /// \note Rows with an incorrect number of values are skipped.
+    ///
+    static EncodedTables CreateFrom(config::InputTables const& input_tables);
+
+    model::TupleIndex GetNumRows(model::TableIndex table) const {
+        return rows_nums_[table];
+    }
+
+    /// write the projection of the row onto the column combination into tuple
+    void FillTuple(model::ColumnCombination const& cc, model::TupleIndex row, Tuple& tuple) const {
+        std::vector<Column> const& columns = tables_[cc.GetTableIndex()];
+        tuple.clear();
+        for (model::ColumnIndex column : cc.GetColumnIndices()) {
+            tuple.push_back(columns[column][row]);
+        }
+    }
+};
+
+}  // namespace algos::mind
@@ -6,16 +6,21 @@
 #include "mind.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <list>
 #include <unordered_set>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/container_hash/hash.hpp>
+
 #include "algorithms/create_algorithm.h"
 #include "config/error/option.h"
 #include "config/names_and_descriptions.h"
-#include "dataset_stream_projection.h"
+#include "config/thread_number/option.h"
 #include "ind/ind_algorithm.h"
 #include "max_arity/option.h"
 #include "table/column_combination.h"
-#include "table/dataset_stream_fixed.h"
 #include "tabular_data/input_table_type.h"
 #include "util/timed_invoke.h"
 
@@ -26,6 +31,8 @@ Mind::Mind() : INDAlgorithm({}) {
 
     RegisterOption(config::kErrorOpt(&max_ind_error_));
     RegisterOption(config::kMaxArityOpt(&max_arity_));
+    RegisterOption(config::kThreadNumberOpt(&threads_num_));
+    MakeOptionsAvailable({config::kThreadNumberOpt.GetName()});
 }
 
 void Mind::MakeLoadOptsAvailable() {
@@ -51,6 +58,8 @@ bool Mind::SetExternalOption(std::string_view option_name, boost::any const& val
 
 void Mind::LoadINDAlgorithmDataInternal() {
     timings_.load = util::TimedInvoke(&Algorithm::LoadData, auind_algo_);
+    timings_.load += util::TimedInvoke(
+            [this]() { encoded_tables_ = mind::EncodedTables::CreateFrom(input_tables_); });
 }
 
 void Mind::AddSpecificNeededOptions(std::unordered_set<std::string_view>& previous_options) const {
@@ -134,54 +143,46 @@ std::optional<RawIND> GetCandidateIfValid(model::IND const& p, model::IND const&
     return candidate;
 }
 
-/*
- * Firstly, skip rows with incorrect count of values.
- * Secondly, project stream on the provided column indices.
- */
-using DatasetStreamFixedProjection = model::DatasetStreamProjection<model::DatasetStreamFixed<>>;
-
-using Row = DatasetStreamFixedProjection::Row;
-using HashSet = std::unordered_set<Row, boost::hash<Row>>;
-
-HashSet CreateHashSet(DatasetStreamFixedProjection&& stream) {
-    HashSet hash_container;
+using Tuple = EncodedTables::Tuple;
+using TupleSet = std::unordered_set<Tuple, boost::hash<Tuple>>;
 
-    while (stream.HasNextRow()) {
-        hash_container.insert(stream.GetNextRow());
+TupleSet CreateTupleSet(EncodedTables const& tables, model::ColumnCombination const& cc) {
+    TupleSet tuple_set;
+    Tuple tuple;
+    model::TupleIndex const rows_num = tables.GetNumRows(cc.GetTableIndex());
+    for (model::TupleIndex row = 0; row != rows_num; ++row) {
+        tables.FillTuple(cc, row, tuple);
+        tuple_set.insert(tuple);
     }
-
-    return hash_container;
+    return tuple_set;
 }
 
 }  // namespace
 }  // namespace mind
 
-bool Mind::TestCandidate(RawIND const& raw_ind) {
+bool Mind::TestCandidate(RawIND const& raw_ind) const {
     using namespace mind;
 
-    auto const create_projected_stream = [&](model::ColumnCombination const& cc) {
-        config::InputTable const& table = input_tables_[cc.GetTableIndex()];
-        table->Reset();
-        return DatasetStreamFixedProjection{table, cc.GetColumnIndices()};
-    };
-
-    HashSet const s_hash_set{CreateHashSet(create_projected_stream(raw_ind.rhs))};
+    TupleSet const s_tuple_set{CreateTupleSet(encoded_tables_, raw_ind.rhs)};
 
     if (max_ind_error_ == 0) {
-        DatasetStreamFixedProjection r_stream = create_projected_stream(raw_ind.lhs);
-        while (r_stream.HasNextRow()) {
-            if (!s_hash_set.contains(r_stream.GetNextRow())) return false;
+        Tuple tuple;
+        model::TupleIndex const r_rows_num =
+                encoded_tables_.GetNumRows(raw_ind.lhs.GetTableIndex());
+        for (model::TupleIndex row = 0; row != r_rows_num; ++row) {
+            encoded_tables_.FillTuple(raw_ind.lhs, row, tuple);
+            if (!s_tuple_set.contains(tuple)) return false;
         }
         return true;
     }
 
-    HashSet const r_hash_set{CreateHashSet(create_projected_stream(raw_ind.lhs))};
+    TupleSet const r_tuple_set{CreateTupleSet(encoded_tables_, raw_ind.lhs)};
 
-    auto const r_cardinality = static_cast<model::TupleIndex>(r_hash_set.size());
+    auto const r_cardinality = static_cast<model::TupleIndex>(r_tuple_set.size());
     model::TupleIndex const disqualify_row_limit = std::floor(r_cardinality * max_ind_error_) + 1;
     model::TupleIndex disqualify_row_count = 0;
-    for (Row const& row : r_hash_set) {
-        if (!s_hash_set.contains(row)) {
+    for (Tuple const& tuple : r_tuple_set) {
+        if (!s_tuple_set.contains(tuple)) {
             ++disqualify_row_count;
             if (disqualify_row_count == disqualify_row_limit) {
                 assert(static_cast<config::ErrorType>(disqualify_row_count) / r_cardinality >
@@ -195,6 +196,38 @@ bool Mind::TestCandidate(RawIND const& raw_ind) {
     return error <= max_ind_error_;
 }
 
+/*
+ * Test candidates of a lattice level, candidates are independent, so they are tested in parallel.
+ * Valid candidates are returned in the order they were generated.
+ */
+std::vector<Mind::RawIND> Mind::TestCandidates(std::vector<RawIND> candidates) const {
+    /* Not std::vector<bool>: its elements can't be written from different threads */
+    std::vector<std::uint8_t> is_valid(candidates.size());
+    auto const test = [this, &candidates, &is_valid](size_t i) {
+        is_valid[i] = TestCandidate(candidates[i]);
+    };
+
+    if (threads_num_ > 1) {
+        boost::asio::thread_pool pool(threads_num_);
+        for (size_t i = 0; i != candidates.size(); ++i) {
+            boost::asio::post(pool, [i, &test]() { test(i); });
+        }
+        pool.join();
+    } else {
+        for (size_t i = 0; i != candidates.size(); ++i) {
+            test(i);
+        }
+    }
+
+    std::vector<RawIND> valid_candidates;
+    for (size_t i = 0; i != candidates.size(); ++i) {
+        if (is_valid[i]) {
+            valid_candidates.push_back(std::move(candidates[i]));
+        }
+    }
+    return valid_candidates;
+}
+
 /*
  * Mine unary INDs.
  *
@@ -214,12 +247,17 @@ void Mind::MineNaryINDs() {
     /* Current lattice level candidates. */
     std::vector<RawIND> candidates;
     /*
-     * Iterator to the first element in the `INDList()` with previous level arity.
-     * It's guaranteed (at the start of the loop), that range [`prev_it`, `INDList().end()`)
-     * contains all elements with this arity, so we can avoid going through the entire `INDList()`
+     * Registered dependencies are appended to the list when `INDList()` is requested, so it is
+     * requested once per lattice level only.
+     */
+    std::list<IND> const& inds = INDList();
+    /*
+     * Iterator to the first element in the `inds` with previous level arity.
+     * It's guaranteed (at the start of the loop), that range [`prev_it`, `inds.end()`)
+     * contains all elements with this arity, so we can avoid going through the entire `inds`
      * with arity check.
      */
-    auto prev_it = INDList().begin();
+    auto prev_it = inds.begin();
     /*
      * Set of raw inds, that were found on the previous lattice level.
      * Note, that we do not populate this set for unary dependencies, since this
@@ -232,9 +270,9 @@ void Mind::MineNaryINDs() {
      * Stop INDs mining if no new dependencies were found at the previous lattice level
      * (from this condition it follows that no more dependencies can be found).
      */
-    while (prev_it != INDList().end() && INDList().back().GetArity() != max_arity_) {
-        for (auto p_it = prev_it; p_it != INDList().end(); ++p_it) {
-            std::for_each(std::next(p_it), INDList().end(), [&](const IND& q) {
+    while (prev_it != inds.end() && inds.back().GetArity() != max_arity_) {
+        for (auto p_it = prev_it; p_it != inds.end(); ++p_it) {
+            std::for_each(std::next(p_it), inds.end(), [&](const IND& q) {
                 std::optional<RawIND> candidate_opt =
                         mind::GetCandidateIfValid(*p_it, q, prev_raw_inds);
                 if (candidate_opt) {
@@ -243,17 +281,16 @@ void Mind::MineNaryINDs() {
             });
         }
 
-        prev_it = std::prev(INDList().end()); /*< last element of the previous lattice level */
+        prev_it = std::prev(inds.end()); /*< last element of the previous lattice level */
         prev_raw_inds.clear();
-        for (RawIND const& candidate : candidates) {
-            if (TestCandidate(candidate)) {
-                RegisterIND(candidate.lhs, candidate.rhs);
-                prev_raw_inds.insert(candidate);
-            }
+        for (RawIND& ind : TestCandidates(std::move(candidates))) {
+            RegisterIND(ind.lhs, ind.rhs);
+            prev_raw_inds.insert(std::move(ind));
         }
         candidates.clear();
 
-        ++prev_it; /*< first element of the current lattice level or `INDList().end()` */
+        INDList();  // appends the dependencies of the current lattice level to `inds`
+        ++prev_it;  /*< first element of the current lattice level or `inds.end()` */
     };
 }
 
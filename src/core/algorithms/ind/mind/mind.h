@@ -6,10 +6,13 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "algorithms/ind/ind_algorithm.h"
 #include "config/error/type.h"
 #include "config/max_arity/type.h"
+#include "config/thread_number/type.h"
+#include "encoded_tables.h"
 #include "raw_ind.h"
 
 namespace algos {
@@ -32,10 +35,12 @@ private:
     /* configuration stage fields */
     config::ErrorType max_ind_error_ = 0;
     config::MaxArityType max_arity_;
+    config::ThreadNumType threads_num_ = 1;
 
     /* execution stage fields */
     std::unique_ptr<INDAlgorithm> auind_algo_; /*< algorithm for mining unary approximate INDs*/
     StageTimings timings_{};                   /*< timings info */
+    mind::EncodedTables encoded_tables_;       /*< input tables to test n-ary candidates on */
 
     void MakeLoadOptsAvailable();
     void MakeExecuteOptsAvailable() override;
@@ -44,7 +49,8 @@ private:
     bool SetExternalOption(std::string_view option_name, boost::any const& value) override;
     void LoadINDAlgorithmDataInternal() override;
 
-    bool TestCandidate(RawIND const& raw_ind);
+    bool TestCandidate(RawIND const& raw_ind) const;
+    std::vector<RawIND> TestCandidates(std::vector<RawIND> candidates) const;
 
     void MineUnaryINDs();
     void MineNaryINDs();
@@ -5,8 +5,6 @@
  */
 #include "spider.h"
 
-#include <functional>
-#include <queue>
 #include <string>
 #include <type_traits>
 
@@ -61,24 +59,81 @@ std::vector<Attribute> InitAttributes(std::vector<model::ColumnDomain> const& do
     return attrs;
 }
 
+///
+/// \brief tournament tree over the attributes for the k-way merge of their values
+///
+/// Every inner node stores the index of the attribute with the smallest current value in its
+/// subtree, so replacing one attribute costs a single comparison per tree level.
+/// Deactivated attributes are treated as exhausted.
+///
+template <typename Attribute>
+class AttributeTournament {
+private:
+    std::vector<Attribute> const& attrs_;
+    std::vector<AttributeIndex> tree_; /* leaves are at [attrs_.size(), 2 * attrs_.size()) */
+    std::vector<bool> active_;
+
+    AttributeIndex Winner(AttributeIndex lhs, AttributeIndex rhs) const {
+        if (!active_[rhs]) return lhs;
+        if (!active_[lhs]) return rhs;
+        return attrs_[lhs] > attrs_[rhs] ? rhs : lhs;
+    }
+
+    void Update(AttributeIndex attr_id) {
+        for (size_t node = (attr_id + attrs_.size()) / 2; node != 0; node /= 2) {
+            tree_[node] = Winner(tree_[2 * node], tree_[2 * node + 1]);
+        }
+    }
+
+public:
+    explicit AttributeTournament(std::vector<Attribute> const& attrs)
+        : attrs_(attrs), tree_(2 * attrs.size()), active_(attrs.size(), true) {
+        if (attrs.empty()) return;
+        for (AttributeIndex attr_id = 0; attr_id != attrs.size(); ++attr_id) {
+            tree_[attrs.size() + attr_id] = attr_id;
+        }
+        for (size_t node = attrs.size() - 1; node != 0; --node) {
+            tree_[node] = Winner(tree_[2 * node], tree_[2 * node + 1]);
+        }
+    }
+
+    bool Empty() const {
+        return attrs_.empty() || !active_[Top()];
+    }
+
+    /// attribute with the smallest current value
+    AttributeIndex Top() const {
+        return tree_[1];
+    }
+
+    void Deactivate(AttributeIndex attr_id) {
+        active_[attr_id] = false;
+        Update(attr_id);
+    }
+
+    /// activate the attribute after its value has changed
+    void Activate(AttributeIndex attr_id) {
+        active_[attr_id] = true;
+        Update(attr_id);
+    }
+};
+
 template <typename Attribute>
 std::vector<Attribute> GetProcessedAttributes(std::vector<model::ColumnDomain> const& domains,
                                               config::EqNullsType is_null_equal_null) {
-    using AttributeRW = std::reference_wrapper<Attribute>;
     std::vector attrs = InitAttributes<Attribute>(domains);
-    std::priority_queue<AttributeRW, std::vector<AttributeRW>, std::greater<Attribute>> attr_pq(
-            attrs.begin(), attrs.end());
+    AttributeTournament<Attribute> tournament(attrs);
     boost::dynamic_bitset<> ids_bitset(attrs.size());
-    while (!attr_pq.empty()) {
-        AttributeRW attr_rw = attr_pq.top();
-        std::string const& value = attr_rw.get().GetCurrentValue();
+    while (!tournament.Empty()) {
+        AttributeIndex attr_id = tournament.Top();
+        std::string const& value = attrs[attr_id].GetCurrentValue();
         do {
-            attr_pq.pop();
-            ids_bitset.set(attr_rw.get().GetId());
-            if (attr_pq.empty()) break;
-            attr_rw = attr_pq.top();
+            tournament.Deactivate(attr_id);
+            ids_bitset.set(attr_id);
+            if (tournament.Empty()) break;
+            attr_id = tournament.Top();
             if (value.empty() && !is_null_equal_null) break;
-        } while (attr_rw.get().GetCurrentValue() == value);
+        } while (attrs[attr_id].GetCurrentValue() == value);
 
         auto ids_vec = util::BitsetToIndices<AttributeIndex>(ids_bitset);
         for (auto id : ids_vec) {
@@ -92,7 +147,7 @@ std::vector<Attribute> GetProcessedAttributes(std::vector<model::ColumnDomain> c
             Attribute& attr = attrs[id];
             if (!attr.HasFinished()) {
                 attr.MoveToNext();
-                attr_pq.emplace(attr);
+                tournament.Activate(id);
             }
         }
         ids_bitset.reset();
@@ -28,13 +28,13 @@ using CompareFunction = std::function<bool(std::vector<T> const& points)>;
 template <typename T>
 using HighlightFunction = std::function<void(std::vector<T> const& points,
                                              std::vector<Highlight>&& cluster_highlights)>;
-using ClusterFunction = std::function<bool(model::PLI::Cluster const& cluster)>;
+using ClusterFunction = std::function<bool(model::PLI::ClusterView cluster)>;
 template <typename T>
 using IndexedPointsFunction =
-        std::function<IndexedPointsCalculationResult<T>(model::PLI::Cluster const& cluster)>;
+        std::function<IndexedPointsCalculationResult<T>(model::PLI::ClusterView cluster)>;
 template <typename T>
 using PointsFunction =
-        std::function<PointsCalculationResult<T>(model::PLI::Cluster const& cluster)>;
+        std::function<PointsCalculationResult<T>(model::PLI::ClusterView cluster)>;
 template <typename T>
 using AssignmentFunction = std::function<void(long double, T&, size_t)>;
 
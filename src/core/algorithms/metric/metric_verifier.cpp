@@ -1,13 +1,19 @@
 #include "algorithms/metric/metric_verifier.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <exception>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <easylogging++.h>
 
 #include "config/equal_nulls/option.h"
@@ -16,6 +22,8 @@
 #include "config/names_and_descriptions.h"
 #include "config/option_using.h"
 #include "config/tabular_data/input_table/option.h"
+#include "config/thread_number/option.h"
+#include "util/levenshtein_distance.h"
 
 namespace algos::metric {
 
@@ -118,12 +126,14 @@ void MetricVerifier::RegisterOptions() {
                                                 {need_algo_only, {kMetricAlgorithm}}}));
     RegisterOption(Option{&metric_, kMetric, kDMetric}.SetConditionalOpts(
             {{{}, {config::kRhsIndicesOpt.GetName()}}}));
+    RegisterOption(config::kThreadNumberOpt(&threads_num_));
 }
 
 void MetricVerifier::MakeExecuteOptsAvailable() {
     using namespace config::names;
     MakeOptionsAvailable(
-            {kDistFromNullIsInfinity, kParameter, kMetric, config::kLhsIndicesOpt.GetName()});
+            {kDistFromNullIsInfinity, kParameter, kMetric, config::kLhsIndicesOpt.GetName(),
+             config::kThreadNumberOpt.GetName()});
 }
 
 void MetricVerifier::LoadDataInternal() {
@@ -230,14 +240,59 @@ void MetricVerifier::VerifyMetricFD() {
     }
 
     metric_fd_holds_ = true;
+    calculate_highlights_ = true;
     auto cluster_func = GetClusterFunction();
-    for (auto const& cluster : pli->GetIndex()) {
-        if (!cluster_func(cluster)) {
-            metric_fd_holds_ = false;
-            if (algo_ == +MetricAlgo::approx) {
-                break;
+    if (threads_num_ <= 1) {
+        for (auto const& cluster : pli->GetIndex()) {
+            if (!cluster_func(cluster)) {
+                metric_fd_holds_ = false;
+                if (algo_ == +MetricAlgo::approx) {
+                    break;
+                }
             }
         }
+        return;
+    }
+
+    // clusters are verified independently, the highlight calculator is not thread-safe, so the
+    // violating clusters are verified once more afterwards to keep the highlights in order
+    model::ClusterList const& clusters = pli->GetIndex();
+    std::vector<char> cluster_holds(clusters.size(), true);
+    std::atomic<bool> failed = false;
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    calculate_highlights_ = false;
+    boost::asio::thread_pool pool(threads_num_);
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        boost::asio::post(pool, [&, i]() {
+            if (algo_ == +MetricAlgo::approx && failed.load(std::memory_order_relaxed)) {
+                return;
+            }
+            try {
+                if (!cluster_func(clusters[i])) {
+                    cluster_holds[i] = false;
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            } catch (...) {
+                std::lock_guard lock(exception_mutex);
+                if (!exception) exception = std::current_exception();
+            }
+        });
+    }
+    pool.join();
+    calculate_highlights_ = true;
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    metric_fd_holds_ = !failed.load();
+    if (algo_ == +MetricAlgo::approx) {
+        return;
+    }
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        if (!cluster_holds[i]) {
+            cluster_func(clusters[i]);
+        }
     }
 }
 
@@ -260,9 +315,12 @@ ClusterFunction MetricVerifier::GetClusterFunctionForOneDimension() {
     assert(col.GetTypeId() == +model::TypeId::kString);
     auto const& type = static_cast<model::StringType const&>(col.GetType());
 
-    std::function<ClusterFunction(DistanceFunction<std::byte const*>)> verify_func;
+    // the first function is used for verification and the second one for highlights
+    std::function<ClusterFunction(DistanceFunction<std::byte const*>,
+                                  DistanceFunction<std::byte const*>)>
+            verify_func;
     if (algo_ == +MetricAlgo::brute) {
-        verify_func = [this](auto dist_func) {
+        verify_func = [this](auto dist_func, auto highlight_dist_func) {
             return CalculateClusterFunction<IndexedOneDimensionalPoint>(
                     [this](auto const& cluster) {
                         return points_calculator_->CalculateIndexedPoints(cluster);
@@ -270,14 +328,14 @@ ClusterFunction MetricVerifier::GetClusterFunctionForOneDimension() {
                     [this, dist_func](auto const& points) {
                         return this->BruteVerifyCluster(points, dist_func);
                     },
-                    [this, dist_func](auto const& points,
-                                      std::vector<Highlight>&& cluster_highlights) {
+                    [this, highlight_dist_func](auto const& points,
+                                                std::vector<Highlight>&& cluster_highlights) {
                         return highlight_calculator_->CalculateHighlightsForStrings(
-                                points, std::move(cluster_highlights), dist_func);
+                                points, std::move(cluster_highlights), highlight_dist_func);
                     });
         };
     } else {
-        verify_func = [this](auto const& dist_func) {
+        verify_func = [this](auto const& dist_func, auto const&) {
             return CalculateApproxClusterFunction<std::byte const*>(
                     [this](auto const& cluster) {
                         return points_calculator_->CalculatePoints(cluster);
@@ -287,24 +345,37 @@ ClusterFunction MetricVerifier::GetClusterFunctionForOneDimension() {
     }
 
     if (metric_ == +Metric::levenshtein) {
+        // both checks only compare the distance with the parameter, so the distance is calculated
+        // exactly only up to it
+        unsigned const max_distance = static_cast<unsigned>(std::min<long double>(
+                parameter_, std::numeric_limits<unsigned>::max() - 1));
         return verify_func(
+                [&type, max_distance](std::byte const* l, std::byte const* r) {
+                    return util::LevenshteinDistance(type.GetValue<model::String>(l),
+                                                     type.GetValue<model::String>(r),
+                                                     max_distance);
+                },
                 [&type](std::byte const* l, std::byte const* r) { return type.Dist(l, r); });
     }
 
-    return [this, &type, verify_func](model::PLI::Cluster const& cluster) {
-        std::unordered_map<std::string, util::QGramVector> q_gram_map;
-        return verify_func(GetCosineDistFunction(type, q_gram_map))(cluster);
+    return [this, &type, verify_func](model::PLI::ClusterView cluster) {
+        std::unordered_map<std::string_view, util::QGramVector> q_gram_map;
+        auto dist_func = GetCosineDistFunction(type, q_gram_map);
+        return verify_func(dist_func, dist_func)(cluster);
     };
 }
 
 ClusterFunction MetricVerifier::GetClusterFunctionForSeveralDimensions() {
     if (algo_ == +MetricAlgo::calipers) {
-        return [this](model::PLI::Cluster const& cluster) {
+        return [this](model::PLI::ClusterView cluster) {
             auto result = points_calculator_->CalculateMultidimensionalPointsForCalipers(cluster);
             if (!CheckMFDFailIfHasNulls(result.has_nulls) &&
                 CalipersCompareNumericValues(result.points)) {
                 return true;
             }
+            if (!calculate_highlights_) {
+                return false;
+            }
 
             auto result_indexed =
                     points_calculator_->CalculateMultidimensionalIndexedPoints(cluster);
@@ -343,10 +414,10 @@ ClusterFunction MetricVerifier::GetClusterFunction() {
 
 DistanceFunction<std::byte const*> MetricVerifier::GetCosineDistFunction(
         model::StringType const& type,
-        std::unordered_map<std::string, util::QGramVector>& q_gram_map) const {
+        std::unordered_map<std::string_view, util::QGramVector>& q_gram_map) const {
     return [this, &type, &q_gram_map](std::byte const* a, std::byte const* b) -> long double {
-        std::string str1 = type.ValueToString(a);
-        std::string str2 = type.ValueToString(b);
+        std::string_view str1 = type.GetValue<model::String>(a);
+        std::string_view str2 = type.GetValue<model::String>(b);
         if (str1.length() < q_ || str2.length() < q_) {
             throw std::runtime_error(
                     "q-gram length should not exceed the minimum string length "
@@ -362,12 +433,14 @@ template <typename T>
 ClusterFunction MetricVerifier::CalculateClusterFunction(
         IndexedPointsFunction<T> points_func, CompareFunction<T> compare_func,
         HighlightFunction<T> highlight_func) const {
-    return [this, points_func, compare_func, highlight_func](model::PLI::Cluster const& cluster) {
+    return [this, points_func, compare_func, highlight_func](model::PLI::ClusterView cluster) {
         auto result = points_func(cluster);
         if (!CheckMFDFailIfHasNulls(result.has_nulls) && compare_func(result.points)) {
             return true;
         }
-        highlight_func(result.points, std::move(result.cluster_highlights));
+        if (calculate_highlights_) {
+            highlight_func(result.points, std::move(result.cluster_highlights));
+        }
         return false;
     };
 }
@@ -375,7 +448,7 @@ ClusterFunction MetricVerifier::CalculateClusterFunction(
 template <typename T>
 ClusterFunction MetricVerifier::CalculateApproxClusterFunction(
         PointsFunction<T> points_func, DistanceFunction<T> dist_func) const {
-    return [points_func, dist_func, this](model::PLI::Cluster const& cluster) {
+    return [points_func, dist_func, this](model::PLI::ClusterView cluster) {
         auto result = points_func(cluster);
         return !CheckMFDFailIfHasNulls(result.has_nulls) &&
                ApproxVerifyCluster(result.points, dist_func);
@@ -6,6 +6,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -18,6 +19,7 @@
 #include "config/equal_nulls/type.h"
 #include "config/indices/type.h"
 #include "config/tabular_data/input_table_type.h"
+#include "config/thread_number/type.h"
 #include "model/table/column_layout_relation_data.h"
 #include "model/table/column_layout_typed_relation_data.h"
 #include "util/convex_hull.h"
@@ -37,8 +39,11 @@ private:
     unsigned int q_;
     bool dist_from_null_is_infinity_;
     config::EqNullsType is_null_equal_null_;
+    config::ThreadNumType threads_num_ = 1;
 
     bool metric_fd_holds_ = false;
+    /* highlights are calculated only by the serial pass over the violating clusters */
+    bool calculate_highlights_ = true;
 
     std::shared_ptr<model::ColumnLayoutTypedRelationData> typed_relation_;
     std::shared_ptr<ColumnLayoutRelationData> relation_;  // temporarily parsing twice
@@ -47,7 +52,7 @@ private:
 
     DistanceFunction<std::byte const*> GetCosineDistFunction(
             model::StringType const& type,
-            std::unordered_map<std::string, util::QGramVector>& q_gram_map) const;
+            std::unordered_map<std::string_view, util::QGramVector>& q_gram_map) const;
 
     bool CheckMFDFailIfHasNulls(bool has_nulls) const {
         return dist_from_null_is_infinity_ && has_nulls;
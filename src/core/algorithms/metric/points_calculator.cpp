@@ -69,7 +69,7 @@ T PointsCalculator::GetPoint(ClusterIndex row_index, bool& has_values, bool& has
 }
 
 IndexedPointsCalculationResult<IndexedVector>
-PointsCalculator::CalculateMultidimensionalIndexedPoints(model::PLI::Cluster const& cluster) const {
+PointsCalculator::CalculateMultidimensionalIndexedPoints(model::PLI::ClusterView cluster) const {
     std::vector<IndexedVector> points;
     std::vector<Highlight> cluster_highlights;
     bool has_nulls_in_cluster = false;
@@ -93,7 +93,7 @@ PointsCalculator::CalculateMultidimensionalIndexedPoints(model::PLI::Cluster con
 }
 
 IndexedPointsCalculationResult<IndexedOneDimensionalPoint> PointsCalculator::CalculateIndexedPoints(
-        model::PLI::Cluster const& cluster) const {
+        model::PLI::ClusterView cluster) const {
     model::TypedColumnData const& col = typed_relation_->GetColumnData(rhs_indices_[0]);
     std::vector<std::byte const*> const& data = col.GetData();
     std::vector<IndexedPoint<std::byte const*>> points;
@@ -116,7 +116,7 @@ IndexedPointsCalculationResult<IndexedOneDimensionalPoint> PointsCalculator::Cal
 
 template <typename T>
 PointsCalculationResult<T> PointsCalculator::CalculateMultidimensionalPoints(
-        model::PLI::Cluster const& cluster, AssignmentFunction<T> const& assignment_func) const {
+        model::PLI::ClusterView cluster, AssignmentFunction<T> const& assignment_func) const {
     std::vector<T> points;
     bool has_nulls_in_cluster = false;
     for (auto i : cluster) {
@@ -136,18 +136,18 @@ PointsCalculationResult<T> PointsCalculator::CalculateMultidimensionalPoints(
 }
 
 PointsCalculationResult<util::Point> PointsCalculator::CalculateMultidimensionalPointsForCalipers(
-        model::PLI::Cluster const& cluster) const {
+        model::PLI::ClusterView cluster) const {
     return CalculateMultidimensionalPoints<util::Point>(cluster, AssignToPoint);
 }
 
 PointsCalculationResult<std::vector<long double>>
 PointsCalculator::CalculateMultidimensionalPointsForApprox(
-        model::PLI::Cluster const& cluster) const {
+        model::PLI::ClusterView cluster) const {
     return CalculateMultidimensionalPoints<std::vector<long double>>(cluster, AssignToVector);
 }
 
 PointsCalculationResult<std::byte const*> PointsCalculator::CalculatePoints(
-        model::PLI::Cluster const& cluster) const {
+        model::PLI::ClusterView cluster) const {
     model::TypedColumnData const& col = typed_relation_->GetColumnData(rhs_indices_[0]);
     std::vector<std::byte const*> const& data = col.GetData();
     std::vector<std::byte const*> points;
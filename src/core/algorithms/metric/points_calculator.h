@@ -25,23 +25,23 @@ private:
 
 public:
     IndexedPointsCalculationResult<IndexedOneDimensionalPoint> CalculateIndexedPoints(
-            model::PLI::Cluster const& cluster) const;
+            model::PLI::ClusterView cluster) const;
 
     IndexedPointsCalculationResult<IndexedVector> CalculateMultidimensionalIndexedPoints(
-            model::PLI::Cluster const& cluster) const;
+            model::PLI::ClusterView cluster) const;
 
     template <typename T>
     PointsCalculationResult<T> CalculateMultidimensionalPoints(
-            model::PLI::Cluster const& cluster, AssignmentFunction<T> const& assignment_func) const;
+            model::PLI::ClusterView cluster, AssignmentFunction<T> const& assignment_func) const;
 
     PointsCalculationResult<util::Point> CalculateMultidimensionalPointsForCalipers(
-            model::PLI::Cluster const& cluster) const;
+            model::PLI::ClusterView cluster) const;
 
     PointsCalculationResult<std::vector<long double>> CalculateMultidimensionalPointsForApprox(
-            model::PLI::Cluster const& cluster) const;
+            model::PLI::ClusterView cluster) const;
 
     PointsCalculationResult<std::byte const*> CalculatePoints(
-            model::PLI::Cluster const& cluster) const;
+            model::PLI::ClusterView cluster) const;
 
     explicit PointsCalculator(bool dist_from_null_is_infinity,
                               std::shared_ptr<model::ColumnLayoutTypedRelationData> typed_relation,
@@ -1,63 +1,59 @@
 #include "dependency_checker.h"
 
 #include <algorithm>
-#include <unordered_set>
+#include <vector>
 
 #include "model/table/tuple_index.h"
 
 namespace algos::order {
 
 namespace {
-bool SubsetSetDifference(SortedPartition::EquivalenceClass const& a,
-                         SortedPartition::EquivalenceClass& b) {
-    auto const not_found = b.end();
-    for (model::TupleIndex element : a) {
-        auto it = b.find(element);
-        if (it == not_found) {
-            return false;
+using PartitionIndex = SortedPartition::PartitionIndex;
+
+/* The greatest class of other among the tuples of every class of partition */
+std::vector<PartitionIndex> GetMaxOtherClasses(SortedPartition const& partition,
+                                               SortedPartition::ClassIndices const& other_indices) {
+    std::vector<PartitionIndex> max_other_classes(partition.Size(), 0);
+    for (PartitionIndex i = 0; i < partition.Size(); ++i) {
+        for (model::TupleIndex tuple_index : partition.GetEqClass(i)) {
+            max_other_classes[i] = std::max(max_other_classes[i], other_indices[tuple_index]);
         }
-        b.erase(it);
     }
-    return true;
+    return max_other_classes;
 }
 }  // namespace
 
+/* Both partitions are walked class by class, the remainder of the smaller current class must be a
+ * subset of the larger one. The tuples of the earlier classes of r are already subtracted from
+ * the current class of l (and vice versa), so the remainder of a class of l is a subset of the
+ * current class of r iff none of its tuples belongs to a later class of r.
+ */
 ValidityType CheckForSwap(SortedPartition const& l, SortedPartition const& r) {
+    std::vector<PartitionIndex> const l_max_r_classes = GetMaxOtherClasses(l, r.GetClassIndices());
+    std::vector<PartitionIndex> const r_max_l_classes = GetMaxOtherClasses(r, l.GetClassIndices());
     ValidityType res = ValidityType::valid;
-    size_t l_i = 0, r_i = 0;
-    bool next_l = true, next_r = true;
-    SortedPartition::EquivalenceClass l_eq_class;
-    SortedPartition::EquivalenceClass r_eq_class;
-    SortedPartition::EquivalenceClasses const& l_classes = l.GetEqClasses();
-    SortedPartition::EquivalenceClasses const& r_classes = r.GetEqClasses();
-    while (l_i < l_classes.size() && r_i < r_classes.size()) {
-        if (next_l) {
-            l_eq_class = l_classes[l_i];
-        }
-        if (next_r) {
-            r_eq_class = r_classes[r_i];
-        }
-        if (l_eq_class.size() < r_eq_class.size()) {
-            if (!SubsetSetDifference(l_eq_class, r_eq_class)) {
+    std::size_t l_i = 0, r_i = 0;
+    std::size_t l_remaining = l.Size() > 0 ? l.GetEqClassSize(0) : 0;
+    std::size_t r_remaining = r.Size() > 0 ? r.GetEqClassSize(0) : 0;
+    while (l_i < l.Size() && r_i < r.Size()) {
+        if (l_remaining < r_remaining) {
+            if (l_max_r_classes[l_i] > r_i) {
                 return ValidityType::swap;
-            } else {
-                res = ValidityType::merge;
-                ++l_i;
-                next_l = true;
-                next_r = false;
             }
+            res = ValidityType::merge;
+            r_remaining -= l_remaining;
+            ++l_i;
+            l_remaining = l_i < l.Size() ? l.GetEqClassSize(l_i) : 0;
         } else {
-            if (!SubsetSetDifference(r_eq_class, l_eq_class)) {
+            if (r_max_l_classes[r_i] > l_i) {
                 return ValidityType::swap;
-            } else {
-                ++r_i;
-                next_r = true;
-                if (l_eq_class.empty()) {
-                    ++l_i;
-                    next_l = true;
-                } else {
-                    next_l = false;
-                }
+            }
+            l_remaining -= r_remaining;
+            ++r_i;
+            r_remaining = r_i < r.Size() ? r.GetEqClassSize(r_i) : 0;
+            if (l_remaining == 0) {
+                ++l_i;
+                l_remaining = l_i < l.Size() ? l.GetEqClassSize(l_i) : 0;
             }
         }
     }
@@ -75,20 +75,21 @@ void Order::CreateSingleColumnSortedPartitions() {
             return type->Compare(l.data, r.data) == model::CompareResult::kEqual;
         };
         std::sort(indexed_byte_data.begin(), indexed_byte_data.end(), less);
-        SortedPartition::EquivalenceClasses equivalence_classes;
-        equivalence_classes.reserve(typed_relation_->GetNumRows());
-        equivalence_classes.push_back({indexed_byte_data.front().index});
-        for (size_t k = 1; k < indexed_byte_data.size(); ++k) {
-            if (equal(indexed_byte_data[k - 1], indexed_byte_data[k])) {
-                equivalence_classes.back().insert(indexed_byte_data[k].index);
-            } else {
-                equivalence_classes.push_back({indexed_byte_data[k].index});
+        std::vector<model::TupleIndex> tuples;
+        std::vector<std::size_t> class_begins;
+        tuples.reserve(indexed_byte_data.size());
+        class_begins.reserve(indexed_byte_data.size() + 1);
+        for (size_t k = 0; k < indexed_byte_data.size(); ++k) {
+            if (k == 0 || !equal(indexed_byte_data[k - 1], indexed_byte_data[k])) {
+                class_begins.push_back(k);
             }
+            tuples.push_back(indexed_byte_data[k].index);
         }
-        equivalence_classes.shrink_to_fit();
-        sorted_partitions_.emplace(
-                AttributeList{i},
-                SortedPartition(std::move(equivalence_classes), typed_relation_->GetNumRows()));
+        class_begins.push_back(tuples.size());
+        class_begins.shrink_to_fit();
+        sorted_partitions_.emplace(AttributeList{i},
+                                   SortedPartition(std::move(tuples), std::move(class_begins),
+                                                   typed_relation_->GetNumRows()));
     }
     PruneSingleEqClassPartitions();
 }
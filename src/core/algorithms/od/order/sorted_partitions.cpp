@@ -1,70 +1,51 @@
 #include "sorted_partitions.h"
 
-#include <unordered_map>
+#include <cassert>
 #include <vector>
 
 #include "model/table/tuple_index.h"
 
 namespace algos::order {
 
-void SortedPartition::BuildHashTable() {
-    hash_partition_.reserve(num_rows_);
-    for (PartitionIndex i = 0; i < sorted_partition_.size(); ++i) {
-        if (sorted_partition_[i].size() == 1) {
-            continue;
-        }
-        for (model::TupleIndex tuple_index : sorted_partition_[i]) {
-            hash_partition_.emplace(tuple_index, i);
+SortedPartition::ClassIndices SortedPartition::GetClassIndices() const {
+    ClassIndices class_indices(num_rows_, kNoClass);
+    for (PartitionIndex i = 0; i < Size(); ++i) {
+        for (model::TupleIndex tuple_index : GetEqClass(i)) {
+            class_indices[tuple_index] = i;
         }
     }
+    return class_indices;
 }
 
-SortedPartition::HashProduct SortedPartition::BuildHashProduct(SortedPartition const& other) {
-    HashProduct hash_product;
-    hash_product.reserve(hash_partition_.size());
-    for (EquivalenceClass const& eq_class : other.sorted_partition_) {
-        if (other.sorted_partition_.size() <= 1) {
-            break;
-        }
-        std::unordered_set<PartitionIndex> visited_positions;
-        for (model::TupleIndex tuple_index : eq_class) {
-            auto it = hash_partition_.find(tuple_index);
-            if (it == hash_partition_.end()) {
-                continue;
-            }
-            PartitionIndex position = it->second;
-            visited_positions.insert(position);
-            auto pos_it = hash_product.find(position);
-            if (pos_it == hash_product.end()) {
-                pos_it = hash_product.emplace(position, EquivalenceClasses{{}}).first;
-            }
-            pos_it->second.back().insert(tuple_index);
-        }
-        for (PartitionIndex position : visited_positions) {
-            hash_product[position].push_back({});
+void SortedPartition::Intersect(SortedPartition const& other) {
+    ClassIndices const class_indices = GetClassIndices();
+    ClassIndices const other_class_indices = other.GetClassIndices();
+    // tuples are placed into their classes in the order of other, so every class ends up sorted
+    // by the classes of other and the refinement is a single pass over the tuples
+    std::vector<std::size_t> next_positions(class_begins_.begin(), class_begins_.end() - 1);
+    std::vector<model::TupleIndex> tuples(tuples_.size());
+    for (model::TupleIndex tuple_index : other.tuples_) {
+        PartitionIndex const position = class_indices[tuple_index];
+        if (position == kNoClass) {
+            continue;
         }
+        tuples[next_positions[position]++] = tuple_index;
     }
-    return hash_product;
-}
-
-void SortedPartition::Intersect(SortedPartition const& other) {
-    BuildHashTable();
-    HashProduct hash_product = BuildHashProduct(other);
-    SortedPartition res(num_rows_);
-    res.sorted_partition_.reserve(num_rows_);
-    for (std::size_t i = 0; i < sorted_partition_.size(); ++i) {
-        if (EquivalenceClass const& eq_class = sorted_partition_[i]; eq_class.size() == 1) {
-            res.sorted_partition_.push_back(eq_class);
-        } else {
-            for (EquivalenceClass& eq_class : hash_product[i]) {
-                if (!eq_class.empty()) {
-                    res.sorted_partition_.push_back(std::move(eq_class));
-                }
+    std::vector<std::size_t> class_begins;
+    class_begins.reserve(tuples.size() + 1);
+    for (PartitionIndex i = 0; i < Size(); ++i) {
+        assert(next_positions[i] == class_begins_[i + 1]);
+        class_begins.push_back(class_begins_[i]);
+        for (std::size_t pos = class_begins_[i] + 1; pos < class_begins_[i + 1]; ++pos) {
+            if (other_class_indices[tuples[pos]] != other_class_indices[tuples[pos - 1]]) {
+                class_begins.push_back(pos);
             }
         }
     }
-    res.sorted_partition_.shrink_to_fit();
-    *this = std::move(res);
+    class_begins.push_back(tuples.size());
+    class_begins.shrink_to_fit();
+    tuples_ = std::move(tuples);
+    class_begins_ = std::move(class_begins);
 }
 
 }  // namespace algos::order
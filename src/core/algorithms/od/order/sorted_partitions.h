@@ -1,41 +1,52 @@
 #pragma once
 
-#include <unordered_map>
-#include <unordered_set>
+#include <span>
 #include <vector>
 
 #include "model/table/tuple_index.h"
 
 namespace algos::order {
 
+/* Equivalence classes of the tuples in the sort order. The classes are stored flat: a permutation
+ * of the tuple indices ordered by class and the offsets where every class begins.
+ */
 class SortedPartition {
 public:
-    using EquivalenceClass = std::unordered_set<model::TupleIndex>;
-    using EquivalenceClasses = std::vector<EquivalenceClass>;
+    using EquivalenceClass = std::span<model::TupleIndex const>;
     using PartitionIndex = unsigned long;
-    using HashProduct = std::unordered_map<PartitionIndex, EquivalenceClasses>;
+    /* Class of every tuple of the table, kNoClass for the tuples not in the partition */
+    using ClassIndices = std::vector<PartitionIndex>;
+
+    static constexpr PartitionIndex kNoClass = -1;
 
 private:
-    EquivalenceClasses sorted_partition_;
-    std::unordered_map<model::TupleIndex, PartitionIndex> hash_partition_;
+    std::vector<model::TupleIndex> tuples_;
+    /* Size() + 1 offsets into tuples_, the last one is tuples_.size() */
+    std::vector<std::size_t> class_begins_ = {0};
     unsigned long num_rows_ = 0;
 
-    void BuildHashTable();
-    HashProduct BuildHashProduct(SortedPartition const& other);
-
 public:
     SortedPartition() = default;
     explicit SortedPartition(unsigned long num_rows) noexcept : num_rows_(num_rows){};
-    SortedPartition(EquivalenceClasses&& eq_classes, unsigned long num_rows)
-        : sorted_partition_(std::move(eq_classes)), num_rows_(num_rows){};
+    SortedPartition(std::vector<model::TupleIndex>&& tuples,
+                    std::vector<std::size_t>&& class_begins, unsigned long num_rows)
+        : tuples_(std::move(tuples)), class_begins_(std::move(class_begins)), num_rows_(num_rows){};
+
+    /* Splits every class by the classes of other, both partitions must contain the same tuples */
     void Intersect(SortedPartition const& other);
 
-    EquivalenceClasses const& GetEqClasses() const {
-        return sorted_partition_;
+    ClassIndices GetClassIndices() const;
+
+    EquivalenceClass GetEqClass(PartitionIndex index) const {
+        return {tuples_.data() + class_begins_[index], GetEqClassSize(index)};
+    }
+
+    std::size_t GetEqClassSize(PartitionIndex index) const {
+        return class_begins_[index + 1] - class_begins_[index];
     }
 
     std::size_t Size() const {
-        return sorted_partition_.size();
+        return class_begins_.size() - 1;
     }
 };
 
@@ -184,7 +184,7 @@ std::vector<model::PLI::Cluster> TypoMiner::FindClustersWithTypos(FD const& typo
         }
     }
 
-    for (model::PLI::Cluster const& cluster : intersection_pli->GetIndex()) {
+    for (model::PLI::ClusterView cluster : intersection_pli->GetIndex()) {
         int cluster_rhs_value = -1;
 
         /* Check if fd has wrong rhs values in this cluster */
@@ -207,7 +207,7 @@ std::vector<model::PLI::Cluster> TypoMiner::FindClustersWithTypos(FD const& typo
              * So I decided to leave it as it is until we know for sure that this place causes
              * performance problems.
              */
-            clusters.push_back(cluster);
+            clusters.emplace_back(cluster.begin(), cluster.end());
 
             if (sort_clusters) {
                 sort_cluster(clusters.back());
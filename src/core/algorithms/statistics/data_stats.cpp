@@ -1,6 +1,13 @@
 #include "algorithms/statistics/data_stats.h"
 
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <cmath>
+#include <future>
+#include <limits>
 #include <set>
+#include <type_traits>
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
@@ -500,7 +507,7 @@ Statistic DataStats::GetVocab(size_t index) const {
 
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
-        auto const& string_data = mo::Type::GetValue<std::string>(col.GetValue(i));
+        mo::String const string_data = mo::Type::GetValue<mo::String>(col.GetValue(i));
         vocab.insert(string_data.begin(), string_data.end());
     }
     std::string temp(vocab.begin(), vocab.end());
@@ -555,7 +562,7 @@ Statistic DataStats::CountIfInColumn(Pred pred, size_t index) const {
 
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
-        auto const& string_data = mo::Type::GetValue<std::string>(col.GetValue(i));
+        mo::String const string_data = mo::Type::GetValue<mo::String>(col.GetValue(i));
         for (size_t j = 0; j < string_data.size(); j++)
             if (pred(string_data[j])) count++;
     }
@@ -569,7 +576,7 @@ Statistic DataStats::GetNumberOfChars(size_t index) const {
     mo::TypedColumnData const& col = col_data_[index];
     if (col.GetTypeId() != +mo::TypeId::kString) return {};
 
-    return GetStringSumOf(index, [](std::string const& line) { return line.size(); });
+    return GetStringSumOf(index, [](mo::String line) { return line.size(); });
 }
 
 Statistic DataStats::GetAvgNumberOfChars(size_t index) const {
@@ -603,7 +610,7 @@ Statistic DataStats::GetStringMinOf(size_t index, Pred pred) const {
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
 
-        auto const& string_data = mo::Type::GetValue<std::string>(col.GetValue(i));
+        mo::String const string_data = mo::Type::GetValue<mo::String>(col.GetValue(i));
         size_t const& size = pred(string_data);
 
         if (size < result) result = size;
@@ -623,7 +630,7 @@ Statistic DataStats::GetStringMaxOf(size_t index, Pred pred) const {
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
 
-        auto const& string_data = mo::Type::GetValue<std::string>(col.GetValue(i));
+        mo::String const string_data = mo::Type::GetValue<mo::String>(col.GetValue(i));
         size_t const& size = pred(string_data);
 
         if (size > result) result = size;
@@ -643,7 +650,7 @@ Statistic DataStats::GetStringSumOf(size_t index, Pred pred) const {
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
 
-        auto const& string_data = mo::Type::GetValue<std::string>(col.GetValue(i));
+        mo::String const string_data = mo::Type::GetValue<mo::String>(col.GetValue(i));
 
         result += pred(string_data);
     }
@@ -658,7 +665,7 @@ Statistic DataStats::GetMinNumberOfChars(size_t index) const {
     mo::TypedColumnData const& col = col_data_[index];
     if (col.GetTypeId() != +mo::TypeId::kString) return {};
 
-    return GetStringMinOf(index, [](std::string const& line) { return line.size(); });
+    return GetStringMinOf(index, [](mo::String line) { return line.size(); });
 }
 
 Statistic DataStats::GetMaxNumberOfChars(size_t index) const {
@@ -666,7 +673,7 @@ Statistic DataStats::GetMaxNumberOfChars(size_t index) const {
     mo::TypedColumnData const& col = col_data_[index];
     if (col.GetTypeId() != +mo::TypeId::kString) return {};
 
-    return GetStringMaxOf(index, [](std::string const& line) { return line.size(); });
+    return GetStringMaxOf(index, [](mo::String line) { return line.size(); });
 }
 
 std::vector<std::string> DataStats::GetWordsInString(std::string line) {
@@ -686,14 +693,14 @@ std::set<std::string> DataStats::GetWords(size_t index) const {
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
         std::vector<std::string> words_in_row =
-                GetWordsInString(mo::Type::GetValue<std::string>(col.GetValue(i)));
+                GetWordsInString(std::string(mo::Type::GetValue<mo::String>(col.GetValue(i))));
         words.insert(words_in_row.begin(), words_in_row.end());
     }
 
     return words;
 }
 
-size_t DataStats::GetNumberOfWordsInString(std::string line) {
+size_t DataStats::GetNumberOfWordsInString(std::string_view line) {
     size_t count = 0;
 
     for (size_t i = 0; i < line.size(); i++) {
@@ -710,7 +717,7 @@ Statistic DataStats::GetMinNumberOfWords(size_t index) const {
     if (col.GetTypeId() != +mo::TypeId::kString) return {};
 
     return GetStringMinOf(index,
-                          [](std::string const& line) { return GetNumberOfWordsInString(line); });
+                          [](mo::String line) { return GetNumberOfWordsInString(line); });
 }
 
 Statistic DataStats::GetMaxNumberOfWords(size_t index) const {
@@ -719,7 +726,7 @@ Statistic DataStats::GetMaxNumberOfWords(size_t index) const {
     if (col.GetTypeId() != +mo::TypeId::kString) return {};
 
     return GetStringMaxOf(index,
-                          [](std::string const& line) { return GetNumberOfWordsInString(line); });
+                          [](mo::String line) { return GetNumberOfWordsInString(line); });
 }
 
 Statistic DataStats::GetNumberOfWords(size_t index) const {
@@ -728,7 +735,7 @@ Statistic DataStats::GetNumberOfWords(size_t index) const {
     if (col.GetTypeId() != +mo::TypeId::kString) return {};
 
     return GetStringSumOf(index,
-                          [](std::string const& line) { return GetNumberOfWordsInString(line); });
+                          [](mo::String line) { return GetNumberOfWordsInString(line); });
 }
 
 std::vector<char> DataStats::GetTopKChars(size_t index, size_t k) const {
@@ -740,7 +747,7 @@ std::vector<char> DataStats::GetTopKChars(size_t index, size_t k) const {
 
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
-        auto const& string_data = mo::Type::GetValue<std::string>(col.GetValue(i));
+        mo::String const string_data = mo::Type::GetValue<mo::String>(col.GetValue(i));
         for (char const symbol : string_data) {
             if (count_chars.find(symbol) != count_chars.end()) {
                 count_chars[symbol]++;
@@ -776,7 +783,7 @@ std::vector<std::string> DataStats::GetTopKWords(size_t index, size_t k) const {
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
         std::vector<std::string> words_in_row =
-                GetWordsInString(mo::Type::GetValue<std::string>(col.GetValue(i)));
+                GetWordsInString(std::string(mo::Type::GetValue<mo::String>(col.GetValue(i))));
         for (std::string const& word : words_in_row) {
             if (count_words.find(word) != count_words.end()) {
                 count_words[word]++;
@@ -853,7 +860,7 @@ Statistic DataStats::CountIfInColumnForWords(Pred pred, size_t index) const {
     for (size_t i = 0; i < col.GetNumRows(); i++) {
         if (col.IsNullOrEmpty(i)) continue;
         std::vector<std::string> words_in_row =
-                GetWordsInString(mo::Type::GetValue<std::string>(col.GetValue(i)));
+                GetWordsInString(std::string(mo::Type::GetValue<mo::String>(col.GetValue(i))));
         for (size_t j = 0; j < words_in_row.size(); j++)
             if (pred(words_in_row[j])) count++;
     }
@@ -863,6 +870,369 @@ Statistic DataStats::CountIfInColumnForWords(Pred pred, size_t index) const {
     return Statistic(res, &int_type, false);
 }
 
+namespace {
+
+/* Values of tall columns are processed in chunks of a fixed size, so partial results are merged
+ * in the same order whatever the number of threads is */
+constexpr size_t kChunkSize = 1 << 16;
+/* Columns with fewer rows are processed by a single thread */
+constexpr size_t kTallColumnSize = 4 * kChunkSize;
+
+/* Calls chunk_func(begin, end) for every chunk of [0, size) and returns the results in the chunk
+ * order. Chunks are processed by the pool if it is given. */
+template <typename ChunkFunc>
+auto MapChunks(size_t size, size_t chunk_size, boost::asio::thread_pool* pool,
+               ChunkFunc const& chunk_func) {
+    using Result = std::invoke_result_t<ChunkFunc, size_t, size_t>;
+    std::vector<std::future<Result>> futures;
+    std::vector<Result> results;
+    for (size_t begin = 0; begin < size; begin += chunk_size) {
+        size_t const end = std::min(begin + chunk_size, size);
+        if (pool == nullptr) {
+            results.push_back(chunk_func(begin, end));
+            continue;
+        }
+        std::packaged_task<Result()> task([&chunk_func, begin, end]() {
+            return chunk_func(begin, end);
+        });
+        futures.push_back(task.get_future());
+        boost::asio::post(*pool, std::move(task));
+    }
+    for (auto& future : futures) results.push_back(future.get());
+    return results;
+}
+
+/* Sorts chunks of the data in parallel and then merges them pairwise */
+void SortValues(std::vector<std::byte const*>& data, mo::Type const& type,
+                boost::asio::thread_pool* pool) {
+    if (pool == nullptr) {
+        std::sort(data.begin(), data.end(), type.GetComparator());
+        return;
+    }
+    auto begin = data.begin();
+    MapChunks(data.size(), kChunkSize, pool, [&](size_t first, size_t last) {
+        std::sort(begin + first, begin + last, type.GetComparator());
+        return true;
+    });
+    for (size_t width = kChunkSize; width < data.size(); width *= 2) {
+        MapChunks(data.size(), 2 * width, pool, [&](size_t first, size_t last) {
+            if (first + width < last) {
+                std::inplace_merge(begin + first, begin + first + width, begin + last,
+                                   type.GetComparator());
+            }
+            return true;
+        });
+    }
+}
+
+template <typename T>
+struct ValueSums {
+    T sum = 0;
+    T sum_of_squares = 0;
+    size_t num_zeros = 0;
+    size_t num_negatives = 0;
+    /* product of the values raised to the power of 1 / count */
+    double geometric_mean = 1;
+
+    void Merge(ValueSums const& other) {
+        sum += other.sum;
+        sum_of_squares += other.sum_of_squares;
+        num_zeros += other.num_zeros;
+        num_negatives += other.num_negatives;
+        geometric_mean *= other.geometric_mean;
+    }
+};
+
+/* Sums of powers of the deviations from the average */
+struct DeviationSums {
+    double abs = 0;
+    double squares = 0;
+    double cubes = 0;
+    double fourth_powers = 0;
+
+    void Merge(DeviationSums const& other) {
+        abs += other.abs;
+        squares += other.squares;
+        cubes += other.cubes;
+        fourth_powers += other.fourth_powers;
+    }
+};
+
+/* Moment-based statistics of a numeric column, data must hold its values in the row order */
+template <typename T>
+void CalculateNumericStats(std::vector<std::byte const*> const& data,
+                           mo::NumericType<T> const& type, ColumnStats& stats,
+                           boost::asio::thread_pool* pool) {
+    mo::DoubleType double_type;
+    mo::IntType int_type;
+    long double const count = data.size();
+    long double const count_reciprocal = 1.0L / count;
+
+    ValueSums<T> value_sums;
+    auto sum_values = [&data, count_reciprocal](size_t begin, size_t end) {
+        ValueSums<T> sums;
+        for (size_t i = begin; i != end; ++i) {
+            T const value = mo::Type::GetValue<T>(data[i]);
+            sums.sum += value;
+            sums.sum_of_squares += static_cast<T>(std::pow(value, 2.0L));
+            if (value == 0) ++sums.num_zeros;
+            if (value < 0) ++sums.num_negatives;
+            sums.geometric_mean *=
+                    static_cast<double>(std::pow(static_cast<double>(value), count_reciprocal));
+        }
+        return sums;
+    };
+    for (ValueSums<T> const& sums : MapChunks(data.size(), kChunkSize, pool, sum_values)) {
+        value_sums.Merge(sums);
+    }
+
+    double const avg = static_cast<double>(value_sums.sum) / static_cast<double>(count);
+    DeviationSums deviation_sums;
+    auto sum_deviations = [&data, avg](size_t begin, size_t end) {
+        DeviationSums sums;
+        for (size_t i = begin; i != end; ++i) {
+            double const deviation = static_cast<double>(mo::Type::GetValue<T>(data[i])) - avg;
+            sums.abs += std::abs(deviation);
+            sums.squares += static_cast<double>(std::pow(deviation, 2.0L));
+            sums.cubes += static_cast<double>(std::pow(deviation, 3.0L));
+            sums.fourth_powers += static_cast<double>(std::pow(deviation, 4.0L));
+        }
+        return sums;
+    };
+    for (DeviationSums const& sums : MapChunks(data.size(), kChunkSize, pool, sum_deviations)) {
+        deviation_sums.Merge(sums);
+    }
+
+    auto power = [](double value, long double exponent) {
+        return static_cast<double>(std::pow(value, exponent));
+    };
+    double const std_dev = power(deviation_sums.squares / static_cast<double>(count - 1), 0.5L);
+    double const skewness =
+            deviation_sums.cubes / static_cast<double>(count) / power(std_dev, 3.0L);
+    double const kurtosis =
+            deviation_sums.fourth_powers / static_cast<double>(count) / power(std_dev, 4.0L) - 3;
+
+    stats.sum = Statistic(type.MakeValue(value_sums.sum), &type, false);
+    stats.sum_of_squares = Statistic(type.MakeValue(value_sums.sum_of_squares), &type, false);
+    stats.num_zeros = Statistic(int_type.MakeValue(value_sums.num_zeros), &int_type, false);
+    stats.num_negatives = Statistic(int_type.MakeValue(value_sums.num_negatives), &int_type, false);
+    if (value_sums.num_negatives == 0) {
+        stats.geometric_mean =
+                Statistic(double_type.MakeValue(value_sums.geometric_mean), &double_type, false);
+    }
+    stats.avg = Statistic(double_type.MakeValue(avg), &double_type, false);
+    stats.STD = Statistic(double_type.MakeValue(std_dev), &double_type, false);
+    stats.skewness = Statistic(double_type.MakeValue(skewness), &double_type, false);
+    stats.kurtosis = Statistic(double_type.MakeValue(kurtosis), &double_type, false);
+    stats.mean_ad = Statistic(
+            double_type.MakeValue(deviation_sums.abs / static_cast<double>(count)), &double_type,
+            false);
+}
+
+/* Median of the values, data must be sorted */
+template <typename T>
+double SortedMedian(std::vector<std::byte const*> const& data) {
+    auto const mid = data.begin() + data.size() / 2;
+    if (data.size() % 2 != 0) return static_cast<double>(mo::Type::GetValue<T>(*mid));
+    T const sum = mo::Type::GetValue<T>(*std::prev(mid)) + mo::Type::GetValue<T>(*mid);
+    return static_cast<double>(sum) / 2;
+}
+
+/* Median and median absolute deviation of a numeric column, data must be sorted */
+template <typename T>
+void CalculateMedians(std::vector<std::byte const*> const& data, ColumnStats& stats,
+                      boost::asio::thread_pool* pool) {
+    mo::DoubleType double_type;
+    double const median = SortedMedian<T>(data);
+
+    std::vector<double> deviations(data.size());
+    MapChunks(data.size(), kChunkSize, pool, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i != end; ++i) {
+            deviations[i] = std::abs(static_cast<double>(mo::Type::GetValue<T>(data[i])) - median);
+        }
+        return true;
+    });
+    auto const mid = deviations.begin() + deviations.size() / 2;
+    std::nth_element(deviations.begin(), mid, deviations.end());
+    double median_ad = *mid;
+    if (deviations.size() % 2 == 0) {
+        median_ad = (*std::max_element(deviations.begin(), mid) + median_ad) / 2;
+    }
+
+    stats.median = Statistic(double_type.MakeValue(median), &double_type, false);
+    stats.median_ad = Statistic(double_type.MakeValue(median_ad), &double_type, false);
+}
+
+/* Quantiles, extremes and the number of distinct values, data must be sorted */
+void CalculateOrderStats(std::vector<std::byte const*> const& data, mo::Type const& type,
+                         ColumnStats& stats, boost::asio::thread_pool* pool) {
+    stats.quantile25 = Statistic(data[(size_t)(data.size() * 0.25)], &type, true);
+    stats.quantile50 = Statistic(data[(size_t)(data.size() * 0.5)], &type, true);
+    stats.quantile75 = Statistic(data[(size_t)(data.size() * 0.75)], &type, true);
+    stats.min = Statistic(data.front(), &type, true);
+    stats.max = Statistic(data.back(), &type, true);
+
+    stats.distinct = 1;
+    auto count_changes = [&data, &type](size_t begin, size_t end) {
+        size_t changes = 0;
+        for (size_t i = begin; i != end && i + 1 < data.size(); ++i) {
+            if (type.Compare(data[i], data[i + 1]) != mo::CompareResult::kEqual) ++changes;
+        }
+        return changes;
+    };
+    for (size_t changes : MapChunks(data.size(), kChunkSize, pool, count_changes)) {
+        stats.distinct += changes;
+    }
+}
+
+struct CharCounts {
+    std::bitset<UCHAR_MAX + 1> vocab;
+    size_t num_non_letter_chars = 0;
+    size_t num_digit_chars = 0;
+    size_t num_lowercase_chars = 0;
+    size_t num_uppercase_chars = 0;
+    size_t num_chars = 0;
+    size_t min_num_chars = std::numeric_limits<size_t>::max();
+    size_t max_num_chars = 0;
+    size_t num_words = 0;
+    size_t min_num_words = std::numeric_limits<size_t>::max();
+    size_t max_num_words = 0;
+    size_t num_entirely_uppercase = 0;
+    size_t num_entirely_lowercase = 0;
+
+    void Add(mo::String line) {
+        size_t words = 0;
+        bool in_word = false;
+        bool is_uppercase_word = true;
+        bool is_lowercase_word = true;
+        auto end_word = [&]() {
+            ++words;
+            if (is_uppercase_word) ++num_entirely_uppercase;
+            if (is_lowercase_word) ++num_entirely_lowercase;
+            in_word = false;
+            is_uppercase_word = is_lowercase_word = true;
+        };
+
+        for (char const c : line) {
+            auto const symbol = static_cast<unsigned char>(c);
+            bool const is_alpha = std::isalpha(symbol);
+            bool const is_lower = std::islower(symbol);
+            bool const is_upper = std::isupper(symbol);
+            vocab.set(symbol);
+            if (!is_alpha) ++num_non_letter_chars;
+            if (std::isdigit(symbol)) ++num_digit_chars;
+            if (is_lower) ++num_lowercase_chars;
+            if (is_upper) ++num_uppercase_chars;
+
+            if (std::isspace(symbol)) {
+                if (in_word) end_word();
+                continue;
+            }
+            in_word = true;
+            if (is_alpha && !is_upper) is_uppercase_word = false;
+            if (is_alpha && !is_lower) is_lowercase_word = false;
+        }
+        if (in_word) end_word();
+
+        num_chars += line.size();
+        min_num_chars = std::min(min_num_chars, line.size());
+        max_num_chars = std::max(max_num_chars, line.size());
+        num_words += words;
+        min_num_words = std::min(min_num_words, words);
+        max_num_words = std::max(max_num_words, words);
+    }
+
+    void Merge(CharCounts const& other) {
+        vocab |= other.vocab;
+        num_non_letter_chars += other.num_non_letter_chars;
+        num_digit_chars += other.num_digit_chars;
+        num_lowercase_chars += other.num_lowercase_chars;
+        num_uppercase_chars += other.num_uppercase_chars;
+        num_chars += other.num_chars;
+        min_num_chars = std::min(min_num_chars, other.min_num_chars);
+        max_num_chars = std::max(max_num_chars, other.max_num_chars);
+        num_words += other.num_words;
+        min_num_words = std::min(min_num_words, other.min_num_words);
+        max_num_words = std::max(max_num_words, other.max_num_words);
+        num_entirely_uppercase += other.num_entirely_uppercase;
+        num_entirely_lowercase += other.num_entirely_lowercase;
+    }
+};
+
+/* Character and word statistics of a string column, num_not_null includes empty values */
+void CalculateStringStats(std::vector<std::byte const*> const& data, size_t num_not_null,
+                          ColumnStats& stats, boost::asio::thread_pool* pool) {
+    CharCounts counts;
+    auto count_chars = [&data](size_t begin, size_t end) {
+        CharCounts chunk_counts;
+        for (size_t i = begin; i != end; ++i) {
+            chunk_counts.Add(mo::Type::GetValue<mo::String>(data[i]));
+        }
+        return chunk_counts;
+    };
+    for (CharCounts const& chunk_counts : MapChunks(data.size(), kChunkSize, pool, count_chars)) {
+        counts.Merge(chunk_counts);
+    }
+
+    mo::IntType int_type;
+    mo::DoubleType double_type;
+    mo::StringType string_type;
+    auto make_int = [&int_type](size_t value) {
+        return Statistic(int_type.MakeValue(value), &int_type, false);
+    };
+    std::string vocab;
+    /* in the order of char, as std::set<char> would give */
+    for (int symbol = CHAR_MIN; symbol <= CHAR_MAX; ++symbol) {
+        if (counts.vocab.test(static_cast<unsigned char>(symbol))) vocab.push_back(symbol);
+    }
+    stats.vocab = Statistic(string_type.MakeValue(vocab), &string_type, false);
+    stats.num_non_letter_chars = make_int(counts.num_non_letter_chars);
+    stats.num_digit_chars = make_int(counts.num_digit_chars);
+    stats.num_lowercase_chars = make_int(counts.num_lowercase_chars);
+    stats.num_uppercase_chars = make_int(counts.num_uppercase_chars);
+    stats.num_chars = make_int(counts.num_chars);
+    stats.num_avg_chars = Statistic(
+            double_type.MakeValue(static_cast<double>(static_cast<mo::Int>(counts.num_chars)) /
+                                  static_cast<double>(num_not_null)),
+            &double_type, false);
+    stats.min_num_chars = make_int(counts.min_num_chars);
+    stats.max_num_chars = make_int(counts.max_num_chars);
+    stats.min_num_words = make_int(counts.min_num_words);
+    stats.max_num_words = make_int(counts.max_num_words);
+    stats.num_words = make_int(counts.num_words);
+    stats.num_entirely_uppercase = make_int(counts.num_entirely_uppercase);
+    stats.num_entirely_lowercase = make_int(counts.num_entirely_lowercase);
+}
+
+}  // namespace
+
+void DataStats::CalculateColumnStats(size_t index, boost::asio::thread_pool* pool) {
+    mo::TypedColumnData const& col = col_data_[index];
+    mo::TypeId const type_id = col.GetTypeId();
+    ColumnStats& stats = all_stats_[index];
+    std::vector<std::byte const*> data = DeleteNullAndEmpties(index);
+    if (data.empty()) return;
+
+    /* passes that sum the values go in the row order, before the sort */
+    if (type_id == +mo::TypeId::kInt) {
+        CalculateNumericStats(data, static_cast<mo::IntType const&>(col.GetType()), stats, pool);
+    } else if (type_id == +mo::TypeId::kDouble) {
+        CalculateNumericStats(data, static_cast<mo::DoubleType const&>(col.GetType()), stats,
+                              pool);
+    } else if (type_id == +mo::TypeId::kString) {
+        CalculateStringStats(data, col.GetNumRows() - col.GetNumNulls(), stats, pool);
+    }
+    if (!mo::Type::IsOrdered(type_id)) return;
+
+    SortValues(data, col.GetType(), pool);
+    CalculateOrderStats(data, col.GetType(), stats, pool);
+    if (type_id == +mo::TypeId::kInt) {
+        CalculateMedians<mo::Int>(data, stats, pool);
+    } else if (type_id == +mo::TypeId::kDouble) {
+        CalculateMedians<mo::Double>(data, stats, pool);
+    }
+}
+
 unsigned long long DataStats::ExecuteInternal() {
     if (all_stats_.empty()) {
         // Table has 0 columns, nothing to do
@@ -871,41 +1241,10 @@ unsigned long long DataStats::ExecuteInternal() {
 
     auto start_time = std::chrono::system_clock::now();
     double percent_per_col = kTotalProgressPercent / all_stats_.size();
-    auto task = [percent_per_col, this](size_t index) {
+    auto task = [percent_per_col, this](size_t index, boost::asio::thread_pool* pool) {
         all_stats_[index].count = NumberOfValues(index);
         if (this->col_data_[index].GetTypeId() != +mo::TypeId::kMixed) {
-            all_stats_[index].min = GetMin(index);
-            all_stats_[index].max = GetMax(index);
-            all_stats_[index].sum = GetSum(index);
-            // will use all_stats_[index].sum
-            all_stats_[index].avg = GetAvg(index);
-
-            GetQuantile(0.25, index, true);  // distint is calculated here
-            // after distinct, for faster executing
-            all_stats_[index].kurtosis = GetKurtosis(index);
-            all_stats_[index].skewness = GetSkewness(index);
-            all_stats_[index].STD = GetCorrectedSTD(index);
-            all_stats_[index].num_zeros = GetNumberOfZeros(index);
-            all_stats_[index].num_negatives = GetNumberOfNegatives(index);
-            all_stats_[index].sum_of_squares = GetSumOfSquares(index);
-            all_stats_[index].geometric_mean = GetGeometricMean(index);
-            all_stats_[index].mean_ad = GetMeanAD(index);
-            all_stats_[index].median = GetMedian(index);
-            all_stats_[index].median_ad = GetMedianAD(index);
-            all_stats_[index].vocab = GetVocab(index);
-            all_stats_[index].num_non_letter_chars = GetNumberOfNonLetterChars(index);
-            all_stats_[index].num_digit_chars = GetNumberOfDigitChars(index);
-            all_stats_[index].num_lowercase_chars = GetNumberOfLowercaseChars(index);
-            all_stats_[index].num_uppercase_chars = GetNumberOfUppercaseChars(index);
-            all_stats_[index].num_chars = GetNumberOfChars(index);
-            all_stats_[index].num_avg_chars = GetAvgNumberOfChars(index);
-            all_stats_[index].min_num_chars = GetMinNumberOfChars(index);
-            all_stats_[index].max_num_chars = GetMaxNumberOfChars(index);
-            all_stats_[index].min_num_words = GetMinNumberOfWords(index);
-            all_stats_[index].max_num_words = GetMaxNumberOfWords(index);
-            all_stats_[index].num_words = GetNumberOfWords(index);
-            all_stats_[index].num_entirely_uppercase = GetNumberOfEntirelyUppercaseWords(index);
-            all_stats_[index].num_entirely_lowercase = GetNumberOfEntirelyLowercaseWords(index);
+            CalculateColumnStats(index, pool);
         }
         // distinct for mixed type will be calculated here
         all_stats_[index].is_categorical = IsCategorical(
@@ -916,11 +1255,19 @@ unsigned long long DataStats::ExecuteInternal() {
 
     if (threads_num_ > 1) {
         boost::asio::thread_pool pool(threads_num_);
-        for (size_t i = 0; i < all_stats_.size(); ++i)
-            boost::asio::post(pool, [i, task]() { return task(i); });
+        std::vector<size_t> tall_columns;
+        for (size_t i = 0; i < all_stats_.size(); ++i) {
+            if (col_data_[i].GetNumRows() >= kTallColumnSize) {
+                tall_columns.push_back(i);
+            } else {
+                boost::asio::post(pool, [i, task]() { return task(i, nullptr); });
+            }
+        }
+        // tall columns are taken one by one, their chunks are shared among the threads
+        for (size_t i : tall_columns) task(i, &pool);
         pool.join();
     } else {
-        for (size_t i = 0; i < all_stats_.size(); ++i) task(i);
+        for (size_t i = 0; i < all_stats_.size(); ++i) task(i, nullptr);
     }
 
     SetProgress(kTotalProgressPercent);
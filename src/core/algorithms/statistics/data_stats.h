@@ -1,6 +1,7 @@
 #pragma once
 
 #include <set>
+#include <string_view>
 
 #include "algorithms/fd/fd_algorithm.h"
 #include "algorithms/statistics/statistic.h"
@@ -9,6 +10,10 @@
 #include "config/thread_number/type.h"
 #include "model/table/column_layout_typed_relation_data.h"
 
+namespace boost::asio {
+class thread_pool;
+}  // namespace boost::asio
+
 namespace algos {
 
 class DataStats : public Algorithm {
@@ -35,7 +40,7 @@ class DataStats : public Algorithm {
     // checks if all the letters in a word a are lowercase
     static bool IsEntirelyLowercase(std::string word);
     // Returns the amount of words in a string
-    static size_t GetNumberOfWordsInString(std::string line);
+    static size_t GetNumberOfWordsInString(std::string_view line);
     // Returns a vector of words in a string
     static std::vector<std::string> GetWordsInString(std::string line);
 
@@ -62,6 +67,10 @@ class DataStats : public Algorithm {
     static std::byte* MedianOfNumericVector(std::vector<std::byte const*> const& data,
                                             model::INumericType const& type);
 
+    // Fills all the statistics of a non-mixed column in a few fused passes over its values.
+    // Chunks of the values are processed by the pool if it is given.
+    void CalculateColumnStats(size_t index, boost::asio::thread_pool* pool);
+
 protected:
     config::InputTable input_table_;
 
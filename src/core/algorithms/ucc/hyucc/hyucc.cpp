@@ -27,7 +27,7 @@ unsigned long long HyUCC::ExecuteInternal() {
 
     auto [plis, pli_records, og_mapping] = Preprocess(relation_.get());
     auto const plis_shared = std::make_shared<PLIs>(std::move(plis));
-    auto const pli_records_shared = std::make_shared<Rows>(std::move(pli_records));
+    auto const pli_records_shared = std::make_shared<CompressedRecords>(std::move(pli_records));
 
     hyucc::Sampler sampler(plis_shared, pli_records_shared, threads_num_);
 
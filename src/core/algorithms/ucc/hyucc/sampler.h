@@ -12,7 +12,8 @@ private:
     hy::Sampler sampler_;
 
 public:
-    Sampler(hy::PLIsPtr plis, hy::RowsPtr pli_records, config::ThreadNumType threads = 1)
+    Sampler(hy::PLIsPtr plis, hy::CompressedRecordsPtr pli_records,
+            config::ThreadNumType threads = 1)
         : sampler_(std::move(plis), std::move(pli_records), threads) {}
 
     NonUCCList GetNonUCCs(hy::IdPairs const& comparison_suggestions) {
@@ -53,12 +53,12 @@ using model::RawUCC;
 bool Validator::IsUnique(model::PLI const& pivot_pli, RawUCC const& ucc,
                          hy::IdPairs& comparison_suggestions) {
     std::vector<hy::ClusterId> indices = util::BitsetToIndices<hy::ClusterId>(ucc);
-    for (model::PLI::Cluster const& cluster : pivot_pli.GetIndex()) {
+    for (model::PLI::ClusterView cluster : pivot_pli.GetIndex()) {
         auto cluster_to_record =
                 hy::MakeClusterIdentifierToTMap<model::PLI::Cluster::value_type>(cluster.size());
         for (auto const record_id : cluster) {
             std::vector<hy::ClusterId> cluster_id =
-                    hy::BuildClustersIdentifier((*compressed_records_)[record_id], indices);
+                    hy::BuildClustersIdentifier(*compressed_records_, record_id, indices);
             if (cluster_id.empty()) {
                 continue;
             }
@@ -19,7 +19,7 @@ private:
 
     UCCTree* tree_;
     hy::PLIsPtr plis_;
-    hy::RowsPtr compressed_records_;
+    hy::CompressedRecordsPtr compressed_records_;
     unsigned current_level_number_ = 1;
     config::ThreadNumType threads_num_ = 1;
 
@@ -31,7 +31,7 @@ private:
     UCCValidations ValidateAndExtend(std::vector<LhsPair> const& current_level);
 
 public:
-    Validator(UCCTree* tree, hy::PLIsPtr plis, hy::RowsPtr compressed_records,
+    Validator(UCCTree* tree, hy::PLIsPtr plis, hy::CompressedRecordsPtr compressed_records,
               config::ThreadNumType threads_num) noexcept
         : tree_(tree),
           plis_(std::move(plis)),
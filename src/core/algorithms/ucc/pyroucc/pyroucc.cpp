@@ -9,8 +9,10 @@
 #include "algorithms/fd/pyrocommon/core/key_g1_strategy.h"
 #include "config/error/option.h"
 #include "config/max_lhs/option.h"
+#include "config/mem_limit/option.h"
 #include "config/names_and_descriptions.h"
 #include "config/option_using.h"
+#include "model/table/pli_cache.h"
 
 namespace algos {
 
@@ -28,12 +30,14 @@ void PyroUCC::RegisterOptions() {
 
     RegisterOption(config::kErrorOpt(&parameters_.max_ucc_error));
     RegisterOption(config::kMaxLhsOpt(&parameters_.max_lhs));
+    RegisterOption(config::kMemLimitMbOpt(&parameters_.mem_limit_mb));
     RegisterOption(Option{&parameters_.seed, kSeed, kDSeed, 0});
 }
 
 void PyroUCC::MakeExecuteOptsAvailable() {
     using namespace config::names;
-    MakeOptionsAvailable({config::kMaxLhsOpt.GetName(), config::kErrorOpt.GetName(), kSeed});
+    MakeOptionsAvailable({config::kMaxLhsOpt.GetName(), config::kErrorOpt.GetName(),
+                          config::kMemLimitMbOpt.GetName(), kSeed});
 }
 
 void PyroUCC::LoadDataInternal() {
@@ -54,8 +58,7 @@ unsigned long long PyroUCC::ExecuteInternal() {
     auto schema = relation_->GetSchema();
 
     auto profiling_context = std::make_unique<ProfilingContext>(
-            parameters_, relation_.get(), ucc_consumer_, fd_consumer_, caching_method_,
-            eviction_method_, caching_method_value_);
+            parameters_, relation_.get(), ucc_consumer_, fd_consumer_, caching_method_);
 
     std::function<bool(DependencyCandidate const&, DependencyCandidate const&)> launch_pad_order;
     if (parameters_.launch_pad_order == "arity") {
@@ -91,6 +94,9 @@ unsigned long long PyroUCC::ExecuteInternal() {
     LOG(INFO) << "Init time: " << init_time_millis << "ms";
     LOG(INFO) << "Time: " << elapsed_milliseconds.count() << " milliseconds";
     LOG(INFO) << "Total intersection time: " << model::PositionListIndex::micros_ / 1000 << "ms";
+    model::PLICache const* pli_cache = profiling_context->GetPliCache();
+    LOG(INFO) << boost::format{"PLI cache: %1% hits, %2% misses, %3% evictions"} %
+                         pli_cache->GetHits() % pli_cache->GetMisses() % pli_cache->GetEvictions();
     return elapsed_milliseconds.count();
 }
 
@@ -17,8 +17,6 @@ private:
     std::unique_ptr<SearchSpace> search_space_;
 
     CachingMethod caching_method_ = CachingMethod::kCoin;
-    CacheEvictionMethod eviction_method_ = CacheEvictionMethod::kDefault;
-    double caching_method_value_;
 
     pyro::Parameters parameters_;
 
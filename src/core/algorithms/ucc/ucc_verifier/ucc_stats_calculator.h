@@ -28,7 +28,7 @@ public:
         clusters_violating_ucc_.clear();
     }
 
-    void CalculateStatistics(std::deque<model::PLI::Cluster> const &clusters) {
+    void CalculateStatistics(model::ClusterList const &clusters) {
         // size_t num_rows = relation_->GetNumRows();
 
         unsigned long long num_pairs_combinations = static_cast<unsigned long long>(num_rows_);
@@ -36,9 +36,9 @@ public:
             num_pairs_combinations *= (num_rows_ - 1);
         }
 
-        for (auto const &cluster : clusters) {
+        for (model::PLI::ClusterView cluster : clusters) {
             num_rows_violating_ucc_ += cluster.size();
-            clusters_violating_ucc_.push_back(cluster);
+            clusters_violating_ucc_.emplace_back(cluster.begin(), cluster.end());
             aucc_error_ += static_cast<double>(cluster.size()) * (cluster.size() - 1) /
                            num_pairs_combinations;
         }
@@ -67,7 +67,7 @@ public:
     }
 
     /* Returns error for aucc to hold*/
-    double GetAUCCError() {
+    double GetAUCCError() const {
         return aucc_error_;
     }
 };
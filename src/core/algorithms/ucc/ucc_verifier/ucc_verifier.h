@@ -27,7 +27,7 @@ private:
     std::vector<model::PLI::Cluster> clusters_violating_ucc_;
 
     void VerifyUCC();
-    void CalculateStatistics(std::deque<model::PLI::Cluster> const& clusters);
+    void CalculateStatistics(model::ClusterList const& clusters);
     void RegisterOptions();
     void LoadDataInternal() override;
     void MakeExecuteOptsAvailable() override;
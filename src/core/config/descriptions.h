@@ -109,4 +109,8 @@ constexpr auto kDInsertStatements = "Rows to be inserted into the table using th
 constexpr auto kDDeleteStatements = "Rows to be deleted from the table using the delete operation";
 constexpr auto kDUpdateStatements = "Rows to be replaced in the table using the update operation";
 constexpr auto kDNDWeight = "Weight of ND to verify (positive integer)";
+constexpr auto kDFds = "FDs to verify, pairs of LHS and RHS column indices";
+constexpr auto kDAfds =
+        "AFDs to verify, triples of LHS column indices, RHS column indices and the maximal error";
+constexpr auto kDUccs = "UCCs to verify, lists of column indices";
 }  // namespace config::descriptions
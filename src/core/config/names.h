@@ -62,4 +62,7 @@ constexpr auto kNumColumns = "num_columns";
 constexpr auto kInsertStatements = "insert";
 constexpr auto kDeleteStatements = "delete";
 constexpr auto kUpdateStatements = "update";
+constexpr auto kFds = "fds";
+constexpr auto kAfds = "afds";
+constexpr auto kUccs = "uccs";
 }  // namespace config::names
@@ -1,11 +1,23 @@
 #include "agree_set_factory.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
 #include <condition_variable>
+#include <cstdint>
+#include <limits>
 #include <shared_mutex>
+#include <span>
 #include <thread>
 #include <unordered_set>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/thread/shared_mutex.hpp>
@@ -22,6 +34,147 @@ namespace model {
 
 using std::set, std::vector, std::unordered_set;
 
+namespace {
+
+using AgreeSetWord = std::uint64_t;
+constexpr std::size_t kWordBits = std::numeric_limits<AgreeSetWord>::digits;
+/* Tuple pairs are compared in tiles of kTileSize x kTileSize, a match mask of a tile row fits
+ * into one word */
+constexpr std::size_t kTileSize = kWordBits;
+
+using PackedAgreeSet = vector<AgreeSetWord>;
+
+struct PackedAgreeSetHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::span<AgreeSetWord const> words) const noexcept {
+        return boost::hash_range(words.begin(), words.end());
+    }
+};
+
+struct PackedAgreeSetEqual {
+    using is_transparent = void;
+
+    bool operator()(std::span<AgreeSetWord const> lhs,
+                    std::span<AgreeSetWord const> rhs) const noexcept {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+};
+
+using PackedAgreeSets = unordered_set<PackedAgreeSet, PackedAgreeSetHash, PackedAgreeSetEqual>;
+
+/* Bit k of the result is set iff block[k] == value, block holds kTileSize values */
+AgreeSetWord MatchMask(int value, int const* block) {
+    AgreeSetWord mask = 0;
+#ifdef __AVX2__
+    __m256i const value_vect = _mm256_set1_epi32(value);
+    int constexpr vect_reg_size = 8;
+    for (std::size_t k = 0; k < kTileSize; k += vect_reg_size) {
+        __m256i const values = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(block + k));
+        __m256i const matches = _mm256_cmpeq_epi32(values, value_vect);
+        mask |= static_cast<AgreeSetWord>(_mm256_movemask_ps(_mm256_castsi256_ps(matches))) << k;
+    }
+#elif defined(__SSE2__)
+    __m128i const value_vect = _mm_set1_epi32(value);
+    int constexpr vect_reg_size = 4;
+    for (std::size_t k = 0; k < kTileSize; k += vect_reg_size) {
+        __m128i const values = _mm_loadu_si128(reinterpret_cast<__m128i const*>(block + k));
+        __m128i const matches = _mm_cmpeq_epi32(values, value_vect);
+        mask |= static_cast<AgreeSetWord>(_mm_movemask_ps(_mm_castsi128_ps(matches))) << k;
+    }
+#else
+    for (std::size_t k = 0; k < kTileSize; ++k) {
+        mask |= static_cast<AgreeSetWord>(block[k] == value) << k;
+    }
+#endif
+    return mask;
+}
+
+/* Probing tables of the tuples that share a value with some other tuple, stored column by
+ * column. Every column is padded to whole tiles with singleton values, that never match */
+class TupleBlocks {
+private:
+    std::size_t num_columns_;
+    std::size_t num_blocks_;
+    std::size_t column_size_;
+    vector<int> values_;
+
+    int const* GetBlock(std::size_t column, std::size_t block) const {
+        return values_.data() + column * column_size_ + block * kTileSize;
+    }
+
+public:
+    explicit TupleBlocks(ColumnLayoutRelationData const& relation)
+        : num_columns_(relation.GetNumColumns()) {
+        vector<ColumnData> const& columns_data = relation.GetColumnData();
+        vector<int> rows;
+        for (std::size_t row = 0; row < relation.GetNumRows(); ++row) {
+            if (std::any_of(columns_data.begin(), columns_data.end(), [row](ColumnData const& c) {
+                    return c.GetProbingTableValue(row) != PositionListIndex::kSingletonValueId;
+                })) {
+                rows.push_back(row);
+            }
+        }
+        num_blocks_ = (rows.size() + kTileSize - 1) / kTileSize;
+        column_size_ = num_blocks_ * kTileSize;
+        values_.assign(num_columns_ * column_size_, PositionListIndex::kSingletonValueId);
+        for (std::size_t column = 0; column < num_columns_; ++column) {
+            vector<int> const& probing_table = columns_data[column].GetProbingTable();
+            int* column_values = values_.data() + column * column_size_;
+            for (std::size_t i = 0; i < rows.size(); ++i) {
+                column_values[i] = probing_table[rows[i]];
+            }
+        }
+    }
+
+    std::size_t GetNumBlocks() const noexcept {
+        return num_blocks_;
+    }
+
+    /* Adds agree sets of pairs (i, j), i from first_block, j from second_block, i < j, that
+     * agree on at least one column */
+    void CollectAgreeSets(std::size_t first_block, std::size_t second_block,
+                          vector<AgreeSetWord>& tile, PackedAgreeSets& agree_sets) const {
+        std::size_t const words = (num_columns_ + kWordBits - 1) / kWordBits;
+        std::array<AgreeSetWord, kTileSize> matched{};
+        std::fill(tile.begin(), tile.end(), 0);
+        for (std::size_t column = 0; column < num_columns_; ++column) {
+            int const* first_values = GetBlock(column, first_block);
+            int const* second_values = GetBlock(column, second_block);
+            std::size_t const word = column / kWordBits;
+            AgreeSetWord const bit = AgreeSetWord{1} << (column % kWordBits);
+            for (std::size_t i = 0; i < kTileSize; ++i) {
+                int const value = first_values[i];
+                if (value == PositionListIndex::kSingletonValueId) continue;
+                AgreeSetWord mask = MatchMask(value, second_values);
+                if (first_block == second_block) {
+                    // only the pairs above the diagonal
+                    mask &= (~AgreeSetWord{0} << i) << 1;
+                }
+                matched[i] |= mask;
+                for (; mask != 0; mask &= mask - 1) {
+                    tile[(i * kTileSize + std::countr_zero(mask)) * words + word] |= bit;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < kTileSize; ++i) {
+            for (AgreeSetWord mask = matched[i]; mask != 0; mask &= mask - 1) {
+                auto const first = tile.begin() + (i * kTileSize + std::countr_zero(mask)) * words;
+                std::span<AgreeSetWord const> const agree_set(first, first + words);
+                if (agree_sets.find(agree_set) == agree_sets.end()) {
+                    agree_sets.emplace(agree_set.begin(), agree_set.end());
+                }
+            }
+        }
+    }
+
+    std::size_t GetTileWords() const noexcept {
+        return kTileSize * kTileSize * ((num_columns_ + kWordBits - 1) / kWordBits);
+    }
+};
+
+}  // namespace
+
 AgreeSetFactory::SetOfAgreeSets AgreeSetFactory::GenAgreeSets() const {
     auto start_time = std::chrono::system_clock::now();
     std::string method_str;
@@ -48,6 +201,11 @@ AgreeSetFactory::SetOfAgreeSets AgreeSetFactory::GenAgreeSets() const {
             agree_sets = GenAsUsingGetAgreeSets();
             break;
         }
+        case AgreeSetsGenMethod::kUsingTupleBlocks: {
+            method_str = "`kUsingTupleBlocks`";
+            agree_sets = GenAsUsingTupleBlocks();
+            break;
+        }
     }
 
     // metanome kostil, doesn't work properly in general
@@ -235,7 +393,7 @@ AgreeSetFactory::SetOfAgreeSets AgreeSetFactory::GenAsUsingGetAgreeSets() const
     // ~40436 ms on CIPublicHighway700 (Debug build)
     for (ColumnData const& column_data : columns_data) {
         PositionListIndex const* const pli = column_data.GetPositionListIndex();
-        for (vector<int> const& cluster : pli->GetIndex()) {
+        for (PositionListIndex::ClusterView cluster : pli->GetIndex()) {
             for (auto p = cluster.begin(); p != cluster.end(); ++p) {
                 for (auto q = std::next(p); q != cluster.end(); ++q) {
                     agree_sets.insert(GetAgreeSet(*p, *q));
@@ -247,6 +405,57 @@ AgreeSetFactory::SetOfAgreeSets AgreeSetFactory::GenAsUsingGetAgreeSets() const
     return agree_sets;
 }
 
+AgreeSetFactory::SetOfAgreeSets AgreeSetFactory::GenAsUsingTupleBlocks() const {
+    TupleBlocks const blocks(*relation_);
+    std::size_t const num_blocks = blocks.GetNumBlocks();
+    std::size_t const tasks_num = std::max<std::size_t>(
+            1, std::min<std::size_t>(config_.threads_num, num_blocks));
+    double const tiles_num = num_blocks * (num_blocks + 1) / 2.0;
+    vector<PackedAgreeSets> task_agree_sets(tasks_num);
+
+    // Row bands of the tile triangle are dealt from the longest one to balance the tasks
+    auto process_bands = [&](std::size_t task) {
+        vector<AgreeSetWord> tile(blocks.GetTileWords());
+        for (std::size_t band = task; band < num_blocks; band += tasks_num) {
+            std::size_t const second_block = num_blocks - 1 - band;
+            for (std::size_t first_block = 0; first_block <= second_block; ++first_block) {
+                blocks.CollectAgreeSets(first_block, second_block, tile, task_agree_sets[task]);
+            }
+            AddProgress(algos::FDAlgorithm::kTotalProgressPercent * (second_block + 1) /
+                        tiles_num);
+        }
+    };
+
+    if (tasks_num > 1) {
+        boost::asio::thread_pool pool(tasks_num);
+        for (std::size_t task = 0; task < tasks_num; ++task) {
+            boost::asio::post(pool, [&process_bands, task]() { process_bands(task); });
+        }
+        pool.join();
+    } else {
+        process_bands(0);
+    }
+
+    PackedAgreeSets& packed_agree_sets = task_agree_sets.front();
+    for (std::size_t task = 1; task < tasks_num; ++task) {
+        packed_agree_sets.merge(task_agree_sets[task]);
+    }
+
+    SetOfAgreeSets agree_sets;
+    agree_sets.reserve(packed_agree_sets.size());
+    for (PackedAgreeSet const& words : packed_agree_sets) {
+        boost::dynamic_bitset<> agree_set_indices(relation_->GetNumColumns());
+        for (std::size_t word = 0; word < words.size(); ++word) {
+            for (AgreeSetWord bits = words[word]; bits != 0; bits &= bits - 1) {
+                agree_set_indices.set(word * kWordBits + std::countr_zero(bits));
+            }
+        }
+        agree_sets.insert(relation_->GetSchema()->GetVertical(std::move(agree_set_indices)));
+    }
+
+    return agree_sets;
+}
+
 AgreeSet AgreeSetFactory::GetAgreeSet(int const tuple1_index, int const tuple2_index) const {
     std::vector<int> const tuple1 = relation_->GetTuple(tuple1_index);
     std::vector<int> const tuple2 = relation_->GetTuple(tuple2_index);
@@ -310,8 +519,10 @@ AgreeSetFactory::SetOfVectors AgreeSetFactory::GenMcUsingCalculateSupersets() co
         return max_representation;
     }
 
-    max_representation.insert(not_empty_pli->GetPositionListIndex()->GetIndex().begin(),
-                              not_empty_pli->GetPositionListIndex()->GetIndex().end());
+    for (PositionListIndex::ClusterView cluster :
+         not_empty_pli->GetPositionListIndex()->GetIndex()) {
+        max_representation.emplace(cluster.begin(), cluster.end());
+    }
 
     for (auto p = std::next(not_empty_pli); p != columns_data.end(); ++p) {
         PositionListIndex const* pli = p->GetPositionListIndex();
@@ -376,8 +587,9 @@ set<vector<int>, AgreeSetFactory::VectorComp> AgreeSetFactory::GenSortedEqvClass
 
     // Fill sorted_partitions
     for (ColumnData const& data : columns_data) {
-        std::deque<vector<int>> const& index = data.GetPositionListIndex()->GetIndex();
-        sorted_eqv_classes.insert(index.begin(), index.end());
+        for (PositionListIndex::ClusterView cluster : data.GetPositionListIndex()->GetIndex()) {
+            sorted_eqv_classes.emplace(cluster.begin(), cluster.end());
+        }
     }
 
     return sorted_eqv_classes;
@@ -546,13 +758,13 @@ void AgreeSetFactory::HandleEqvClass(vector<int>& eqv_class,
 
 void AgreeSetFactory::CalculateSupersets(
         std::unordered_set<std::vector<int>, boost::hash<std::vector<int>>>& max_representation,
-        std::deque<vector<int>> const& partition) const {
+        ClusterList const& partition) const {
     SetOfVectors to_add_to_mc;
     auto hash = [beg = max_representation.begin()](SetOfVectors::const_iterator it) {
         return std::distance<SetOfVectors::const_iterator>(beg, it);
     };
     unordered_set<SetOfVectors::const_iterator, decltype(hash)> to_delete_from_mc(1, hash);
-    set<std::deque<vector<int>>::const_iterator> to_exclude_from_partition;
+    set<ClusterList::const_iterator> to_exclude_from_partition;
 
     for (auto it = max_representation.begin(); it != max_representation.end(); ++it) {
         for (auto p = partition.begin();
@@ -561,19 +773,20 @@ void AgreeSetFactory::CalculateSupersets(
                 continue;
             }
 
-            if (it->size() >= p->size() &&
-                std::includes(it->begin(), it->end(), p->begin(), p->end())) {
-                to_add_to_mc.erase(*p);
+            vector<int> cluster((*p).begin(), (*p).end());
+            if (it->size() >= cluster.size() &&
+                std::includes(it->begin(), it->end(), cluster.begin(), cluster.end())) {
+                to_add_to_mc.erase(cluster);
                 to_exclude_from_partition.insert(p);
                 break;
             }
 
-            if (p->size() >= it->size() &&
-                std::includes(p->begin(), p->end(), it->begin(), it->end())) {
+            if (cluster.size() >= it->size() &&
+                std::includes(cluster.begin(), cluster.end(), it->begin(), it->end())) {
                 to_delete_from_mc.insert(it);
             }
 
-            to_add_to_mc.insert(*p);
+            to_add_to_mc.insert(std::move(cluster));
         }
     }
 
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <deque>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -64,6 +63,17 @@ enum class AgreeSetsGenMethod {
                                *  Metanome. For more information about maximal representation
                                *  check out http://www.vldb.org/pvldb/vol8/p1082-papenbrock.pdf
                                */
+    kUsingTupleBlocks,        /*< Compares all pairs of tuples directly, without maximal
+                               *  representation or identifier sets. Tuples that are unique in
+                               *  every attribute are dropped, the probing tables of the rest are
+                               *  copied column by column, and tuple pairs are processed in tiles
+                               *  of 64x64 pairs, so that both blocks of values stay in cache.
+                               *  Each value of a tile row is compared with the values of the
+                               *  tile column at once (with AVX2/SSE2 when available), and the
+                               *  resulting match masks are scattered into agree sets packed into
+                               *  64-bit words. Uses config_.threads_num threads, each one
+                               *  collects distinct agree sets of its own tiles.
+                               */
 };
 
 /* Max representation generation method */
@@ -162,6 +172,7 @@ private:
     SetOfAgreeSets GenAsUsingMapOfIdSets() const;
     SetOfAgreeSets GenAsUsingGetAgreeSets() const;
     SetOfAgreeSets GenAsUsingMcAndGetAgreeSets() const;
+    SetOfAgreeSets GenAsUsingTupleBlocks() const;
 
     /* Implementations of generation MC algorithms */
     SetOfVectors GenMcUsingHandleEqvClass() const;
@@ -171,7 +182,7 @@ private:
 
     void CalculateSupersets(
             std::unordered_set<std::vector<int>, boost::hash<std::vector<int>>>& max_representation,
-            std::deque<std::vector<int>> const& partition) const;
+            ClusterList const& partition) const;
     /* From Metanome: `handleList`.
      * Extremely slow for anything big eqv_class,
      * I think it is not usable at all
@@ -0,0 +1,238 @@
+#include "cell_type_classifier.h"
+
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+namespace {
+
+/* Delimiters of boost::gregorian::from_simple_string */
+constexpr std::string_view kDateSeparators = ",-. /";
+constexpr size_t kMaxIntDigits = 19;
+/* Plain decimals not longer than this can neither overflow nor underflow a double */
+constexpr size_t kMaxSafeDecimalLength = 300;
+constexpr unsigned kMaxUShort = std::numeric_limits<unsigned short>::max();
+constexpr std::array<std::string_view, 12> kShortMonthNames = {
+        "jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
+constexpr std::array<std::string_view, 12> kLongMonthNames = {
+        "january", "february", "march",     "april",   "may",      "june",
+        "july",    "august",   "september", "october", "november", "december"};
+
+bool IsDigit(char c) noexcept {
+    return c >= '0' && c <= '9';
+}
+
+/* Characters std::isspace accepts in the classic locale */
+bool IsSpace(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+char ToLower(char c) noexcept {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+/* Same as boost::lexical_cast<unsigned short>, but returns nothing instead of throwing */
+std::optional<unsigned> ParseUShort(std::string_view token) noexcept {
+    bool negative = false;
+    if (!token.empty() && (token.front() == '+' || token.front() == '-')) {
+        negative = token.front() == '-';
+        token.remove_prefix(1);
+    }
+    if (token.empty()) {
+        return std::nullopt;
+    }
+
+    unsigned value = 0;
+    for (char c : token) {
+        if (!IsDigit(c)) {
+            return std::nullopt;
+        }
+        value = value * 10 + (c - '0');
+        if (value > kMaxUShort) {
+            return std::nullopt;
+        }
+    }
+    // Negative values wrap around as for any unsigned type
+    return negative ? (kMaxUShort + 1 - value) % (kMaxUShort + 1) : value;
+}
+
+/* Same as month_str_to_ushort from boost/date_time, unknown names give 13 */
+std::optional<unsigned> ParseMonth(std::string_view token) noexcept {
+    if (IsDigit(token.front())) {
+        return ParseUShort(token);
+    }
+
+    auto const equals_ignore_case = [token](std::string_view name) {
+        if (name.size() != token.size()) {
+            return false;
+        }
+        for (size_t i = 0; i != name.size(); ++i) {
+            if (ToLower(token[i]) != name[i]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (unsigned month = 0; month != kShortMonthNames.size(); ++month) {
+        if (equals_ignore_case(kShortMonthNames[month]) ||
+            equals_ignore_case(kLongMonthNames[month])) {
+            return month + 1;
+        }
+    }
+    return 13;
+}
+
+/* Checks that boost::gregorian::date can be constructed from these values */
+bool IsValidDate(std::optional<unsigned> year, std::optional<unsigned> month,
+                 std::optional<unsigned> day) noexcept {
+    if (!year || !month || !day) {
+        return false;
+    }
+    if (*year < 1400 || *year > 9999 || *month < 1 || *month > 12 || *day < 1) {
+        return false;
+    }
+
+    constexpr std::array<unsigned, 12> kDaysInMonth = {31, 28, 31, 30, 31, 30,
+                                                       31, 31, 30, 31, 30, 31};
+    bool const is_leap = *year % 4 == 0 && (*year % 100 != 0 || *year % 400 == 0);
+    unsigned const days_in_month = kDaysInMonth[*month - 1] + (*month == 2 && is_leap ? 1 : 0);
+    return *day <= days_in_month;
+}
+
+/* boost::gregorian::from_undelimited_string reads the first 8 characters as yyyymmdd, its
+ * tokenizer also accepts a day of a single character at the end of the string
+ */
+bool IsUndelimitedDate(std::string_view cell) noexcept {
+    if (cell.size() < 7) {
+        return false;
+    }
+    return IsValidDate(ParseUShort(cell.substr(0, 4)), ParseUShort(cell.substr(4, 2)),
+                       ParseUShort(cell.substr(6, 2)));
+}
+
+/* Same as checking std::stod consumes the whole string, but without exceptions */
+bool IsConsumedByStod(std::string const& value) noexcept {
+    // Cheap rejection of strings std::strtod would not start to parse
+    size_t start = 0;
+    while (start != value.size() && IsSpace(value[start])) {
+        ++start;
+    }
+    if (start != value.size() && (value[start] == '+' || value[start] == '-')) {
+        ++start;
+    }
+    if (start == value.size()) {
+        return false;
+    }
+    char const first = ToLower(value[start]);
+    if (!IsDigit(first) && first != '.' && first != 'i' && first != 'n') {
+        return false;
+    }
+
+    int const saved_errno = errno;
+    errno = 0;
+    char const* const begin = value.c_str();
+    char* end = nullptr;
+    std::strtod(begin, &end);
+    bool const is_double = end != begin && errno != ERANGE &&
+                           static_cast<size_t>(end - begin) == value.size();
+    errno = saved_errno;
+    return is_double;
+}
+
+}  // namespace
+
+namespace model {
+
+bool CellTypes::Has(TypeId type_id) const noexcept {
+    switch (type_id) {
+        case TypeId::kDate:
+            return IsDate();
+        case TypeId::kInt:
+            return is_int;
+        case TypeId::kBigInt:
+            return is_big_int;
+        case TypeId::kDouble:
+            return is_double;
+        default:
+            return false;
+    }
+}
+
+TypeId CellTypes::GetFirstMatch() const noexcept {
+    if (IsDate()) {
+        return TypeId::kDate;
+    }
+    if (is_int) {
+        return TypeId::kInt;
+    }
+    if (is_big_int) {
+        return TypeId::kBigInt;
+    }
+    if (is_double) {
+        return TypeId::kDouble;
+    }
+    return TypeId::kString;
+}
+
+CellTypes ClassifyCell(std::string const& value) noexcept {
+    CellTypes types;
+    if (value.empty()) {
+        types.is_empty = true;
+        return types;
+    }
+    if (value == Null::kValue) {
+        types.is_null = true;
+        return types;
+    }
+
+    std::string_view const cell = value;
+    size_t const sign_length = (cell.front() == '+' || cell.front() == '-') ? 1 : 0;
+    size_t digits = 0;
+    size_t points = 0;
+    bool only_digits_and_points = true;
+    std::array<std::string_view, 3> date_tokens;
+    size_t date_tokens_num = 0;
+    size_t token_begin = 0;
+    for (size_t i = 0; i != cell.size(); ++i) {
+        char const c = cell[i];
+        if (IsDigit(c)) {
+            ++digits;
+        } else if (c == '.') {
+            ++points;
+        } else if (i >= sign_length) {
+            only_digits_and_points = false;
+        }
+
+        if (kDateSeparators.find(c) != std::string_view::npos) {
+            if (token_begin != i && date_tokens_num != date_tokens.size()) {
+                date_tokens[date_tokens_num++] = cell.substr(token_begin, i - token_begin);
+            }
+            token_begin = i + 1;
+        }
+    }
+    if (token_begin != cell.size() && date_tokens_num != date_tokens.size()) {
+        date_tokens[date_tokens_num++] = cell.substr(token_begin);
+    }
+
+    bool const is_integer = only_digits_and_points && points == 0 && digits != 0;
+    types.is_int = is_integer && digits <= kMaxIntDigits;
+    types.is_big_int = is_integer && digits > kMaxIntDigits;
+    if (only_digits_and_points && points <= 1 && digits != 0 &&
+        cell.size() <= kMaxSafeDecimalLength) {
+        types.is_double = true;
+    } else {
+        types.is_double = IsConsumedByStod(value);
+    }
+
+    types.is_delimited_date =
+            date_tokens_num == date_tokens.size() &&
+            IsValidDate(ParseUShort(date_tokens[0]), ParseMonth(date_tokens[1]),
+                        ParseUShort(date_tokens[2]));
+    types.is_undelimited_date = IsUndelimitedDate(cell);
+    return types;
+}
+
+}  // namespace model
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+
+#include "model/types/builtin.h"
+
+namespace model {
+
+/* Every type a single cell can be parsed as. The rules are those of the type parsers:
+ * ints and big ints are optionally signed sequences of at most 19 and at least 20 digits,
+ * doubles are strings std::stod consumes entirely and dates are strings accepted by
+ * boost::gregorian::from_simple_string or boost::gregorian::from_undelimited_string.
+ * Null and empty cells are not parsed as any other type.
+ */
+struct CellTypes {
+    bool is_null = false;
+    bool is_empty = false;
+    bool is_int = false;
+    bool is_big_int = false;
+    bool is_double = false;
+    bool is_delimited_date = false;
+    bool is_undelimited_date = false;
+
+    bool IsDate() const noexcept {
+        return is_delimited_date || is_undelimited_date;
+    }
+
+    /* Only kDate, kInt, kBigInt and kDouble can be checked */
+    bool Has(TypeId type_id) const noexcept;
+
+    /* The first of date, int, big int and double the cell can be parsed as, string if none
+     * of them fits. Must not be called for null and empty cells.
+     */
+    TypeId GetFirstMatch() const noexcept;
+};
+
+/* Classifies the cell in a single scan, without allocations or exceptions for all but very
+ * long numeric values, which are handed over to std::strtod.
+ */
+CellTypes ClassifyCell(std::string const& value) noexcept;
+
+}  // namespace model
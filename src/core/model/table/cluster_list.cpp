@@ -0,0 +1,34 @@
+#include "cluster_list.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace model {
+
+void ClusterList::SortByFirstRow() {
+    auto const first_row = [this](unsigned cluster) { return rows_[offsets_[cluster]]; };
+    std::vector<unsigned> order(size());
+    std::iota(order.begin(), order.end(), 0);
+    auto const by_first_row = [&first_row](unsigned a, unsigned b) {
+        return first_row(a) < first_row(b);
+    };
+    if (std::is_sorted(order.begin(), order.end(), by_first_row)) {
+        return;
+    }
+    std::sort(order.begin(), order.end(), by_first_row);
+
+    std::vector<int> rows;
+    std::vector<unsigned> offsets;
+    rows.reserve(rows_.size());
+    offsets.reserve(offsets_.size());
+    offsets.push_back(0);
+    for (unsigned cluster : order) {
+        rows.insert(rows.end(), rows_.begin() + offsets_[cluster],
+                    rows_.begin() + offsets_[cluster + 1]);
+        offsets.push_back(rows.size());
+    }
+    rows_ = std::move(rows);
+    offsets_ = std::move(offsets);
+}
+
+}  // namespace model
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace model {
+
+/* Clusters of a partition stored back to back in a single array of row indices with an array
+ * of cluster offsets (CSR layout): the i-th cluster occupies [offsets_[i], offsets_[i + 1])
+ * of rows_. Clusters are handed out as spans, so the whole partition takes two allocations
+ * and traversing it is a linear scan.
+ */
+class ClusterList {
+public:
+    using View = std::span<int const>;
+    using MutableView = std::span<int>;
+
+    template <typename Span>
+    class Iterator {
+    private:
+        typename Span::pointer rows_ = nullptr;
+        unsigned const* offset_ = nullptr;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Span;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Span;
+
+        Iterator() = default;
+
+        Iterator(typename Span::pointer rows, unsigned const* offset) noexcept
+            : rows_(rows), offset_(offset) {}
+
+        Span operator*() const noexcept {
+            return Span(rows_ + offset_[0], offset_[1] - offset_[0]);
+        }
+
+        Span operator[](difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        Iterator& operator++() noexcept {
+            ++offset_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator old = *this;
+            ++offset_;
+            return old;
+        }
+
+        Iterator& operator--() noexcept {
+            --offset_;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept {
+            Iterator old = *this;
+            --offset_;
+            return old;
+        }
+
+        Iterator& operator+=(difference_type n) noexcept {
+            offset_ += n;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n) noexcept {
+            offset_ -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(Iterator const& a, Iterator const& b) noexcept {
+            return a.offset_ - b.offset_;
+        }
+
+        friend bool operator==(Iterator const& a, Iterator const& b) noexcept {
+            return a.offset_ == b.offset_;
+        }
+
+        friend auto operator<=>(Iterator const& a, Iterator const& b) noexcept {
+            return a.offset_ <=> b.offset_;
+        }
+    };
+
+    using iterator = Iterator<MutableView>;
+    using const_iterator = Iterator<View>;
+
+private:
+    std::vector<int> rows_;
+    std::vector<unsigned> offsets_{0};
+
+public:
+    ClusterList() = default;
+
+    /* offsets must start with 0 and end with rows.size() */
+    ClusterList(std::vector<int> rows, std::vector<unsigned> offsets)
+        : rows_(std::move(rows)), offsets_(std::move(offsets)) {
+        assert(!offsets_.empty() && offsets_.front() == 0 && offsets_.back() == rows_.size());
+    }
+
+    void Reserve(size_t rows_num, size_t clusters_num) {
+        rows_.reserve(rows_num);
+        offsets_.reserve(clusters_num + 1);
+    }
+
+    template <typename It>
+    void PushBack(It first, It last) {
+        rows_.insert(rows_.end(), first, last);
+        offsets_.push_back(rows_.size());
+    }
+
+    void PushBack(View cluster) {
+        PushBack(cluster.begin(), cluster.end());
+    }
+
+    /* Reorders clusters by their first row, keeping the rows of each cluster in place */
+    void SortByFirstRow();
+
+    size_t size() const noexcept {
+        return offsets_.size() - 1;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /* Total number of rows in all clusters */
+    size_t GetNumRows() const noexcept {
+        return rows_.size();
+    }
+
+    /* Rows of all clusters, cluster after cluster */
+    std::vector<int> const& GetRows() const noexcept {
+        return rows_;
+    }
+
+    std::vector<unsigned> const& GetOffsets() const noexcept {
+        return offsets_;
+    }
+
+    View operator[](size_t index) const noexcept {
+        return *(begin() + index);
+    }
+
+    MutableView operator[](size_t index) noexcept {
+        return *(begin() + index);
+    }
+
+    View front() const noexcept {
+        return (*this)[0];
+    }
+
+    View back() const noexcept {
+        return (*this)[size() - 1];
+    }
+
+    const_iterator begin() const noexcept {
+        return {rows_.data(), offsets_.data()};
+    }
+
+    const_iterator end() const noexcept {
+        return {rows_.data(), offsets_.data() + size()};
+    }
+
+    iterator begin() noexcept {
+        return {rows_.data(), offsets_.data()};
+    }
+
+    iterator end() noexcept {
+        return {rows_.data(), offsets_.data() + size()};
+    }
+};
+
+}  // namespace model
@@ -7,6 +7,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
 #include <numeric>
 #include <string>
 
@@ -21,23 +26,33 @@ namespace model {
 
 using PartitionReader = DomainPartition::PartitionReader;
 
+namespace {
+/// size of the buffer used to write a swap file
+constexpr size_t kWriteBufferSize = 1UL << 20UL;
+
+/*
+ * Swap file is a sorted run: the number of values followed by the values,
+ * each prefixed by its length
+ */
+using RunValuesCount = uint64_t;
+using RunValueSize = uint32_t;
+}  // namespace
+
 /// reader for reading data from main memory
 class MemoryBackedReader final : public PartitionReader {
-public:
-    using Values = DomainPartition::Values;
-
 private:
-    using It = Values::iterator;
-
-    It cur_, end_;
+    std::vector<char> const& data_;
+    std::vector<DomainPartition::ValueRef>::const_iterator cur_, end_;
 
 public:
-    explicit MemoryBackedReader(Values const& values) : cur_(values.begin()), end_(values.end()) {
+    MemoryBackedReader(std::vector<char> const& data,
+                       std::vector<DomainPartition::ValueRef> const& values)
+        : data_(data), cur_(values.begin()), end_(values.end()) {
         assert(cur_ != end_);
     }
 
-    Value const& GetValue() const noexcept final {
-        return *cur_;
+    Value GetValue() const noexcept final {
+        return {data_.data() + cur_->offset, cur_->size};
     }
 
     bool HasNext() const noexcept final {
@@ -53,26 +68,57 @@ public:
 class FileBackedReader final : public PartitionReader {
 private:
     std::ifstream file_;
-    Value cur_;
+    std::vector<char> buffer_;
+    size_t buffer_pos_ = 0;
+    size_t buffer_end_ = 0;
+    RunValuesCount remaining_count_; /* values after the current one */
+    std::string cur_;
+
+    void FillBuffer() {
+        file_.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        buffer_pos_ = 0;
+        buffer_end_ = file_.gcount();
+        if (buffer_end_ == 0) {
+            throw std::runtime_error("Unexpected end of swap file");
+        }
+    }
+
+    void Read(char* dest, size_t count) {
+        while (count != 0) {
+            if (buffer_pos_ == buffer_end_) FillBuffer();
+            size_t const chunk = std::min(count, buffer_end_ - buffer_pos_);
+            std::memcpy(dest, buffer_.data() + buffer_pos_, chunk);
+            buffer_pos_ += chunk;
+            dest += chunk;
+            count -= chunk;
+        }
+    }
 
 public:
-    explicit FileBackedReader(std::filesystem::path const& path) : file_(path) {
+    FileBackedReader(std::filesystem::path const& path, size_t buffer_size)
+        : file_(path, std::ios::binary), buffer_(buffer_size) {
         if (!file_.is_open()) {
             throw std::runtime_error("Error opening file");
         }
+        Read(reinterpret_cast<char*>(&remaining_count_), sizeof(remaining_count_));
+        assert(remaining_count_ != 0);
         MoveToNext();
     }
 
-    Value const& GetValue() const final {
+    Value GetValue() const final {
         return cur_;
     }
 
     bool HasNext() const final {
-        return !file_.eof();
+        return remaining_count_ != 0;
     }
 
     void MoveToNext() final {
-        std::getline(file_, cur_);
+        RunValueSize size;
+        Read(reinterpret_cast<char*>(&size), sizeof(size));
+        cur_.resize(size);
+        Read(cur_.data(), size);
+        --remaining_count_;
     }
 };
 
@@ -82,33 +128,39 @@ DomainPartition::~DomainPartition() {
     }
 }
 
-std::unique_ptr<PartitionReader> DomainPartition::GetReader() const {
+std::unique_ptr<PartitionReader> DomainPartition::GetReader(size_t buffer_size) const {
     if (IsSwapped()) {
-        return std::make_unique<FileBackedReader>(*swap_file_);
+        return std::make_unique<FileBackedReader>(*swap_file_, buffer_size);
     } else {
-        return std::make_unique<MemoryBackedReader>(values_);
+        return std::make_unique<MemoryBackedReader>(data_, values_);
     }
 }
 
-size_t DomainPartition::GetMemoryUsage() const noexcept {
-    /* in reality, node in std::set uses 2.2 more memory than the presented estimate */
-    static constexpr double kAverageOverhead = 2.2;
-
-    if (IsSwapped()) return 0;
-
-    size_t const data_total_size = std::accumulate(
-            values_.begin(), values_.end(), 0UL, [](size_t acc, std::string const& str) {
-                /*
-                 * if the string is small enough, then the SSO works
-                 * and the memory is not allocated on the heap
-                 */
-                return acc + (str.size() != str.capacity() ? 0 : str.capacity());
-            });
-
-    size_t const node_size =
-            values_.size() * (sizeof(std::string) + sizeof(Values::node_type)) * kAverageOverhead;
-
-    return node_size + data_total_size;
+void DomainPartition::Compact() {
+    if (sorted_count_ == values_.size()) return;
+    auto const less = [this](ValueRef lhs, ValueRef rhs) { return GetValue(lhs) < GetValue(rhs); };
+    auto const equal = [this](ValueRef lhs, ValueRef rhs) {
+        return GetValue(lhs) == GetValue(rhs);
+    };
+    auto const unsorted_begin = values_.begin() + static_cast<std::ptrdiff_t>(sorted_count_);
+    std::sort(unsorted_begin, values_.end(), less);
+    std::inplace_merge(values_.begin(), unsorted_begin, values_.end(), less);
+    values_.erase(std::unique(values_.begin(), values_.end(), equal), values_.end());
+
+    /* rewrite the buffer, so that only distinct values remain, in sorted order */
+    size_t const data_size =
+            std::accumulate(values_.begin(), values_.end(), 0UL,
+                            [](size_t acc, ValueRef ref) { return acc + ref.size; });
+    std::vector<char> data;
+    data.reserve(data_size);
+    for (ValueRef& ref : values_) {
+        Value const value = GetValue(ref);
+        ref.offset = data.size();
+        data.insert(data.end(), value.begin(), value.end());
+    }
+    data_ = std::move(data);
+    values_.shrink_to_fit();
+    sorted_count_ = values_.size();
 }
 
 bool DomainPartition::TrySwap() {
@@ -116,24 +168,49 @@ bool DomainPartition::TrySwap() {
     if (IsNULL() || IsSwapped()) {
         return false;
     }
+    Compact();
     fs::create_directory(kTmpDir);
     fs::path const file_path = fs::path{kTmpDir} /
                                (std::to_string(GetTableId()) + "." + std::to_string(GetColumnId()) +
                                 "." + std::to_string(GetPartitionId()));
-    std::ofstream file{file_path};
+    std::ofstream file{file_path, std::ios::binary};
     if (!file.is_open()) {
         LOG(ERROR) << "unable to open file for swapping";
         throw std::runtime_error("Cannot open file for swapping");
     }
 
-    for (auto it = values_.begin(); it != values_.end(); ++it) {
-        file << *it;
-        if (std::next(it) != values_.end()) {
-            file << '\n';
+    std::vector<char> buffer;
+    buffer.reserve(kWriteBufferSize);
+    auto const write = [&file, &buffer](char const* src, size_t count) {
+        if (buffer.size() + count > kWriteBufferSize) {
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+        if (count > kWriteBufferSize) {
+            file.write(src, static_cast<std::streamsize>(count));
+        } else {
+            buffer.insert(buffer.end(), src, src + count);
         }
+    };
+    RunValuesCount const count = values_.size();
+    write(reinterpret_cast<char const*>(&count), sizeof(count));
+    for (ValueRef ref : values_) {
+        if (ref.size > std::numeric_limits<RunValueSize>::max()) {
+            throw std::runtime_error("Value is too long to be swapped");
+        }
+        RunValueSize const size = static_cast<RunValueSize>(ref.size);
+        write(reinterpret_cast<char const*>(&size), sizeof(size));
+        write(data_.data() + ref.offset, ref.size);
     }
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
     file.close();
-    values_.clear();
+    if (file.fail()) {
+        throw std::runtime_error("Cannot write swap file");
+    }
+
+    data_ = {};
+    values_ = {};
+    sorted_count_ = 0;
     swap_file_ = std::make_unique<fs::path>(file_path);
     return true;
 }
@@ -156,6 +233,7 @@ private:
     std::vector<DomainRawData> raw_domains_; /* current table domains */
     size_t processed_block_count_{};         /* count of processed blocks in current table */
     size_t swap_candidate_{};                /* next domain candidate to swap  */
+    bool compacted_{};                       /* current domains compacted since last swap */
 
     /* recalculate memory usage */
     void RefreshMemUsage() {
@@ -177,7 +255,8 @@ private:
             return std::max(1UL, mem_limit_ / approx_block_count);
         }
         /* otherwise, use the average amount of memory spent per processed block */
-        size_t const per_block_mem_usage = mem_usage_ / processed_block_count_;
+        if (mem_usage_ >= mem_limit_) return 0;
+        size_t const per_block_mem_usage = std::max(1UL, mem_usage_ / processed_block_count_);
         return (mem_limit_ - mem_usage_) / per_block_mem_usage;
     }
 
@@ -204,7 +283,15 @@ private:
             ++swap_candidate_;
             return;
         }
+        /* first, remove the duplicates from current table domains, it may free enough memory */
+        if (!compacted_) {
+            CompactCurrentDomains();
+            compacted_ = true;
+            RefreshMemUsage();
+            return;
+        }
         /* swap current table domains */
+        compacted_ = false;
         for (DomainRawData& raw_domain : raw_domains_) {
             Partition& partition = raw_domain.back();
             /* if the partition is empty, then it will not be swapped */
@@ -217,6 +304,12 @@ private:
         processed_block_count_ = 0;
     }
 
+    /* sort and deduplicate the values of the current table domains in memory */
+    void CompactCurrentDomains() {
+        util::ParallelForeach(raw_domains_.begin(), raw_domains_.end(), threads_num_,
+                              [](DomainRawData& raw_domain) { raw_domain.back().Compact(); });
+    }
+
     /* process next `block_count` blocks */
     bool ProcessNext(BlockDatasetStream<DatasetStreamFixed<>>& block_stream, size_t block_count) {
         while (block_count != 0 && block_stream.HasNextBlock()) {
@@ -225,7 +318,7 @@ private:
                 Partition& partition = raw_domain.back();
                 auto it = block.GetColumn(partition.GetColumnId()).GetIt();
                 do {
-                    partition.Insert(std::string{it.GetValue()});
+                    partition.Insert(it.GetValue());
                 } while (it.TryMoveToNext());
             };
             util::ParallelForeach(raw_domains_.begin(), raw_domains_.end(), threads_num_,
@@ -272,12 +365,14 @@ public:
 
         RawDomainsInit(table_id, col_count);
         processed_block_count_ = 0;
+        compacted_ = false;
         size_t block_count = 0;
         BlockDatasetStream<DatasetStreamFixed<>> block_stream{stream, block_capacity_};
         do {
             processed_block_count_ += block_count;
             block_count = GetNumberOfBlocks();
         } while (ProcessNext(block_stream, block_count));
+        CompactCurrentDomains();
 
         for (DomainRawData& raw_domain : raw_domains_) {
             /*
@@ -294,6 +389,20 @@ public:
 
     /// get processed domains
     std::vector<ColumnDomain>&& GetDomains() && {
+        /* the memory left is shared by the buffers of the swapped partitions readers */
+        RefreshMemUsage();
+        size_t const swapped_count = std::accumulate(
+                domains_.begin(), domains_.end(), 0UL, [](size_t acc, Domain const& domain) {
+                    return acc + std::count_if(domain.GetData().begin(), domain.GetData().end(),
+                                               std::mem_fn(&Partition::IsSwapped));
+                });
+        size_t const free_mem = mem_limit_ > mem_usage_ ? mem_limit_ - mem_usage_ : 0;
+        size_t const read_buffer_size =
+                std::clamp(free_mem / std::max(1UL, swapped_count), Domain::kMinReadBufferSize,
+                           Domain::kMaxReadBufferSize);
+        for (Domain& domain : domains_) {
+            domain.SetReadBufferSize(read_buffer_size);
+        }
         return std::move(domains_);
     }
 };
@@ -10,8 +10,8 @@
 #include <list>
 #include <memory>
 #include <numeric>
-#include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "column_combination.h"
@@ -26,8 +26,7 @@ using PartitionIndex = unsigned int;
 /// column domain partition storing values in sorted order
 class DomainPartition {
 public:
-    using Value = std::string;
-    using Values = std::set<Value>;
+    using Value = std::string_view;
 
     ///
     /// @brief abstract reader class for receiving partition values
@@ -36,6 +35,12 @@ public:
     /// This class is required to provide a single interface for reading values from
     /// the partition.
     ///
+    /// location of a value in the chars buffer
+    struct ValueRef {
+        size_t offset;
+        size_t size;
+    };
+
     class PartitionReader {
     public:
         using Value = DomainPartition::Value;
@@ -44,7 +49,7 @@ public:
         PartitionReader() = default;
         virtual ~PartitionReader() = default;
 
-        virtual Value const& GetValue() const = 0;
+        virtual Value GetValue() const = 0;
         virtual bool HasNext() const = 0;
         virtual void MoveToNext() = 0;
 
@@ -61,11 +66,18 @@ private:
     };
 
     PartitionInfo info_;
-    Values values_;
+    std::vector<char> data_;       /* values stored as a serial chars buffer */
+    std::vector<ValueRef> values_; /* values, the first `sorted_count_` are sorted and distinct */
+    size_t sorted_count_ = 0;
+    bool has_non_null_ = false;
     std::unique_ptr<std::filesystem::path> swap_file_;
 
     static constexpr std::string_view kTmpDir = "tmp";
 
+    Value GetValue(ValueRef ref) const noexcept {
+        return {data_.data() + ref.offset, ref.size};
+    }
+
 public:
     DomainPartition(TableIndex table_id, ColumnIndex column_id, PartitionIndex partition_id = 0)
         : info_({table_id, column_id, partition_id}) {}
@@ -73,14 +85,19 @@ public:
     ~DomainPartition();
 
     /// how many bytes partition takes to store one char in the partition
-    /// this value was obtained experimentally, the worst case is presented
-    static constexpr double kMaximumBytesPerChar = 16.0;
+    /// in the worst case every char is a separate value, so it takes a value reference
+    static constexpr double kMaximumBytesPerChar = 1.0 + sizeof(ValueRef);
 
     /// insert new value to partition
-    void Insert(Value const& value) {
-        values_.insert(value);
+    void Insert(Value value) {
+        values_.push_back({data_.size(), value.size()});
+        data_.insert(data_.end(), value.begin(), value.end());
+        has_non_null_ |= !value.empty();
     }
 
+    /// sort values and remove duplicates, releasing the memory they take
+    void Compact();
+
     /// get table index
     TableIndex GetTableId() const noexcept {
         return info_.table_id;
@@ -101,12 +118,16 @@ public:
     /// a partition is not null if and only if it contains
     /// non-null values (null value is empty string)
     bool IsNULL() const noexcept {
-        return (values_.empty() || (values_.size() == 1 && values_.begin()->empty())) &&
-               !IsSwapped();
+        return !has_non_null_;
     }
 
     /// get memory usage in bytes
-    size_t GetMemoryUsage() const noexcept;
+    size_t GetMemoryUsage() const noexcept {
+        if (IsSwapped()) return 0;
+        return data_.capacity() + values_.capacity() * sizeof(ValueRef);
+    }
+
+    /// compact the partition and write it to disk as a sorted run,
     /// returns true if partition was swapped and false otherwise
     bool TrySwap();
 
@@ -115,8 +136,8 @@ public:
         return static_cast<bool>(swap_file_);
     }
 
-    /// create partition reader
-    std::unique_ptr<PartitionReader> GetReader() const;
+    /// create partition reader, a swapped partition is read through a buffer of the given size
+    std::unique_ptr<PartitionReader> GetReader(size_t buffer_size) const;
 };
 
 /// represents a column domain
@@ -125,8 +146,9 @@ public:
     using RawData = std::list<DomainPartition>;
 
 private:
-    RawData raw_data_; /* raw domain data */
-    size_t mem_usage_; /* memory usage in bytes */
+    RawData raw_data_;                             /* raw domain data */
+    size_t mem_usage_;                             /* memory usage in bytes */
+    size_t read_buffer_size_ = kMaxReadBufferSize; /* swapped partitions read buffer */
 
     void RefreshMemoryUsage() {
         mem_usage_ = std::accumulate(raw_data_.begin(), raw_data_.end(), 0UL,
@@ -136,6 +158,10 @@ private:
     }
 
 public:
+    /// bounds of the buffer used to read a swapped partition
+    static constexpr size_t kMinReadBufferSize = 4UL << 10UL;
+    static constexpr size_t kMaxReadBufferSize = 1UL << 20UL;
+
     explicit ColumnDomain(RawData&& raw_data) : raw_data_(std::move(raw_data)) {
         assert(!raw_data_.empty());
         RefreshMemoryUsage();
@@ -161,6 +187,15 @@ public:
         return mem_usage_;
     }
 
+    /// get the size of the buffer used to read a swapped partition
+    size_t GetReadBufferSize() const noexcept {
+        return read_buffer_size_;
+    }
+
+    void SetReadBufferSize(size_t read_buffer_size) noexcept {
+        read_buffer_size_ = read_buffer_size;
+    }
+
     /// swap domain to disk and update memory usage
     void Swap() {
         for (DomainPartition& partition : raw_data_) {
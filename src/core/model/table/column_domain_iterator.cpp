@@ -10,11 +10,11 @@
 namespace model {
 
 std::vector<std::unique_ptr<ColumnDomainIterator::Reader>> ColumnDomainIterator::CreateReaders(
-        ColumnDomain::RawData const& domain_data) {
+        ColumnDomain const& domain) {
     std::vector<std::unique_ptr<Reader>> readers;
-    for (DomainPartition const& partition : domain_data) {
+    for (DomainPartition const& partition : domain.GetData()) {
         if (!partition.IsNULL()) {
-            readers.push_back(partition.GetReader());
+            readers.push_back(partition.GetReader(domain.GetReadBufferSize()));
         }
     }
     return readers;
@@ -31,7 +31,7 @@ ColumnDomainIterator::ReaderPQ ColumnDomainIterator::CreateReadersPQ(
 
 ColumnDomainIterator::ColumnDomainIterator(ColumnDomain const& domain)
     : domain_(domain),
-      readers_(CreateReaders(domain_.get().GetData())),
+      readers_(CreateReaders(domain_.get())),
       readers_pq_(CreateReadersPQ(readers_)) {
     MoveToNext();
 }
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <queue>
+#include <string>
 #include <vector>
 
 #include "column_domain.h"
@@ -17,7 +18,7 @@ namespace model {
 class ColumnDomainIterator {
 private:
     using Reader = DomainPartition::PartitionReader;
-    using Value = Reader::Value;
+    using Value = std::string;
 
     static bool ReaderGreater(Reader const* lhs, Reader const* rhs) {
         return lhs->GetValue() > rhs->GetValue();
@@ -30,8 +31,7 @@ private:
     ReaderPQ readers_pq_;
     Value value_;
 
-    static std::vector<std::unique_ptr<Reader>> CreateReaders(
-            ColumnDomain::RawData const& domain_data);
+    static std::vector<std::unique_ptr<Reader>> CreateReaders(ColumnDomain const& domain);
     static ReaderPQ CreateReadersPQ(std::vector<std::unique_ptr<Reader>> const& readers);
 
 public:
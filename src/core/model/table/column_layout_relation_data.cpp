@@ -4,49 +4,75 @@
 //
 #include "column_layout_relation_data.h"
 
+#include <cstddef>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <semaphore>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <easylogging++.h>
 
-std::vector<int> ColumnLayoutRelationData::GetTuple(int tuple_index) const {
-    int num_columns = schema_->GetNumColumns();
-    std::vector<int> tuple = std::vector<int>(num_columns);
-    for (int column_index = 0; column_index < num_columns; column_index++) {
-        tuple[column_index] = column_data_[column_index].GetProbingTableValue(tuple_index);
+namespace {
+
+using ColumnVectors = std::vector<std::vector<int>>;
+
+struct StringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view value) const noexcept {
+        return std::hash<std::string_view>{}(value);
     }
-    return tuple;
+};
+
+/* Looked up by the views of a row, a key is only allocated for a new value */
+using ValueDictionary = std::unordered_map<std::string, int, StringHash, std::equal_to<>>;
+
+/* Number of rows handed to one encoding task by the parallel loader */
+constexpr size_t kRowsPerChunk = 1 << 14;
+/* Streams that can be split are split into more parts than threads to even out the load */
+constexpr size_t kPartsPerThread = 4;
+/* Chunks read but not encoded yet, per thread, when a stream is read on one thread */
+constexpr std::ptrdiff_t kChunksInFlightPerThread = 2;
+
+bool CheckRowSize(size_t row_size, size_t num_columns) {
+    if (row_size != num_columns) {
+        LOG(WARNING) << "Unexpected number of columns for a row, skipping (expected "
+                     << num_columns << ", got " << row_size << ")";
+        return false;
+    }
+    return true;
 }
 
-std::unique_ptr<ColumnLayoutRelationData> ColumnLayoutRelationData::CreateFrom(
-        model::IDatasetStream& data_stream, bool is_null_eq_null) {
-    auto schema = std::make_unique<RelationalSchema>(data_stream.GetRelationName());
-    std::unordered_map<std::string, int> value_dictionary;
+ColumnVectors EncodeSequential(model::IDatasetStream& data_stream) {
+    ValueDictionary value_dictionary;
     int next_value_id = 1;
-    int const null_value_id = kNullValueId;
+    int const null_value_id = ColumnLayoutRelationData::kNullValueId;
     size_t const num_columns = data_stream.GetNumberOfColumns();
-    std::vector<std::vector<int>> column_vectors = std::vector<std::vector<int>>(num_columns);
-    std::vector<std::string> row;
+    ColumnVectors column_vectors = ColumnVectors(num_columns);
 
     while (data_stream.HasNextRow()) {
-        row = data_stream.GetNextRow();
+        model::IDatasetStream::RowView const& row = data_stream.GetNextRowView();
 
-        if (row.size() != num_columns) {
-            LOG(WARNING) << "Unexpected number of columns for a row, skipping (expected "
-                         << num_columns << ", got " << row.size() << ")";
+        if (!CheckRowSize(row.size(), num_columns)) {
             continue;
         }
 
         for (size_t index = 0; index < row.size(); ++index) {
-            std::string const& field = row[index];
+            std::string_view const field = row[index];
             if (field.empty()) {
                 column_vectors[index].push_back(null_value_id);
             } else {
                 auto location = value_dictionary.find(field);
                 int value_id;
                 if (location == value_dictionary.end()) {
-                    value_dictionary[field] = next_value_id;
+                    value_dictionary.emplace(field, next_value_id);
                     value_id = next_value_id;
                     next_value_id++;
                 } else {
@@ -57,12 +83,229 @@ std::unique_ptr<ColumnLayoutRelationData> ColumnLayoutRelationData::CreateFrom(
         }
     }
 
+    return column_vectors;
+}
+
+/* A chunk of rows encoded with its own dictionary. Local value ids start from 1 and are
+ * assigned in the order of the first occurrence, so merging the chunks in stream order
+ * gives the same global ids as the sequential encoding.
+ */
+struct EncodedChunk {
+    /* Fields of the chunk's rows, row by row, kept until the chunk is encoded */
+    std::vector<std::string> fields;
+    size_t num_rows = 0;
+    ColumnVectors column_vectors;
+    ValueDictionary dictionary;
+    /* values[i] is the key of the dictionary entry with local id i + 1 */
+    std::vector<std::string const*> values;
+};
+
+void EncodeField(EncodedChunk& chunk, std::vector<int>& column, std::string_view field) {
+    if (field.empty()) {
+        column.push_back(ColumnLayoutRelationData::kNullValueId);
+        return;
+    }
+    auto location = chunk.dictionary.find(field);
+    if (location == chunk.dictionary.end()) {
+        location = chunk.dictionary.emplace(field, chunk.values.size() + 1).first;
+        chunk.values.push_back(&location->first);
+    }
+    column.push_back(location->second);
+}
+
+/* Encodes the fields buffered by the reading thread */
+void EncodeChunk(EncodedChunk& chunk, size_t num_columns) {
+    chunk.column_vectors.assign(num_columns, {});
+    for (std::vector<int>& column : chunk.column_vectors) {
+        column.reserve(chunk.num_rows);
+    }
+
+    for (size_t i = 0; i < chunk.fields.size(); ++i) {
+        EncodeField(chunk, chunk.column_vectors[i % num_columns], chunk.fields[i]);
+    }
+
+    chunk.fields.clear();
+    chunk.fields.shrink_to_fit();
+}
+
+/* Reads and encodes the rows of a part of the stream */
+void EncodePart(model::IDatasetStream& part, EncodedChunk& chunk, size_t num_columns) {
+    chunk.column_vectors.assign(num_columns, {});
+    while (part.HasNextRow()) {
+        model::IDatasetStream::RowView const& row = part.GetNextRowView();
+        if (!CheckRowSize(row.size(), num_columns)) {
+            continue;
+        }
+        for (size_t index = 0; index < num_columns; ++index) {
+            EncodeField(chunk, chunk.column_vectors[index], row[index]);
+        }
+    }
+}
+
+/* Parts of a stream that can be split are read and encoded on the pool. Otherwise rows are
+ * read on this thread and buffered in chunks that are encoded on the pool, reading waits
+ * while the pool is kChunksInFlightPerThread chunks per thread behind.
+ */
+std::deque<EncodedChunk> EncodeChunks(model::IDatasetStream& data_stream, unsigned threads_num) {
+    size_t const num_columns = data_stream.GetNumberOfColumns();
+    std::deque<EncodedChunk> chunks;
+    std::vector<std::unique_ptr<model::IDatasetStream>> parts =
+            data_stream.SplitRemainingRows(threads_num * kPartsPerThread);
+    std::counting_semaphore<> free_slots(threads_num * kChunksInFlightPerThread);
+    boost::asio::thread_pool pool(threads_num);
+
+    if (!parts.empty()) {
+        for (std::unique_ptr<model::IDatasetStream>& part : parts) {
+            EncodedChunk& chunk = chunks.emplace_back();
+            boost::asio::post(pool, [&part, &chunk, num_columns]() {
+                EncodePart(*part, chunk, num_columns);
+            });
+        }
+        pool.join();
+        return chunks;
+    }
+
+    size_t const fields_per_chunk = kRowsPerChunk * num_columns;
+    auto start_chunk = [&chunks, &free_slots, fields_per_chunk]() {
+        free_slots.acquire();
+        chunks.emplace_back().fields.reserve(fields_per_chunk);
+    };
+    auto post_last_chunk = [&pool, &chunks, &free_slots, num_columns]() {
+        EncodedChunk& chunk = chunks.back();
+        boost::asio::post(pool, [&chunk, &free_slots, num_columns]() {
+            EncodeChunk(chunk, num_columns);
+            free_slots.release();
+        });
+    };
+
+    start_chunk();
+    while (data_stream.HasNextRow()) {
+        model::IDatasetStream::RowView const& row = data_stream.GetNextRowView();
+        if (!CheckRowSize(row.size(), num_columns)) {
+            continue;
+        }
+
+        EncodedChunk& chunk = chunks.back();
+        chunk.fields.insert(chunk.fields.end(), row.begin(), row.end());
+        if (++chunk.num_rows == kRowsPerChunk) {
+            post_last_chunk();
+            start_chunk();
+        }
+    }
+    post_last_chunk();
+    pool.join();
+    return chunks;
+}
+
+ColumnVectors EncodeParallel(model::IDatasetStream& data_stream, unsigned threads_num) {
+    size_t const num_columns = data_stream.GetNumberOfColumns();
+    std::deque<EncodedChunk> chunks = EncodeChunks(data_stream, threads_num);
+
+    // Merge chunk dictionaries into global value ids in stream order
+    ValueDictionary value_dictionary;
+    int next_value_id = 1;
+    size_t num_rows = 0;
+    std::vector<size_t> chunk_offsets;
+    std::vector<std::vector<int>> local_to_global_ids;
+    chunk_offsets.reserve(chunks.size());
+    local_to_global_ids.reserve(chunks.size());
+    for (EncodedChunk& chunk : chunks) {
+        std::vector<int>& ids = local_to_global_ids.emplace_back(chunk.values.size() + 1);
+        for (size_t local_id = 1; local_id <= chunk.values.size(); ++local_id) {
+            auto node = chunk.dictionary.extract(*chunk.values[local_id - 1]);
+            node.mapped() = next_value_id;
+            auto result = value_dictionary.insert(std::move(node));
+            if (result.inserted) {
+                next_value_id++;
+            }
+            ids[local_id] = result.position->second;
+        }
+        chunk.dictionary.clear();
+        chunk.values.clear();
+
+        chunk_offsets.push_back(num_rows);
+        num_rows += chunk.column_vectors.empty() ? 0 : chunk.column_vectors.front().size();
+    }
+    value_dictionary.clear();
+
+    ColumnVectors column_vectors(num_columns, std::vector<int>(num_rows));
+    {
+        boost::asio::thread_pool pool(threads_num);
+        for (size_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index) {
+            boost::asio::post(pool, [&, chunk_index]() {
+                EncodedChunk& chunk = chunks[chunk_index];
+                std::vector<int> const& ids = local_to_global_ids[chunk_index];
+                size_t const offset = chunk_offsets[chunk_index];
+                for (size_t index = 0; index < chunk.column_vectors.size(); ++index) {
+                    std::vector<int> const& local_column = chunk.column_vectors[index];
+                    std::vector<int>& column = column_vectors[index];
+                    for (size_t row = 0; row < local_column.size(); ++row) {
+                        int const local_id = local_column[row];
+                        column[offset + row] = local_id == ColumnLayoutRelationData::kNullValueId
+                                                       ? local_id
+                                                       : ids[local_id];
+                    }
+                }
+                chunk.column_vectors.clear();
+                chunk.column_vectors.shrink_to_fit();
+            });
+        }
+        pool.join();
+    }
+
+    return column_vectors;
+}
+
+std::vector<std::unique_ptr<model::PositionListIndex>> CreatePlis(ColumnVectors& column_vectors,
+                                                                  bool is_null_eq_null,
+                                                                  unsigned threads_num) {
+    std::vector<std::unique_ptr<model::PositionListIndex>> plis(column_vectors.size());
+    auto create_pli = [&column_vectors, &plis, is_null_eq_null](size_t index) {
+        plis[index] = model::PositionListIndex::CreateFor(column_vectors[index], is_null_eq_null);
+        plis[index]->ForceCacheProbingTable();
+        column_vectors[index] = {};
+    };
+
+    if (threads_num > 1) {
+        boost::asio::thread_pool pool(threads_num);
+        for (size_t i = 0; i < column_vectors.size(); ++i) {
+            boost::asio::post(pool, [&create_pli, i]() { create_pli(i); });
+        }
+        pool.join();
+    } else {
+        for (size_t i = 0; i < column_vectors.size(); ++i) {
+            create_pli(i);
+        }
+    }
+
+    return plis;
+}
+
+}  // namespace
+
+std::vector<int> ColumnLayoutRelationData::GetTuple(int tuple_index) const {
+    int num_columns = schema_->GetNumColumns();
+    std::vector<int> tuple = std::vector<int>(num_columns);
+    for (int column_index = 0; column_index < num_columns; column_index++) {
+        tuple[column_index] = column_data_[column_index].GetProbingTableValue(tuple_index);
+    }
+    return tuple;
+}
+
+std::unique_ptr<ColumnLayoutRelationData> ColumnLayoutRelationData::CreateFrom(
+        model::IDatasetStream& data_stream, bool is_null_eq_null, unsigned threads_num) {
+    auto schema = std::make_unique<RelationalSchema>(data_stream.GetRelationName());
+    size_t const num_columns = data_stream.GetNumberOfColumns();
+    ColumnVectors column_vectors = threads_num > 1 ? EncodeParallel(data_stream, threads_num)
+                                                   : EncodeSequential(data_stream);
+    std::vector<std::unique_ptr<model::PositionListIndex>> plis =
+            CreatePlis(column_vectors, is_null_eq_null, threads_num);
+
     std::vector<ColumnData> column_data;
     for (size_t i = 0; i < num_columns; ++i) {
         auto column = Column(schema.get(), data_stream.GetColumnName(i), i);
         schema->AppendColumn(std::move(column));
-        auto pli = model::PositionListIndex::CreateFor(column_vectors[i], is_null_eq_null);
-        column_data.emplace_back(schema->GetColumn(i), std::move(pli));
+        column_data.emplace_back(schema->GetColumn(i), std::move(plis[i]));
     }
 
     schema->Init();
@@ -28,6 +28,11 @@ public:
 
     [[nodiscard]] std::vector<int> GetTuple(int tuple_index) const;
 
+    /* With threads_num > 1 rows are dictionary-encoded in chunks on a thread pool, streams that
+     * can be split are also read on it, and column PLIs are built concurrently. The result does
+     * not depend on the number of threads.
+     */
     static std::unique_ptr<ColumnLayoutRelationData> CreateFrom(model::IDatasetStream& data_stream,
-                                                                bool is_null_eq_null);
+                                                                bool is_null_eq_null,
+                                                                unsigned threads_num = 1);
 };
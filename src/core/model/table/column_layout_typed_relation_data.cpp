@@ -10,13 +10,12 @@ std::unique_ptr<ColumnLayoutTypedRelationData> ColumnLayoutTypedRelationData::Cr
     size_t const num_columns = data_stream.GetNumberOfColumns();
 
     std::vector<std::vector<std::string>> columns(num_columns);
-    std::vector<std::string> row;
 
     /* Parsing is very similar to ColumnLayoutRelationData::CreateFrom().
      * Maybe we need column-based parsing in addition to row-based in CSVParser
      * (now IDatasetStream) */
     while (data_stream.HasNextRow()) {
-        row = data_stream.GetNextRow();
+        IDatasetStream::RowView const& row = data_stream.GetNextRowView();
 
         if (row.size() != num_columns) {
             LOG(WARNING) << "Unexpected number of columns for a row, skipping (expected "
@@ -25,8 +24,7 @@ std::unique_ptr<ColumnLayoutTypedRelationData> ColumnLayoutTypedRelationData::Cr
         }
 
         for (size_t index = 0; index < row.size(); ++index) {
-            std::string& field = row[index];
-            columns[index].push_back(std::move(field));
+            columns[index].emplace_back(row[index]);
         }
     }
 
@@ -1,6 +1,7 @@
 #include "model/table/dynamic_position_list_index.h"
 
 #include <algorithm>
+#include <cassert>
 #include <chrono>
 #include <cmath>
 #include <map>
@@ -75,6 +76,33 @@ void DynamicPositionListIndex::UpdateWith(
     ForceCacheProbingTable();
 }
 
+void DynamicPositionListIndex::UpdateClustersWith(
+        std::vector<std::pair<std::optional<size_t>, ClusterValue>> const& inserted_records,
+        std::vector<std::pair<size_t, ClusterValue>> const& deleted_records) {
+    if (inserted_records.empty() && deleted_records.empty()) {
+        return;
+    }
+    for (auto const& [record_id, cluster_value] : deleted_records) {
+        auto it = clusters_.find(cluster_value);
+        assert(it != clusters_.end());
+        std::erase(it->second, record_id);
+        if (it->second.empty()) {
+            clusters_.erase(it);
+        }
+    }
+    valid_records_number_ -= deleted_records.size();
+    for (auto const& [record_id_opt, cluster_value] : inserted_records) {
+        if (record_id_opt.has_value()) {
+            clusters_[cluster_value].emplace_back(*record_id_opt);
+        } else {
+            clusters_[cluster_value].emplace_back(next_record_id_++);
+        }
+        ++valid_records_number_;
+    }
+
+    probing_table_cache_ = nullptr;
+}
+
 std::unordered_map<int, unsigned> DynamicPositionListIndex::CreateFrequencies(
         Cluster const& cluster, std::vector<int> const& probing_table) {
     std::unordered_map<int, unsigned> frequencies;
@@ -43,6 +43,19 @@ public:
     void UpdateWith(std::vector<std::pair<std::optional<size_t>, ClusterValue>>& inserted_records,
                     std::unordered_set<size_t> deleted_records_ids);
 
+    /* Moves single records between clusters, the cost is proportional to the sizes of the
+     * clusters touched. Unlike UpdateWith(), the probing table is not recalculated: the cached one
+     * is dropped and ForceCacheProbingTable() must be called before probing this index */
+    void UpdateClustersWith(std::vector<std::pair<std::optional<size_t>, ClusterValue>> const&
+                                    inserted_records,
+                            std::vector<std::pair<size_t, ClusterValue>> const& deleted_records);
+
+    /* Cluster of the records with the value, nullptr if there are none */
+    Cluster const* FindCluster(ClusterValue const& value) const {
+        auto it = clusters_.find(value);
+        return it == clusters_.end() ? nullptr : &it->second;
+    }
+
     static std::unordered_map<int, unsigned> CreateFrequencies(
             Cluster const& cluster, std::vector<int> const& probing_table);
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace model {
@@ -8,8 +10,36 @@ namespace model {
 class IDatasetStream {
 public:
     using Row = std::vector<std::string>;
+    /* Views are valid until the next call to GetNextRowView(), GetNextRow() or Reset() */
+    using RowView = std::vector<std::string_view>;
 
+private:
+    /* Backs the views returned by the default GetNextRowView() */
+    Row view_storage_;
+    RowView view_;
+
+public:
     virtual Row GetNextRow() = 0;
+
+    /* Lets consumers that copy or hash the fields anyway skip materializing a Row. The default
+     * implementation keeps the result of GetNextRow() alive until the next call, streams that
+     * own their input override it to hand out views without copying.
+     */
+    virtual RowView const& GetNextRowView() {
+        view_storage_ = GetNextRow();
+        view_.assign(view_storage_.begin(), view_storage_.end());
+        return view_;
+    }
+
+    /* Hands the rows not read yet over to at most `parts` streams over consecutive ranges of
+     * them, which can be read concurrently, and leaves this stream at its end. The parts must
+     * not outlive this stream. Streams that can't be split return no parts and stay as is.
+     */
+    virtual std::vector<std::unique_ptr<IDatasetStream>> SplitRemainingRows(
+            [[maybe_unused]] size_t parts) {
+        return {};
+    }
+
     [[nodiscard]] virtual bool HasNextRow() const = 0;
     [[nodiscard]] virtual size_t GetNumberOfColumns() const = 0;
     [[nodiscard]] virtual std::string GetColumnName(size_t index) const = 0;
@@ -0,0 +1,192 @@
+#include "model/table/pli_cache.h"
+
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include <boost/dynamic_bitset.hpp>
+#include <boost/format.hpp>
+#include <easylogging++.h>
+
+namespace model {
+
+PLICache::PLICache(ColumnLayoutRelationData* relation_data, std::size_t memory_limit,
+                   CachingPredicate should_cache, unsigned nary_intersection_size)
+    : relation_data_(relation_data),
+      index_(relation_data->GetSchema()),
+      memory_limit_(memory_limit),
+      nary_intersection_size_(nary_intersection_size),
+      should_cache_(std::move(should_cache)) {
+    for (auto& column_ptr : relation_data->GetSchema()->GetColumns()) {
+        index_.Put(static_cast<Vertical>(*column_ptr),
+                   relation_data->GetColumnData(column_ptr->GetIndex()).GetPliOwnership());
+    }
+}
+
+std::shared_ptr<PositionListIndex const> PLICache::Get(Vertical const& vertical) const {
+    std::shared_lock lock(mutex_);
+    return index_.Get(vertical);
+}
+
+std::size_t PLICache::Size() const {
+    std::shared_lock lock(mutex_);
+    return index_.GetSize();
+}
+
+std::size_t PLICache::GetMemoryUsage() const {
+    std::shared_lock lock(mutex_);
+    return memory_usage_;
+}
+
+void PLICache::Touch(Vertical const& vertical) {
+    auto it = usages_.find(vertical);
+    if (it == usages_.end()) return;
+    ++it->second.uses;
+    it->second.last_use = ++clock_;
+}
+
+// greedily covers the vertical with the largest cached subsets, preferring smaller PLIs
+std::vector<PLICache::Operand> PLICache::SelectOperands(Vertical const& vertical) {
+    std::vector<Operand> ranks;
+    std::vector<Operand> operands;
+    for (auto& [sub_vertical, sub_pli] : index_.GetSubsetEntries(vertical)) {
+        ranks.push_back({sub_vertical, sub_pli, sub_vertical.GetArity()});
+    }
+    auto smallest = std::min_element(ranks.begin(), ranks.end(), [](auto& a, auto& b) {
+        return a.pli->GetSize() < b.pli->GetSize() ||
+               (a.pli->GetSize() == b.pli->GetSize() && a.added_arity > b.added_arity);
+    });
+    assert(smallest != ranks.end());
+
+    boost::dynamic_bitset<> cover(relation_data_->GetNumColumns());
+    boost::dynamic_bitset<> cover_tester(relation_data_->GetNumColumns());
+    operands.push_back(*smallest);
+    cover |= smallest->vertical.GetColumnIndices();
+
+    while (cover.count() < vertical.GetArity() && !ranks.empty()) {
+        // erase ranks with low added_arity
+        std::erase_if(ranks, [&cover_tester, &cover](Operand& rank) {
+            cover_tester.reset();
+            cover_tester |= rank.vertical.GetColumnIndices();
+            cover_tester -= cover;
+            rank.added_arity = cover_tester.count();
+            return rank.added_arity < 2;
+        });
+
+        auto best = std::min_element(ranks.begin(), ranks.end(), [](auto& a, auto& b) {
+            return a.added_arity > b.added_arity ||
+                   (a.added_arity == b.added_arity && a.pli->GetSize() < b.pli->GetSize());
+        });
+        if (best != ranks.end()) {
+            operands.push_back(*best);
+            cover |= best->vertical.GetColumnIndices();
+        }
+    }
+
+    for (auto& column : vertical.GetColumns()) {
+        if (!cover[column->GetIndex()]) {
+            Vertical column_vertical(*column);
+            std::shared_ptr<PositionListIndex const> column_pli = index_.Get(column_vertical);
+            operands.push_back({std::move(column_vertical), std::move(column_pli), 1});
+        }
+    }
+    for (Operand const& operand : operands) Touch(operand.vertical);
+
+    // sort operands by ascending order
+    std::sort(operands.begin(), operands.end(), [](Operand const& a, Operand const& b) {
+        return a.pli->GetSize() < b.pli->GetSize();
+    });
+    return operands;
+}
+
+// obtains or calculates a PositionListIndex using cache
+std::shared_ptr<PositionListIndex const> PLICache::GetOrCreateFor(Vertical const& vertical) {
+    LOG(DEBUG) << boost::format{"PLI for %1% requested: "} % vertical.ToString();
+
+    std::vector<Operand> operands;
+    {
+        std::shared_lock lock(mutex_);
+        // is PLI already cached?
+        if (std::shared_ptr<PositionListIndex const> pli = index_.Get(vertical)) {
+            Touch(vertical);
+            ++hits_;
+            LOG(DEBUG) << boost::format{"Served from PLI cache."};
+            return pli;
+        }
+        ++misses_;
+        // look for cached PLIs to construct the requested one
+        operands = SelectOperands(vertical);
+    }
+
+    if (operands.empty()) {
+        throw std::logic_error("Current implementation assumes operands.size() > 0");
+    }
+
+    // Intersect and cache, operands are owned here, so eviction does not affect them
+    std::shared_ptr<PositionListIndex const> intersection_pli;
+    if (operands.size() >= nary_intersection_size_) {
+        Operand const& base = operands.front();
+        intersection_pli = Cache(vertical, base.pli->ProbeAll(vertical.Without(base.vertical),
+                                                              *relation_data_));
+    } else {
+        Vertical current_vertical = operands.front().vertical;
+        intersection_pli = operands.front().pli;
+        for (size_t i = 1; i < operands.size(); i++) {
+            current_vertical = current_vertical.Union(operands[i].vertical);
+            intersection_pli = Cache(current_vertical,
+                                     intersection_pli->Intersect(operands[i].pli.get()));
+        }
+    }
+
+    LOG(DEBUG) << boost::format{"Calculated from %1% sub-PLIs (saved %2% intersections)."} %
+                          operands.size() % (vertical.GetArity() - operands.size());
+
+    return intersection_pli;
+}
+
+std::shared_ptr<PositionListIndex const> PLICache::Cache(Vertical const& vertical,
+                                                         std::unique_ptr<PositionListIndex> pli) {
+    std::size_t const bytes = pli->GetMemoryUsage();
+    std::unique_lock lock(mutex_);
+    // another thread may have calculated the same PLI in the meantime
+    if (std::shared_ptr<PositionListIndex const> cached = index_.Get(vertical)) return cached;
+    if (should_cache_ && !should_cache_(vertical, *pli)) return pli;
+    if (bytes > memory_limit_) return pli;
+    if (memory_usage_ + bytes > memory_limit_) Evict(bytes);
+
+    std::shared_ptr<PositionListIndex> cached = std::move(pli);
+    index_.Put(vertical, cached);
+    usages_.try_emplace(vertical, bytes, ++clock_);
+    memory_usage_ += bytes;
+    return cached;
+}
+
+void PLICache::Evict(std::size_t bytes) {
+    using UsageIterator = std::unordered_map<Vertical, Usage>::iterator;
+    // free a quarter of the limit at once, so that eviction does not run on every insertion
+    std::size_t const target = std::min(memory_limit_ - bytes, memory_limit_ / 4 * 3);
+    std::vector<UsageIterator> candidates;
+    candidates.reserve(usages_.size());
+    for (auto it = usages_.begin(); it != usages_.end(); ++it) candidates.push_back(it);
+    std::sort(candidates.begin(), candidates.end(), [](UsageIterator a, UsageIterator b) {
+        unsigned const a_uses = a->second.uses, b_uses = b->second.uses;
+        return a_uses < b_uses || (a_uses == b_uses && a->second.last_use < b->second.last_use);
+    });
+
+    for (UsageIterator it : candidates) {
+        if (memory_usage_ <= target) break;
+        index_.Remove(it->first);
+        memory_usage_ -= it->second.bytes;
+        usages_.erase(it);
+        ++evictions_;
+    }
+    // age the remaining entries, so that PLIs that were hot long ago can be evicted eventually
+    for (auto& [vertical, usage] : usages_) usage.uses = usage.uses / 2;
+
+    LOG(DEBUG) << boost::format{"Evicted PLIs, %1% bytes of %2% are in use."} % memory_usage_ %
+                          memory_limit_;
+}
+
+}  // namespace model
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "model/table/column_layout_relation_data.h"
+#include "model/table/position_list_index.h"
+#include "model/table/vertical.h"
+#include "model/table/vertical_map.h"
+
+namespace model {
+
+/* PLIs of column combinations shared by all threads of an algorithm. A requested PLI is
+ * intersected from the cached PLIs of its subsets, and the intersections are cached while they
+ * fit into the memory limit. When a new one does not fit, the least used PLIs are evicted. PLIs
+ * of single columns are taken from the relation, they are never evicted and are not counted
+ * against the limit.
+ * Lookups may run concurrently, intersections are calculated without holding the lock.
+ */
+class PLICache {
+public:
+    /* Decides whether a calculated intersection is worth caching */
+    using CachingPredicate = std::function<bool(Vertical const&, PositionListIndex const&)>;
+
+private:
+    struct Usage {
+        std::size_t const bytes;
+        std::atomic<unsigned> uses = 0;
+        std::atomic<unsigned long long> last_use;
+
+        Usage(std::size_t bytes, unsigned long long time) : bytes(bytes), last_use(time) {}
+    };
+
+    struct Operand {
+        Vertical vertical;
+        std::shared_ptr<PositionListIndex const> pli;
+        unsigned added_arity;
+    };
+
+    ColumnLayoutRelationData* relation_data_;
+    VerticalMap<PositionListIndex> index_;
+    /* bookkeeping of the cached intersections */
+    std::unordered_map<Vertical, Usage> usages_;
+    mutable std::shared_mutex mutex_;
+
+    std::size_t const memory_limit_;
+    std::size_t memory_usage_ = 0;
+    unsigned const nary_intersection_size_;
+    CachingPredicate should_cache_;
+
+    std::atomic<unsigned long long> clock_ = 0;
+    std::atomic<std::size_t> hits_ = 0;
+    std::atomic<std::size_t> misses_ = 0;
+    std::atomic<std::size_t> evictions_ = 0;
+
+    /* Must be called under a lock */
+    void Touch(Vertical const& vertical);
+    std::vector<Operand> SelectOperands(Vertical const& vertical);
+    /* Must be called under the unique lock */
+    void Evict(std::size_t bytes);
+
+    std::shared_ptr<PositionListIndex const> Cache(Vertical const& vertical,
+                                                   std::unique_ptr<PositionListIndex> pli);
+
+public:
+    /* memory_limit is in bytes; if should_cache is empty, every intersection is cached.
+     * Requests of at least nary_intersection_size operands are served by a single ProbeAll.
+     */
+    PLICache(ColumnLayoutRelationData* relation_data, std::size_t memory_limit,
+             CachingPredicate should_cache = nullptr, unsigned nary_intersection_size = 4);
+
+    /* Returns nullptr if the PLI is not cached */
+    std::shared_ptr<PositionListIndex const> Get(Vertical const& vertical) const;
+    std::shared_ptr<PositionListIndex const> GetOrCreateFor(Vertical const& vertical);
+
+    /* Number of cached PLIs, including the ones of single columns */
+    std::size_t Size() const;
+    /* Bytes taken by the cached intersections */
+    std::size_t GetMemoryUsage() const;
+
+    std::size_t GetMemoryLimit() const noexcept {
+        return memory_limit_;
+    }
+
+    /* Counters of GetOrCreateFor requests */
+    std::size_t GetHits() const noexcept {
+        return hits_;
+    }
+
+    std::size_t GetMisses() const noexcept {
+        return misses_;
+    }
+
+    std::size_t GetEvictions() const noexcept {
+        return evictions_;
+    }
+};
+
+}  // namespace model
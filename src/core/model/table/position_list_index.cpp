@@ -8,7 +8,6 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
-#include <deque>
 #include <map>
 #include <memory>
 #include <utility>
@@ -23,11 +22,10 @@ namespace model {
 
 int const PositionListIndex::kSingletonValueId = 0;
 unsigned long long PositionListIndex::micros_ = 0;
-int PositionListIndex::intersection_count_ = 0;
+std::atomic<int> PositionListIndex::intersection_count_ = 0;
 
-PositionListIndex::PositionListIndex(std::deque<std::vector<int>> index,
-                                     std::vector<int> null_cluster, unsigned int size,
-                                     double entropy, unsigned long long nep,
+PositionListIndex::PositionListIndex(ClusterList index, std::vector<int> null_cluster,
+                                     unsigned int size, double entropy, unsigned long long nep,
                                      unsigned int relation_size,
                                      unsigned int original_relation_size, double inverted_entropy,
                                      double gini_impurity)
@@ -44,40 +42,62 @@ PositionListIndex::PositionListIndex(std::deque<std::vector<int>> index,
 
 std::unique_ptr<PositionListIndex> PositionListIndex::CreateFor(std::vector<int>& data,
                                                                 bool is_null_eq_null) {
-    std::unordered_map<int, std::vector<int>> index;
+    /* Values get local ids in the order of their first occurrence, so the clusters are laid
+     * out sorted by their first position without any sorting */
+    std::unordered_map<int, unsigned> value_to_local_id;
+    std::vector<unsigned> local_ids(data.size());
+    std::vector<unsigned> counts;
     for (unsigned long position = 0; position < data.size(); ++position) {
-        int value_id = data[position];
-        index[value_id].push_back(position);
+        auto [it, inserted] = value_to_local_id.try_emplace(data[position], counts.size());
+        if (inserted) {
+            counts.push_back(0);
+        }
+        local_ids[position] = it->second;
+        ++counts[it->second];
     }
 
     std::vector<int> null_cluster;
-    if (index.count(ColumnLayoutRelationData::kNullValueId) != 0) {
-        null_cluster = index[ColumnLayoutRelationData::kNullValueId];
-    }
-    if (!is_null_eq_null) {
-        index.erase(ColumnLayoutRelationData::kNullValueId);  // move?
+    auto null_it = value_to_local_id.find(ColumnLayoutRelationData::kNullValueId);
+    bool const has_nulls = null_it != value_to_local_id.end();
+    unsigned const null_local_id = has_nulls ? null_it->second : 0;
+    if (has_nulls) {
+        null_cluster.reserve(counts[null_local_id]);
+        for (unsigned long position = 0; position < data.size(); ++position) {
+            if (local_ids[position] == null_local_id) {
+                null_cluster.push_back(position);
+            }
+        }
     }
+    value_to_local_id.clear();
 
     double key_gap = 0.0;
     double inv_ent = 0;
     double gini_gap = 0;
     unsigned long long nep = 0;
     unsigned int size = 0;
-    std::deque<std::vector<int>> clusters;
-
-    for (auto& iter : index) {
-        if (iter.second.size() == 1) {
+    std::vector<unsigned> offsets{0};
+    /* Where the next position of the cluster of each local id is written */
+    std::vector<unsigned> write_positions(counts.size());
+
+    for (unsigned local_id = 0; local_id < counts.size(); ++local_id) {
+        unsigned const cluster_size = counts[local_id];
+        if (!is_null_eq_null && has_nulls && local_id == null_local_id) {
+            counts[local_id] = 0;
+            continue;
+        }
+        if (cluster_size == 1) {
             gini_gap += std::pow(1 / static_cast<double>(data.size()), 2);
             continue;
         }
-        key_gap += iter.second.size() * log(iter.second.size());
-        nep += CalculateNep(iter.second.size());
-        size += iter.second.size();
-        inv_ent += -(1 - iter.second.size() / static_cast<double>(data.size())) *
-                   std::log(1 - (iter.second.size() / static_cast<double>(data.size())));
-        gini_gap += std::pow(iter.second.size() / static_cast<double>(data.size()), 2);
-
-        clusters.emplace_back(std::move(iter.second));
+        key_gap += cluster_size * log(cluster_size);
+        nep += CalculateNep(cluster_size);
+        inv_ent += -(1 - cluster_size / static_cast<double>(data.size())) *
+                   std::log(1 - (cluster_size / static_cast<double>(data.size())));
+        gini_gap += std::pow(cluster_size / static_cast<double>(data.size()), 2);
+
+        write_positions[local_id] = size;
+        size += cluster_size;
+        offsets.push_back(size);
     }
     double entropy = log(data.size()) - key_gap / data.size();
 
@@ -86,14 +106,21 @@ std::unique_ptr<PositionListIndex> PositionListIndex::CreateFor(std::vector<int>
         inv_ent = 0;
     }
 
-    SortClusters(clusters);
-    return std::make_unique<PositionListIndex>(std::move(clusters), std::move(null_cluster), size,
-                                               entropy, nep, data.size(), data.size(), inv_ent,
-                                               gini_impurity);
+    std::vector<int> rows(size);
+    for (unsigned long position = 0; position < data.size(); ++position) {
+        unsigned const local_id = local_ids[position];
+        if (counts[local_id] >= 2) {
+            rows[write_positions[local_id]++] = position;
+        }
+    }
+
+    return std::make_unique<PositionListIndex>(
+            ClusterList(std::move(rows), std::move(offsets)), std::move(null_cluster), size,
+            entropy, nep, data.size(), data.size(), inv_ent, gini_impurity);
 }
 
 std::unordered_map<int, unsigned> PositionListIndex::CreateFrequencies(
-        Cluster const& cluster, std::vector<int> const& probing_table) {
+        ClusterView cluster, std::vector<int> const& probing_table) {
     std::unordered_map<int, unsigned> frequencies;
 
     for (int const tuple_index : cluster) {
@@ -111,17 +138,12 @@ std::unordered_map<int, unsigned> PositionListIndex::CreateFrequencies(
 //
 // }
 
-void PositionListIndex::SortClusters(std::deque<std::vector<int>>& clusters) {
-    sort(clusters.begin(), clusters.end(),
-         [](std::vector<int> const& a, std::vector<int> const& b) { return a[0] < b[0]; });
-}
-
 std::shared_ptr<std::vector<int> const> PositionListIndex::CalculateAndGetProbingTable() const {
     if (probing_table_cache_ != nullptr) return probing_table_cache_;
 
     std::vector<int> probing_table = std::vector<int>(original_relation_size_);
     int next_cluster_id = kSingletonValueId + 1;
-    for (auto& cluster : index_) {
+    for (ClusterView cluster : index_) {
         int value_id = next_cluster_id++;
         assert(value_id != kSingletonValueId);
         for (int position : cluster) {
@@ -143,10 +165,6 @@ std::shared_ptr<std::vector<int> const> PositionListIndex::CalculateAndGetProbin
     return probingTable;
 }*/
 
-// std::deque<std::vector<int>> const & PositionListIndex::getIndex() const {
-//     return index;
-// }
-
 std::unique_ptr<PositionListIndex> PositionListIndex::Intersect(
         PositionListIndex const* that) const {
     assert(this->relation_size_ == that->relation_size_);
@@ -162,45 +180,70 @@ std::unique_ptr<PositionListIndex> PositionListIndex::Intersect(
 std::unique_ptr<PositionListIndex> PositionListIndex::Probe(
         std::shared_ptr<std::vector<int> const> probing_table) const {
     assert(this->relation_size_ == probing_table->size());
-    std::deque<std::vector<int>> new_index;
+    std::vector<int> const& table = *probing_table;
+    std::vector<int> new_rows;
+    std::vector<unsigned> new_offsets{0};
     unsigned int new_size = 0;
     double new_key_gap = 0.0;
     unsigned long long new_nep = 0;
     std::vector<int> null_cluster;
+    int intersection_count = 0;
 
-    std::unordered_map<int, std::vector<int>> partial_index;
+    /* For every probing table value: the number of positions of the current cluster having it
+     * and where the next of them is written. Reused across clusters, so splitting a cluster
+     * allocates nothing */
+    std::vector<unsigned> counts;
+    std::vector<unsigned> write_positions;
+    std::vector<int> cluster_values;
 
-    for (auto& positions : index_) {
+    new_rows.reserve(size_);
+    for (ClusterView positions : index_) {
         for (int position : positions) {
-            if (probing_table == nullptr) LOG(DEBUG) << "NULLPTR";
-            if (position < 0 || static_cast<size_t>(position) >= probing_table->size()) {
-                LOG(DEBUG) << "position: " + std::to_string(position) +
-                                      ", size: " + std::to_string(probing_table->size());
-                for (size_t i = 0; i < positions.size(); ++i) {
-                    LOG(DEBUG) << "Position " + std::to_string(positions[i]);
-                }
-            }
-            int probing_table_value_id = (*probing_table)[position];
+            assert(position >= 0 && static_cast<size_t>(position) < table.size());
+            int probing_table_value_id = table[position];
             if (probing_table_value_id == kSingletonValueId) continue;
-            intersection_count_++;
-            partial_index[probing_table_value_id].push_back(position);
+            intersection_count++;
+            if (static_cast<size_t>(probing_table_value_id) >= counts.size()) {
+                counts.resize(probing_table_value_id + 1);
+                write_positions.resize(probing_table_value_id + 1);
+            }
+            if (counts[probing_table_value_id]++ == 0) {
+                cluster_values.push_back(probing_table_value_id);
+            }
         }
 
-        for (auto& iter : partial_index) {
-            auto& cluster = iter.second;
-            if (cluster.size() <= 1) continue;
+        for (int value_id : cluster_values) {
+            unsigned const cluster_size = counts[value_id];
+            if (cluster_size <= 1) continue;
 
-            new_size += cluster.size();
-            new_key_gap += cluster.size() * log(cluster.size());
-            new_nep += CalculateNep(cluster.size());
+            write_positions[value_id] = new_size;
+            new_size += cluster_size;
+            new_key_gap += cluster_size * log(cluster_size);
+            new_nep += CalculateNep(cluster_size);
 
-            new_index.push_back(std::move(cluster));
+            new_offsets.push_back(new_size);
         }
-        partial_index.clear();
+        new_rows.resize(new_size);
+
+        for (int position : positions) {
+            int probing_table_value_id = table[position];
+            if (probing_table_value_id == kSingletonValueId) continue;
+            if (counts[probing_table_value_id] > 1) {
+                new_rows[write_positions[probing_table_value_id]++] = position;
+            }
+        }
+
+        for (int value_id : cluster_values) {
+            counts[value_id] = 0;
+        }
+        cluster_values.clear();
     }
 
+    intersection_count_ += intersection_count;
+
     double new_entropy = log(relation_size_) - new_key_gap / relation_size_;
-    SortClusters(new_index);
+    ClusterList new_index(std::move(new_rows), std::move(new_offsets));
+    new_index.SortByFirstRow();
 
     return std::make_unique<PositionListIndex>(std::move(new_index), std::move(null_cluster),
                                                new_size, new_entropy, new_nep, relation_size_,
@@ -209,9 +252,9 @@ std::unique_ptr<PositionListIndex> PositionListIndex::Probe(
 
 // TODO: null_cluster_ не поддерживается
 std::unique_ptr<PositionListIndex> PositionListIndex::ProbeAll(
-        Vertical const& probing_columns, ColumnLayoutRelationData& relation_data) {
+        Vertical const& probing_columns, ColumnLayoutRelationData& relation_data) const {
     assert(this->relation_size_ == relation_data.GetNumRows());
-    std::deque<std::vector<int>> new_index;
+    ClusterList new_index;
     unsigned int new_size = 0;
     double new_key_gap = 0.0;
     unsigned long long new_nep = 0;
@@ -220,7 +263,7 @@ std::unique_ptr<PositionListIndex> PositionListIndex::ProbeAll(
     std::vector<int> null_cluster;
     std::vector<int> probe;
 
-    for (auto& cluster : this->index_) {
+    for (ClusterView cluster : this->index_) {
         for (int position : cluster) {
             if (!TakeProbe(position, relation_data, probing_columns, probe)) {
                 probe.clear();
@@ -239,14 +282,14 @@ std::unique_ptr<PositionListIndex> PositionListIndex::ProbeAll(
             new_key_gap += new_cluster.size() * log(new_cluster.size());
             new_nep += CalculateNep(new_cluster.size());
 
-            new_index.emplace_back(std::move(new_cluster));
+            new_index.PushBack(new_cluster.begin(), new_cluster.end());
         }
         partial_index.clear();
     }
 
     double new_entropy = log(this->relation_size_) - new_key_gap / this->relation_size_;
 
-    SortClusters(new_index);
+    new_index.SortByFirstRow();
 
     return std::make_unique<PositionListIndex>(std::move(new_index), std::move(null_cluster),
                                                new_size, new_entropy, new_nep, this->relation_size_,
@@ -265,9 +308,20 @@ bool PositionListIndex::TakeProbe(int position, ColumnLayoutRelationData& relati
     return true;
 }
 
+std::size_t PositionListIndex::GetMemoryUsage() const {
+    std::size_t bytes = sizeof(PositionListIndex) +
+                        index_.GetRows().capacity() * sizeof(int) +
+                        index_.GetOffsets().capacity() * sizeof(unsigned) +
+                        null_cluster_.capacity() * sizeof(int);
+    if (probing_table_cache_ != nullptr) {
+        bytes += probing_table_cache_->capacity() * sizeof(int);
+    }
+    return bytes;
+}
+
 std::string PositionListIndex::ToString() const {
     std::string res = "[";
-    for (auto& cluster : index_) {
+    for (ClusterView cluster : index_) {
         res.push_back('[');
         for (int v : cluster) {
             res.append(std::to_string(v) + ",");
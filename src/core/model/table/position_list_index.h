@@ -4,11 +4,12 @@
 //
 
 #pragma once
-#include <deque>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
+#include "model/table/cluster_list.h"
 #include "model/table/column.h"
 
 class ColumnLayoutRelationData;
@@ -19,9 +20,11 @@ class PositionListIndex {
 public:
     /* Vector of tuple indices */
     using Cluster = std::vector<int>;
+    /* Tuple indices of a cluster stored in the index */
+    using ClusterView = ClusterList::View;
 
 private:
-    std::deque<Cluster> index_;
+    ClusterList index_;
     Cluster null_cluster_;
     unsigned int size_;
     double entropy_;
@@ -37,16 +40,16 @@ private:
         return static_cast<unsigned long long>(num_elements) * (num_elements - 1) / 2;
     }
 
-    static void SortClusters(std::deque<Cluster>& clusters);
     static bool TakeProbe(int position, ColumnLayoutRelationData& relation_data,
                           Vertical const& probing_columns, std::vector<int>& probe);
 
 public:
-    static int intersection_count_;
+    /* Probes may run concurrently, e.g. in TANE levels checked by several threads */
+    static std::atomic<int> intersection_count_;
     static unsigned long long micros_;
     static int const kSingletonValueId;
 
-    PositionListIndex(std::deque<Cluster> index, Cluster null_cluster, unsigned int size,
+    PositionListIndex(ClusterList index, Cluster null_cluster, unsigned int size,
                       double entropy, unsigned long long nep, unsigned int relation_size,
                       unsigned int original_relation_size, double inverted_entropy = 0,
                       double gini_impurity = 0);
@@ -54,7 +57,7 @@ public:
                                                         bool is_null_eq_null);
 
     static std::unordered_map<int, unsigned> CreateFrequencies(
-            Cluster const& cluster, std::vector<int> const& probing_table);
+            ClusterView cluster, std::vector<int> const& probing_table);
 
     // если PT закеширована, выдаёт её, иначе предварительно вычисляет её -- тяжёлая операция
     std::shared_ptr<std::vector<int> const> CalculateAndGetProbingTable() const;
@@ -76,12 +79,12 @@ public:
 
     // std::shared_ptr<const std::vector<int>> GetProbingTable(bool isCaching);
 
-    std::deque<Cluster> const& GetIndex() const noexcept {
+    ClusterList const& GetIndex() const noexcept {
         return index_;
     };
 
     /* If you use this method and change index in any way, all other methods will become invalid */
-    std::deque<Cluster>& GetIndex() noexcept {
+    ClusterList& GetIndex() noexcept {
         return index_;
     }
 
@@ -149,7 +152,9 @@ public:
     std::unique_ptr<PositionListIndex> Probe(
             std::shared_ptr<std::vector<int> const> probing_table) const;
     std::unique_ptr<PositionListIndex> ProbeAll(Vertical const& probing_columns,
-                                                ColumnLayoutRelationData& relation_data);
+                                                ColumnLayoutRelationData& relation_data) const;
+    /* Bytes taken by the index, including its cached probing table */
+    std::size_t GetMemoryUsage() const;
     std::string ToString() const;
 };
 
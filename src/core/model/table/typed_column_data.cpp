@@ -1,7 +1,10 @@
 #include "typed_column_data.h"
 
+#include <algorithm>
 #include <bitset>
 #include <cstddef>
+#include <cstring>
+#include <string>
 
 #include "column_layout_typed_relation_data.h"
 #include "create_type.h"
@@ -17,53 +20,65 @@ size_t GetNextAlignedOffset(size_t cur_offset, size_t align) {
     return cur_offset;
 }
 
+/* Strings and big ints are views of characters stored after the values in the column buffer */
+bool IsView(model::TypeId type_id) {
+    return type_id == +model::TypeId::kString || type_id == +model::TypeId::kBigInt;
+}
+
+/* Copies the value to chars, writes the view of the copy to dest and moves chars past it */
+void PlaceView(std::byte* dest, std::string const& value, char*& chars) {
+    std::memcpy(chars, value.data(), value.size());
+    new (dest) model::String(chars, value.size());
+    chars += value.size();
+}
+
 }  // namespace
 
 namespace model {
 
+size_t TypedColumnDataFactory::CountViewChars(TypesLayout const& types_layout) const noexcept {
+    size_t chars_num = 0;
+    for (size_t i = 0; i != types_layout.size(); ++i) {
+        if (IsView(types_layout[i])) {
+            chars_num += unparsed_[i].size();
+        }
+    }
+    return chars_num;
+}
+
 TypeId TypedColumnDataFactory::DeduceColumnType() const {
     bool is_undefined = true;
     std::bitset<5> candidate_types_bitset("11111");
     TypeId first_type_id = +TypeId::kUndefined;
     for (std::size_t i = 0; i != unparsed_.size(); ++i) {
-        if (!kNullCheck(unparsed_[i]) && !kEmptyCheck(unparsed_[i])) {
-            is_undefined = false;
-            if (first_type_id != +TypeId::kUndefined) {
-                auto& type_check = kTypeIdToChecker.at(first_type_id);
-                if (type_check(unparsed_[i])) {
-                    // undelimited and delimited dates have different bitsets
-                    if (first_type_id == +TypeId::kDate && kDelimitedDateCheck(unparsed_[i])) {
-                        candidate_types_bitset &= kTypeIdToBitset.at(first_type_id);
-                    }
-                    continue;
-                }
-            }
+        CellTypes const cell_types = ClassifyCell(unparsed_[i]);
+        if (cell_types.is_null || cell_types.is_empty) {
+            continue;
+        }
 
-            std::bitset<5> new_candidate_types_bitset("00000");
-            bool matched = false;
-            for (auto const& [type_id, type_check] : kTypeIdToChecker) {
-                if (type_id != first_type_id && type_check(unparsed_[i])) {
-                    if (first_type_id == +TypeId::kUndefined && !matched) {
-                        first_type_id = type_id;
-                    }
-                    matched = true;
-                    new_candidate_types_bitset |= kTypeIdToBitset.at(type_id);
-                    // possible value types are known at the first match except for dates
-                    // (undelimited dates could be ints or doubles and delimited couldn't)
-                    if (type_id == +TypeId::kDate && kUndelimitedDateCheck(unparsed_[i])) {
-                        new_candidate_types_bitset |= kTypeIdToBitset.at(+TypeId::kInt);
-                    }
-                    break;
-                }
-            }
-            if (!matched) {
-                new_candidate_types_bitset = kTypeIdToBitset.at(+TypeId::kString);
+        is_undefined = false;
+        if (first_type_id != +TypeId::kUndefined && cell_types.Has(first_type_id)) {
+            // undelimited and delimited dates have different bitsets
+            if (first_type_id == +TypeId::kDate && cell_types.is_delimited_date) {
+                candidate_types_bitset &= kTypeIdToBitset.at(first_type_id);
             }
+            continue;
+        }
 
-            candidate_types_bitset &= new_candidate_types_bitset;
-            if (candidate_types_bitset.none()) {
-                return +TypeId::kMixed;
-            }
+        TypeId const type_id = cell_types.GetFirstMatch();
+        if (first_type_id == +TypeId::kUndefined && type_id != +TypeId::kString) {
+            first_type_id = type_id;
+        }
+        std::bitset<5> new_candidate_types_bitset = kTypeIdToBitset.at(type_id);
+        // possible value types are known at the first match except for dates
+        // (undelimited dates could be ints or doubles and delimited couldn't)
+        if (type_id == +TypeId::kDate && cell_types.is_undelimited_date) {
+            new_candidate_types_bitset |= kTypeIdToBitset.at(+TypeId::kInt);
+        }
+
+        candidate_types_bitset &= new_candidate_types_bitset;
+        if (candidate_types_bitset.none()) {
+            return +TypeId::kMixed;
         }
     }
 
@@ -80,67 +95,48 @@ TypeId TypedColumnDataFactory::DeduceColumnType() const {
     return +TypeId::kMixed;
 }
 
-TypedColumnDataFactory::TypeMap TypedColumnDataFactory::CreateTypeMap(TypeId const type_id) const {
-    TypeMap type_map;
-    auto const match = [&type_map, type_id](std::string const& val, size_t const row) {
-        if (kNullCheck(val)) {
-            type_map[+TypeId::kNull].insert(row);
-        } else if (kEmptyCheck(val)) {
-            type_map[+TypeId::kEmpty].insert(row);
+TypedColumnDataFactory::TypesLayout TypedColumnDataFactory::CreateTypesLayout(
+        TypeId const type_id) const {
+    TypesLayout types_layout;
+    types_layout.reserve(unparsed_.size());
+    bool has_ints = false;
+    bool has_big_ints = false;
+    for (std::string const& val : unparsed_) {
+        CellTypes const cell_types = ClassifyCell(val);
+        if (cell_types.is_null) {
+            types_layout.push_back(TypeId::kNull);
+        } else if (cell_types.is_empty) {
+            types_layout.push_back(TypeId::kEmpty);
         } else if (type_id != +TypeId::kMixed) {
-            type_map[type_id].insert(row);
+            types_layout.push_back(type_id);
         } else {
-            bool matched = false;
-            for (auto const& [type_id, type_check] : kTypeIdToChecker) {
-                if (type_check(val)) {
-                    type_map[type_id].insert(row);
-                    matched = true;
-                    break;
-                }
-            }
-            if (!matched) {
-                type_map[TypeId::kString].insert(row);
-            }
+            TypeId const value_type_id = cell_types.GetFirstMatch();
+            has_ints |= value_type_id == +TypeId::kInt;
+            has_big_ints |= value_type_id == +TypeId::kBigInt;
+            types_layout.push_back(value_type_id);
         }
-    };
-
-    for (std::size_t i = 0; i != unparsed_.size(); ++i) {
-        match(unparsed_[i], i);
     }
 
-    if (type_map.count(TypeId::kBigInt) && type_map.count(TypeId::kInt)) {
-        std::unordered_set<size_t>& big_ints = type_map[TypeId::kBigInt];
-        std::unordered_set<size_t> ints = std::move(type_map.extract(TypeId::kInt).mapped());
-        big_ints.insert(ints.begin(), ints.end());
-    }
-
-    return type_map;
-}
-
-std::vector<TypeId> TypedColumnDataFactory::GetTypesLayout(TypeMap const& tm) const {
-    std::vector<TypeId> types_layout(unparsed_.size(), TypeId::kString);
-
-    for (auto const& [type_id, indices] : tm) {
-        for (size_t const index : indices) {
-            types_layout[index] = type_id;
-        }
+    if (has_big_ints && has_ints) {
+        std::replace(types_layout.begin(), types_layout.end(), +TypeId::kInt, +TypeId::kBigInt);
     }
 
     return types_layout;
 }
 
 TypedColumnDataFactory::TypeIdToType TypedColumnDataFactory::MapTypeIdsToTypes(
-        TypeMap const& tm) const {
+        TypesLayout const& types_layout) const {
     std::unordered_map<TypeId, std::unique_ptr<Type>> type_id_to_type;
-    for (auto const& [type_id, indices] : tm) {
-        type_id_to_type.emplace(type_id, CreateType(type_id, is_null_equal_null_));
+    for (TypeId const type_id : types_layout) {
+        if (type_id_to_type.find(type_id) == type_id_to_type.end()) {
+            type_id_to_type.emplace(type_id, CreateType(type_id, is_null_equal_null_));
+        }
     }
     return type_id_to_type;
 }
 
 size_t TypedColumnDataFactory::CalculateMixedBufSize(
-        std::vector<TypeId> const& types_layout,
-        TypeIdToType const& type_id_to_type) const noexcept {
+        TypesLayout const& types_layout, TypeIdToType const& type_id_to_type) const noexcept {
     size_t buf_size = 0;
     for (TypeId const type_id : types_layout) {
         size_t align = MixedType::GetAlignment(type_id);
@@ -150,27 +146,25 @@ size_t TypedColumnDataFactory::CalculateMixedBufSize(
     return buf_size;
 }
 
-TypedColumnData TypedColumnDataFactory::CreateMixedFromTypeMap(std::unique_ptr<Type const> type,
-                                                               TypeMap type_map) {
+TypedColumnData TypedColumnDataFactory::CreateMixedFromTypesLayout(
+        std::unique_ptr<Type const> type, TypesLayout types_layout) {
     assert(type->GetTypeId() == +TypeId::kMixed);
     MixedType const* mixed_type = static_cast<MixedType const*>(type.get());
     std::vector<std::byte const*> data;
     data.reserve(unparsed_.size());
 
-    std::unordered_set<size_t> const& nulls = type_map[TypeId::kNull];
-    std::unordered_set<size_t> const& empties = type_map[TypeId::kEmpty];
     size_t const rows_num = unparsed_.size();
-    size_t const nulls_num = nulls.size();
-    size_t const empties_num = empties.size();
+    size_t const nulls_num = std::count(types_layout.begin(), types_layout.end(), +TypeId::kNull);
+    size_t const empties_num =
+            std::count(types_layout.begin(), types_layout.end(), +TypeId::kEmpty);
 
-    TypeIdToType type_id_to_type = MapTypeIdsToTypes(type_map);
-    std::vector<TypeId> types_layout = GetTypesLayout(type_map);
+    TypeIdToType type_id_to_type = MapTypeIdsToTypes(types_layout);
     size_t const buf_size = CalculateMixedBufSize(types_layout, type_id_to_type);
     static_assert(kTypesMaxAlignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
                   "Overaligned types lead to a missaligned accesses to values in the current "
                   "implementation, which is UB");
-    std::unique_ptr<std::byte[]> buf(new std::byte[buf_size]);
-    type_map.clear(); /* type_map is no longer needed, so saving space */
+    std::unique_ptr<std::byte[]> buf(new std::byte[buf_size + CountViewChars(types_layout)]);
+    char* chars = reinterpret_cast<char*>(buf.get() + buf_size);
 
     size_t buf_index = 0;
     for (size_t i = 0; i != types_layout.size(); ++i) {
@@ -183,7 +177,11 @@ TypedColumnData TypedColumnDataFactory::CreateMixedFromTypeMap(std::unique_ptr<T
 
         assert(next + value_size <= buf.get() + buf_size);
 
-        mixed_type->ValueFromStr(next, std::move(unparsed_[i]), concrete_type);
+        if (IsView(type_id)) {
+            PlaceView(MixedType::SetTypeId(next, type_id), unparsed_[i], chars);
+        } else {
+            mixed_type->ValueFromStr(next, std::move(unparsed_[i]), concrete_type);
+        }
 
         data.push_back(next);
         buf_index += value_size;
@@ -193,20 +191,27 @@ TypedColumnData TypedColumnDataFactory::CreateMixedFromTypeMap(std::unique_ptr<T
                            std::move(buf), std::move(data), {}, {});
 }
 
-TypedColumnData TypedColumnDataFactory::CreateConcreteFromTypeMap(std::unique_ptr<Type const> type,
-                                                                  TypeMap type_map) {
+TypedColumnData TypedColumnDataFactory::CreateConcreteFromTypesLayout(
+        std::unique_ptr<Type const> type, TypesLayout types_layout) {
     TypeId const type_id = type->GetTypeId();
 
     if (type_id == +TypeId::kMixed) {
-        /* For mixed type use CreateMixedFromTypeMap. */
+        /* For mixed type use CreateMixedFromTypesLayout. */
         assert(0);
     }
 
-    std::unordered_set<size_t> nulls = std::move(type_map[TypeId::kNull]);
-    std::unordered_set<size_t> empties = std::move(type_map[TypeId::kEmpty]);
     size_t const rows_num = unparsed_.size();
-    size_t const nulls_num = nulls.size();
-    size_t const empties_num = empties.size();
+    boost::dynamic_bitset<> nulls(rows_num);
+    boost::dynamic_bitset<> empties(rows_num);
+    for (size_t i = 0; i != rows_num; ++i) {
+        if (types_layout[i] == +TypeId::kNull) {
+            nulls.set(i);
+        } else if (types_layout[i] == +TypeId::kEmpty) {
+            empties.set(i);
+        }
+    }
+    size_t const nulls_num = nulls.count();
+    size_t const empties_num = empties.count();
     assert(rows_num >= nulls_num + empties_num);
 
     std::vector<std::byte const*> data(unparsed_.size());
@@ -216,14 +221,25 @@ TypedColumnData TypedColumnDataFactory::CreateConcreteFromTypeMap(std::unique_pt
                                std::move(data), std::move(nulls), std::move(empties));
     }
 
-    std::unique_ptr<std::byte[]> buf(type->Allocate(rows_num - nulls_num - empties_num));
+    size_t const values_num = rows_num - nulls_num - empties_num;
+    size_t const value_size = type->GetSize();
+    bool const is_view = IsView(type_id);
+    std::unique_ptr<std::byte[]> buf(
+            new std::byte[value_size * values_num + (is_view ? CountViewChars(types_layout) : 0)]);
+    char* chars = reinterpret_cast<char*>(buf.get() + value_size * values_num);
 
     size_t buf_index = 0;
-    size_t const value_size = type->GetSize();
-    for (size_t i : type_map.at(type_id)) {
-        assert(buf_index <= type->GetSize() * type_map.at(type_id).size());
+    for (size_t i = 0; i != rows_num; ++i) {
+        if (types_layout[i] != type_id) {
+            continue;
+        }
+        assert(buf_index < value_size * values_num);
         std::byte* next = buf.get() + buf_index;
-        type->ValueFromStr(next, std::move(unparsed_[i]));
+        if (is_view) {
+            PlaceView(next, unparsed_[i], chars);
+        } else {
+            type->ValueFromStr(next, std::move(unparsed_[i]));
+        }
         data[i] = next;
         buf_index += value_size;
     }
@@ -232,20 +248,21 @@ TypedColumnData TypedColumnDataFactory::CreateConcreteFromTypeMap(std::unique_pt
                            std::move(buf), std::move(data), std::move(nulls), std::move(empties));
 }
 
-TypedColumnData TypedColumnDataFactory::CreateFromTypeMap(std::unique_ptr<Type const> type,
-                                                          TypeMap type_map) {
+TypedColumnData TypedColumnDataFactory::CreateFromTypesLayout(std::unique_ptr<Type const> type,
+                                                              TypesLayout types_layout) {
     if (type->GetTypeId() == +TypeId::kMixed) {
-        return CreateMixedFromTypeMap(std::move(type), std::move(type_map));
+        return CreateMixedFromTypesLayout(std::move(type), std::move(types_layout));
     } else {
-        return CreateConcreteFromTypeMap(std::move(type), std::move(type_map));
+        return CreateConcreteFromTypesLayout(std::move(type), std::move(types_layout));
     }
 }
 
 TypedColumnData TypedColumnDataFactory::CreateFrom() {
     TypeId const type_id = DeduceColumnType();
-    TypeMap type_map = CreateTypeMap(type_id);
+    TypesLayout types_layout = CreateTypesLayout(type_id);
 
-    return CreateFromTypeMap(CreateType(type_id, is_null_equal_null_), std::move(type_map));
+    return CreateFromTypesLayout(CreateType(type_id, is_null_equal_null_),
+                                 std::move(types_layout));
 }
 
 std::vector<TypedColumnData> CreateTypedColumnData(IDatasetStream& dataset_stream,
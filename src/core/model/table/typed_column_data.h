@@ -1,11 +1,14 @@
 #pragma once
 
 #include <bitset>
-#include <regex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <boost/dynamic_bitset.hpp>
+
 #include "abstract_column_data.h"
+#include "cell_type_classifier.h"
 #include "idataset_stream.h"
 #include "model/types/types.h"
 #include "relation_data.h"
@@ -19,15 +22,17 @@ private:
     size_t nulls_num_;
     size_t empties_num_;
     std::unique_ptr<std::byte[]> buffer_;
+    /* Values are laid out in the buffer in row order, so scans over data_ are sequential. The
+     * characters of strings and big ints follow the values, in the same order */
     std::vector<std::byte const*> data_;
-    /* For non-mixed type only */
-    std::unordered_set<size_t> nulls_;
-    std::unordered_set<size_t> empties_;
+    /* For non-mixed type only, i-th bit is set if the value in the i-th row is null (empty) */
+    boost::dynamic_bitset<> nulls_;
+    boost::dynamic_bitset<> empties_;
 
     TypedColumnData(Column const* column, std::unique_ptr<Type const> type, size_t const rows_num,
                     size_t nulls_num, size_t empties_num, std::unique_ptr<std::byte[]> buffer,
-                    std::vector<std::byte const*> data, std::unordered_set<size_t> nulls,
-                    std::unordered_set<size_t> empties) noexcept
+                    std::vector<std::byte const*> data, boost::dynamic_bitset<> nulls,
+                    boost::dynamic_bitset<> empties) noexcept
         : AbstractColumnData(column),
           type_(std::move(type)),
           rows_num_(rows_num),
@@ -51,16 +56,11 @@ public:
             return;
         }
 
+        // strings and big ints are views of the characters in the buffer, only dates are destroyed
         MixedType const* mixed = GetIfMixed();
         for (size_t i = 0; i != data_.size(); ++i) {
-            if (GetValueTypeId(i) == +TypeId::kString || GetValueTypeId(i) == +TypeId::kBigInt ||
-                GetValueTypeId(i) == +TypeId::kDate) {
-                std::byte const* value = (mixed) ? mixed->RetrieveValue(data_[i]) : data_[i];
-                if (GetValueTypeId(i) == +TypeId::kDate) {
-                    DateType::Destruct(value);
-                } else {
-                    StringType::Destruct(value);
-                }
+            if (GetValueTypeId(i) == +TypeId::kDate) {
+                DateType::Destruct((mixed) ? mixed->RetrieveValue(data_[i]) : data_[i]);
             }
         }
     }
@@ -110,7 +110,7 @@ public:
         if (mixed != nullptr) {
             return mixed->RetrieveTypeId(data_[index]) == +TypeId::kNull;
         } else {
-            return nulls_.find(index) != nulls_.end();
+            return nulls_.test(index);
         }
     }
 
@@ -119,7 +119,7 @@ public:
         if (mixed != nullptr) {
             return mixed->RetrieveTypeId(data_[index]) == +TypeId::kEmpty;
         } else {
-            return empties_.find(index) != empties_.end();
+            return empties_.test(index);
         }
     }
 
@@ -164,7 +164,8 @@ public:
 
 class TypedColumnDataFactory {
 private:
-    using TypeMap = std::unordered_map<TypeId, std::unordered_set<size_t>>;
+    /* Type of the value in each row */
+    using TypesLayout = std::vector<TypeId>;
     using TypeIdToType = std::unordered_map<TypeId, std::unique_ptr<Type>>;
 
     Column const* column_;
@@ -173,63 +174,6 @@ private:
 
     inline static std::vector<TypeId> const kAllCandidateTypes = {
             +TypeId::kDate, +TypeId::kInt, +TypeId::kBigInt, +TypeId::kDouble, +TypeId::kString};
-    inline static std::unordered_map<TypeId, std::regex> const kTypeIdToRegex = {
-            {+TypeId::kBigInt, std::regex(R"(^(\+|-)?\d{20,}$)")},
-            {+TypeId::kInt, std::regex(R"(^(\+|-)?\d{1,19}$)")},
-            {+TypeId::kNull, std::regex(Null::kValue.data())},
-            {+TypeId::kEmpty, std::regex(R"(^$)")}};
-    inline static auto const kNullCheck = [](std::string const& val) {
-        return std::regex_match(val, kTypeIdToRegex.at(+TypeId::kNull));
-    };
-    inline static auto const kEmptyCheck = [](std::string const& val) {
-        return std::regex_match(val, kTypeIdToRegex.at(+TypeId::kEmpty));
-    };
-    inline static std::function<bool(std::string const&)> const kUndelimitedDateCheck =
-            [](std::string const& val) {
-                bool is_undelimited_date = false;
-                try {
-                    boost::gregorian::from_undelimited_string(val);
-                    is_undelimited_date = true;
-                } catch (...) {
-                }
-                return is_undelimited_date;
-            };
-    inline static std::function<bool(std::string const&)> const kDelimitedDateCheck =
-            [](std::string const& val) {
-                bool is_simple_date = false;
-                try {
-                    boost::gregorian::from_simple_string(val);
-                    is_simple_date = true;
-                } catch (...) {
-                }
-                return is_simple_date;
-            };
-    inline static std::unordered_map<TypeId, std::function<bool(std::string const&)>> const
-            kTypeIdToChecker = {{TypeId::kDouble,
-                                 [](std::string const& val) {
-                                     bool is_double = false;
-                                     try {
-                                         std::size_t pos = 0;
-                                         std::stod(val, &pos);
-                                         if (pos == val.size()) {
-                                             is_double = true;
-                                         }
-                                     } catch (...) {
-                                     }
-                                     return is_double;
-                                 }},
-                                {TypeId::kBigInt,
-                                 [](std::string const& val) {
-                                     return std::regex_match(val,
-                                                             kTypeIdToRegex.at(+TypeId::kBigInt));
-                                 }},
-                                {TypeId::kInt,
-                                 [](std::string const& val) {
-                                     return std::regex_match(val, kTypeIdToRegex.at(+TypeId::kInt));
-                                 }},
-                                {TypeId::kDate, [](std::string const& val) {
-                                     return kDelimitedDateCheck(val) || kUndelimitedDateCheck(val);
-                                 }}};
     // each 1 represents a possible type from kAllCandidateTypes
     inline static std::unordered_map<TypeId, std::bitset<5>> const kTypeIdToBitset = {
             {+TypeId::kDate, std::bitset<5>("00001")},  // bitset for delimited dates
@@ -238,15 +182,19 @@ private:
             {+TypeId::kDouble, std::bitset<5>("01000")},
             {+TypeId::kString, std::bitset<5>("10000")}};
 
-    size_t CalculateMixedBufSize(std::vector<TypeId> const& types_layout,
+    size_t CalculateMixedBufSize(TypesLayout const& types_layout,
                                  TypeIdToType const& type_id_to_type) const noexcept;
-    std::vector<TypeId> GetTypesLayout(TypeMap const& tm) const;
-    TypeIdToType MapTypeIdsToTypes(TypeMap const& tm) const;
+    /* Number of characters of the strings and big ints, stored after the values */
+    size_t CountViewChars(TypesLayout const& types_layout) const noexcept;
+    TypeIdToType MapTypeIdsToTypes(TypesLayout const& types_layout) const;
     TypeId DeduceColumnType() const;
-    TypeMap CreateTypeMap(TypeId const type_id) const;
-    TypedColumnData CreateMixedFromTypeMap(std::unique_ptr<Type const> type, TypeMap type_map);
-    TypedColumnData CreateConcreteFromTypeMap(std::unique_ptr<Type const> type, TypeMap type_map);
-    TypedColumnData CreateFromTypeMap(std::unique_ptr<Type const> type, TypeMap type_map);
+    TypesLayout CreateTypesLayout(TypeId const type_id) const;
+    TypedColumnData CreateMixedFromTypesLayout(std::unique_ptr<Type const> type,
+                                               TypesLayout types_layout);
+    TypedColumnData CreateConcreteFromTypesLayout(std::unique_ptr<Type const> type,
+                                                  TypesLayout types_layout);
+    TypedColumnData CreateFromTypesLayout(std::unique_ptr<Type const> type,
+                                          TypesLayout types_layout);
     TypedColumnData CreateFrom();
 
     TypedColumnDataFactory(Column const* col, std::vector<std::string> unparsed,
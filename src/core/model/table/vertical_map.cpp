@@ -12,220 +12,201 @@
 namespace model {
 
 template <class Value>
-std::shared_ptr<Value> VerticalMap<Value>::SetTrie::Associate(Bitset const& key, size_t next_bit,
-                                                              std::shared_ptr<Value> value) {
-    next_bit = (next_bit == 0 ? key.find_first() : key.find_next(next_bit - 1));
-    if (next_bit == boost::dynamic_bitset<>::npos) {
-        std::swap(value, value_);
-        return value;
+typename VerticalMap<Value>::SetTrie::NodeId VerticalMap<Value>::SetTrie::FindChild(
+        NodeId node, size_t bit) const {
+    NodeId child = nodes_[node].first_child;
+    while (child != kNone && nodes_[child].bit < bit) {
+        child = nodes_[child].next_sibling;
     }
-    return GetOrCreateSubTrie(next_bit)->Associate(key, next_bit + 1, std::move(value));
-}
-
-template <class Value>
-std::shared_ptr<Value const> VerticalMap<Value>::SetTrie::Get(Bitset const& key,
-                                                              size_t next_bit) const {
-    next_bit = (next_bit == 0 ? key.find_first() : key.find_next(next_bit - 1));
-    if (next_bit == boost::dynamic_bitset<>::npos) {
-        return value_;
-    }
-
-    auto subtrie = GetSubtrie(next_bit);
-    if (subtrie == nullptr) return nullptr;
-    return subtrie->Get(key, next_bit + 1);
+    return child != kNone && nodes_[child].bit == bit ? child : kNone;
 }
 
 template <class Value>
-std::shared_ptr<Value> VerticalMap<Value>::SetTrie::Remove(Bitset const& key, size_t next_bit) {
-    next_bit = (next_bit == 0 ? key.find_first() : key.find_next(next_bit - 1));
-    if (next_bit == Bitset::npos) {
-        auto removed_value = value_;
-        value_ = nullptr;
-        return removed_value;
+typename VerticalMap<Value>::SetTrie::NodeId VerticalMap<Value>::SetTrie::GetOrCreateChild(
+        NodeId node, size_t bit) {
+    NodeId prev = kNone;
+    NodeId next = nodes_[node].first_child;
+    while (next != kNone && nodes_[next].bit < bit) {
+        prev = next;
+        next = nodes_[next].next_sibling;
     }
+    if (next != kNone && nodes_[next].bit == bit) return next;
 
-    auto subtrie = GetSubtrie(next_bit);
-    if (subtrie == nullptr) return nullptr;
-    auto removed_value = subtrie->Remove(key, next_bit + 1);
-    if (subtrie->IsEmpty()) {
-        subtries_[next_bit - offset_] = nullptr;
+    NodeId child;
+    if (free_nodes_.empty()) {
+        child = nodes_.size();
+        nodes_.emplace_back();
+    } else {
+        child = free_nodes_.back();
+        free_nodes_.pop_back();
     }
-
-    return removed_value;
+    nodes_[child] = Node{static_cast<std::uint32_t>(bit), kNone, next, kNone};
+    (prev == kNone ? nodes_[node].first_child : nodes_[prev].next_sibling) = child;
+    return child;
 }
 
 template <class Value>
-bool VerticalMap<Value>::SetTrie::IsEmpty() const {
-    if (value_ == nullptr) return false;
-    return std::all_of(subtries_.begin(), subtries_.end(),
-                       [](auto& subtrie_ptr) { return subtrie_ptr == nullptr; });
+void VerticalMap<Value>::SetTrie::UnlinkChild(NodeId parent, NodeId child) {
+    NodeId* link = &nodes_[parent].first_child;
+    while (*link != child) {
+        link = &nodes_[*link].next_sibling;
+    }
+    *link = nodes_[child].next_sibling;
+    free_nodes_.push_back(child);
 }
 
 template <class Value>
-typename VerticalMap<Value>::SetTrie* VerticalMap<Value>::SetTrie::GetOrCreateSubTrie(
-        size_t index) {
-    if (subtries_.empty()) {
-        subtries_ = std::vector<std::unique_ptr<SetTrie>>(dimension_ - offset_);
+std::shared_ptr<Value> VerticalMap<Value>::SetTrie::Associate(Bitset const& key,
+                                                              std::shared_ptr<Value> value) {
+    NodeId node = kRoot;
+    for (size_t bit = key.find_first(); bit != Bitset::npos; bit = key.find_next(bit)) {
+        node = GetOrCreateChild(node, bit);
     }
-    SetTrie* subtrie = GetSubtrie(index);
-    if (subtrie == nullptr) {
-        subtries_[index - offset_] = std::make_unique<SetTrie>(index + 1, dimension_);
+    ValueId& value_id = nodes_[node].value;
+    if (value_id != kNone) {
+        std::swap(value, values_[value_id]);
+        if (values_[value_id] == nullptr) {
+            free_values_.push_back(value_id);
+            value_id = kNone;
+        }
+        return value;
+    }
+    if (value == nullptr) return nullptr;
+    if (free_values_.empty()) {
+        value_id = values_.size();
+        values_.push_back(std::move(value));
+    } else {
+        value_id = free_values_.back();
+        free_values_.pop_back();
+        values_[value_id] = std::move(value);
     }
-    return subtries_[index - offset_].get();
+    return nullptr;
 }
 
 template <class Value>
-typename VerticalMap<Value>::SetTrie* VerticalMap<Value>::SetTrie::GetSubtrie(size_t index) {
-    return const_cast<VerticalMap<Value>::SetTrie*>(
-            (const_cast<VerticalMap<Value>::SetTrie const*>(this))->GetSubtrie(index));
+std::shared_ptr<Value const> VerticalMap<Value>::SetTrie::Get(Bitset const& key) const {
+    NodeId node = kRoot;
+    for (size_t bit = key.find_first(); bit != Bitset::npos; bit = key.find_next(bit)) {
+        node = FindChild(node, bit);
+        if (node == kNone) return nullptr;
+    }
+    return GetValue(node);
 }
 
 template <class Value>
-typename VerticalMap<Value>::SetTrie const* VerticalMap<Value>::SetTrie::GetSubtrie(
-        size_t index) const {
-    if (subtries_.empty()) {
-        return nullptr;
+std::shared_ptr<Value> VerticalMap<Value>::SetTrie::Remove(Bitset const& key) {
+    std::vector<NodeId> path{kRoot};
+    for (size_t bit = key.find_first(); bit != Bitset::npos; bit = key.find_next(bit)) {
+        NodeId child = FindChild(path.back(), bit);
+        if (child == kNone) return nullptr;
+        path.push_back(child);
     }
-    if (index < offset_ || index >= dimension_) {
-        throw std::runtime_error("Error in GetSubtrie: index must be in [offset_; dimension_)");
+    ValueId& value_id = nodes_[path.back()].value;
+    if (value_id == kNone) return nullptr;
+
+    std::shared_ptr<Value> removed_value = std::move(values_[value_id]);
+    free_values_.push_back(value_id);
+    value_id = kNone;
+    // drop the nodes that lead to no entries anymore
+    for (size_t i = path.size() - 1; i > 0; --i) {
+        Node const& node = nodes_[path[i]];
+        if (node.value != kNone || node.first_child != kNone) break;
+        UnlinkChild(path[i - 1], path[i]);
     }
-    return subtries_[index - offset_].get();
+    return removed_value;
 }
 
 template <class Value>
 void VerticalMap<Value>::SetTrie::TraverseEntries(
-        Bitset& subset_key,
-        std::function<void(Bitset const&, std::shared_ptr<Value const>)> collector) const {
-    if (value_ != nullptr) {
-        collector(Bitset(subset_key), value_);
+        NodeId node, Bitset& subset_key,
+        std::function<void(Bitset const&, std::shared_ptr<Value const>)> const& collector) const {
+    if (nodes_[node].value != kNone) {
+        collector(subset_key, GetValue(node));
     }
-    for (size_t i = offset_; i < dimension_; i++) {
-        auto subtrie = GetSubtrie(i);
-        if (subtrie != nullptr) {
-            subset_key.set(i);
-            subtrie->TraverseEntries(subset_key, collector);
-            subset_key.reset(i);
-        }
+    for (NodeId child = nodes_[node].first_child; child != kNone;
+         child = nodes_[child].next_sibling) {
+        subset_key.set(nodes_[child].bit);
+        TraverseEntries(child, subset_key, collector);
+        subset_key.reset(nodes_[child].bit);
     }
 }
 
 template <class Value>
-bool VerticalMap<Value>::SetTrie::CollectSubsetKeys(
-        Bitset const& key, size_t next_bit, Bitset& subset_key,
-        std::function<bool(Bitset const&, std::shared_ptr<Value const>)> const& collector) const {
-    if (value_ != nullptr) {
-        if (!collector(Bitset(subset_key), value_)) return false;
-    }
+void VerticalMap<Value>::SetTrie::TraverseEntries(
+        size_t num_bits,
+        std::function<void(Bitset const&, std::shared_ptr<Value const>)> const& collector) const {
+    Bitset subset_key(num_bits);
+    TraverseEntries(kRoot, subset_key, collector);
+}
 
-    for (next_bit = (next_bit == 0 ? key.find_first() : key.find_next(next_bit - 1));
-         next_bit != Bitset::npos; next_bit = key.find_next(next_bit)) {
-        auto subtrie = GetSubtrie(next_bit);
-        if (subtrie != nullptr) {
-            subset_key.set(next_bit);
-            if (!subtrie->CollectSubsetKeys(key, next_bit + 1, subset_key, collector)) return false;
-            subset_key.reset(next_bit);
-        }
+template <class Value>
+bool VerticalMap<Value>::SetTrie::CollectSubsetKeys(NodeId node, Bitset const& key,
+                                                    Bitset& subset_key,
+                                                    Collector const& collector) const {
+    if (nodes_[node].value != kNone) {
+        if (!collector(subset_key, GetValue(node))) return false;
+    }
+    for (NodeId child = nodes_[node].first_child; child != kNone;
+         child = nodes_[child].next_sibling) {
+        size_t const bit = nodes_[child].bit;
+        if (!key.test(bit)) continue;
+        subset_key.set(bit);
+        if (!CollectSubsetKeys(child, key, subset_key, collector)) return false;
+        subset_key.reset(bit);
     }
     return true;
 }
 
 template <class Value>
-bool VerticalMap<Value>::SetTrie::CollectSupersetKeys(
-        Bitset const& key, size_t next_bit, Bitset& superset_key,
-        std::function<bool(Bitset const&, std::shared_ptr<Value const>)> const& collector) const {
-    if (next_bit != Bitset::npos) {
-        next_bit = (next_bit == 0 ? key.find_first() : key.find_next(next_bit - 1));
-    }
-    if (next_bit == Bitset::npos) {
-        if (value_ != nullptr) {
-            if (!collector(Bitset(superset_key), value_)) return false;
-        }
-        for (size_t i = offset_; i < dimension_; i++) {
-            auto subtrie = GetSubtrie(i);
-            if (subtrie != nullptr) {
-                superset_key.set(i);
-                if (!subtrie->CollectSupersetKeys(key, next_bit, superset_key, collector))
-                    return false;
-                superset_key.reset(i);
-            }
-        }
-    } else {
-        for (size_t i = offset_; i < next_bit; i++) {
-            auto subtrie = GetSubtrie(i);
-            if (subtrie != nullptr) {
-                superset_key.set(i);
-                if (!subtrie->CollectSupersetKeys(key, next_bit, superset_key, collector))
-                    return false;
-                superset_key.reset(i);
-            }
-        }
+bool VerticalMap<Value>::SetTrie::CollectSubsetKeys(Bitset const& key,
+                                                    Collector const& collector) const {
+    Bitset subset_key(key.size());
+    return CollectSubsetKeys(kRoot, key, subset_key, collector);
+}
 
-        auto subtrie = GetSubtrie(next_bit);
-        if (subtrie != nullptr) {
-            superset_key.set(next_bit);
-            if (!subtrie->CollectSupersetKeys(key, next_bit + 1, superset_key, collector))
-                return false;
-            superset_key.reset(next_bit);
+// next_bit is the smallest bit of the key that is not on the path yet
+template <class Value>
+bool VerticalMap<Value>::SetTrie::CollectSupersetKeys(NodeId node, Bitset const& key,
+                                                      size_t next_bit, Bitset const* blacklist,
+                                                      Bitset& superset_key,
+                                                      Collector const& collector) const {
+    if (next_bit == Bitset::npos && nodes_[node].value != kNone) {
+        if (!collector(superset_key, GetValue(node))) return false;
+    }
+    for (NodeId child = nodes_[node].first_child; child != kNone;
+         child = nodes_[child].next_sibling) {
+        size_t const bit = nodes_[child].bit;
+        // the bits grow along a path, so next_bit can not be added after a greater one
+        if (bit > next_bit) break;
+        if (blacklist != nullptr && blacklist->test(bit)) continue;
+        superset_key.set(bit);
+        if (!CollectSupersetKeys(child, key, bit == next_bit ? key.find_next(bit) : next_bit,
+                                 blacklist, superset_key, collector)) {
+            return false;
         }
+        superset_key.reset(bit);
     }
     return true;
 }
 
 template <class Value>
-bool VerticalMap<Value>::SetTrie::CollectRestrictedSupersetKeys(
-        Bitset const& key, Bitset const& blacklist, size_t next_bit, Bitset& superset_key,
-        std::function<void(Bitset const&, std::shared_ptr<Value const>)> const& collector) const {
-    if (next_bit != Bitset::npos) {
-        next_bit = (next_bit == 0 ? key.find_first() : key.find_next(next_bit - 1));
-    }
-    if (next_bit == Bitset::npos) {
-        if (value_ != nullptr) {
-            collector(Bitset(superset_key), value_);
-        }
-        for (size_t i = offset_; i < dimension_; i++) {
-            if (blacklist.test(i)) continue;
-            auto subtrie = GetSubtrie(i);
-            if (subtrie != nullptr) {
-                superset_key.set(i);
-                if (!subtrie->CollectRestrictedSupersetKeys(key, blacklist, next_bit, superset_key,
-                                                            collector)) {
-                    return false;
-                }
-                superset_key.reset(i);
-            }
-        }
-    } else {
-        for (size_t i = offset_; i < next_bit; i++) {
-            if (blacklist.test(i)) continue;
-            auto subtrie = GetSubtrie(i);
-            if (subtrie != nullptr) {
-                superset_key.set(i);
-                if (!subtrie->CollectRestrictedSupersetKeys(key, blacklist, next_bit, superset_key,
-                                                            collector)) {
-                    return false;
-                }
-                superset_key.reset(i);
-            }
-        }
+bool VerticalMap<Value>::SetTrie::CollectSupersetKeys(Bitset const& key,
+                                                      Collector const& collector) const {
+    Bitset superset_key(key.size());
+    return CollectSupersetKeys(kRoot, key, key.find_first(), nullptr, superset_key, collector);
+}
 
-        auto subtrie = GetSubtrie(next_bit);
-        if (subtrie != nullptr) {
-            superset_key.set(next_bit);
-            if (!subtrie->CollectRestrictedSupersetKeys(key, blacklist, next_bit + 1, superset_key,
-                                                        collector)) {
-                return false;
-            }
-            superset_key.reset(next_bit);
-        }
-    }
-    return true;
+template <class Value>
+void VerticalMap<Value>::SetTrie::CollectRestrictedSupersetKeys(
+        Bitset const& key, Bitset const& blacklist, Collector const& collector) const {
+    Bitset superset_key(key.size());
+    CollectSupersetKeys(kRoot, key, key.find_first(), &blacklist, superset_key, collector);
 }
 
 template <class Value>
 std::vector<Vertical> VerticalMap<Value>::GetSubsetKeys(Vertical const& vertical) const {
     std::vector<Vertical> subset_keys;
-    Bitset subset_key(relation_->GetNumColumns());
-    set_trie_.CollectSubsetKeys(vertical.GetColumnIndices(), 0, subset_key,
+    set_trie_.CollectSubsetKeys(vertical.GetColumnIndices(),
                                 [&subset_keys, this](auto& indices, [[maybe_unused]] auto value) {
                                     subset_keys.push_back(relation_->GetVertical(indices));
                                     return true;
@@ -237,8 +218,7 @@ template <class Value>
 std::vector<typename VerticalMap<Value>::Entry> VerticalMap<Value>::GetSubsetEntries(
         Vertical const& vertical) const {
     std::vector<typename VerticalMap<Value>::Entry> entries;
-    Bitset subset_key(relation_->GetNumColumns());
-    set_trie_.CollectSubsetKeys(vertical.GetColumnIndices(), 0, subset_key,
+    set_trie_.CollectSubsetKeys(vertical.GetColumnIndices(),
                                 [&entries, this](auto& indices, auto value) {
                                     entries.emplace_back(relation_->GetVertical(indices), value);
                                     return true;
@@ -251,8 +231,7 @@ template <class Value>
 typename VerticalMap<Value>::Entry VerticalMap<Value>::GetAnySubsetEntry(
         Vertical const& vertical) const {
     typename VerticalMap<Value>::Entry entry;
-    Bitset subset_key(relation_->GetNumColumns());
-    set_trie_.CollectSubsetKeys(vertical.GetColumnIndices(), 0, subset_key,
+    set_trie_.CollectSubsetKeys(vertical.GetColumnIndices(),
                                 [&entry, this](auto& indices, auto value) {
                                     entry = {relation_->GetVertical(indices), value};
                                     return false;
@@ -265,8 +244,7 @@ typename VerticalMap<Value>::Entry VerticalMap<Value>::GetAnySubsetEntry(
         Vertical const& vertical,
         std::function<bool(Vertical const*, std::shared_ptr<Value const>)> const& condition) const {
     typename VerticalMap<Value>::Entry entry;
-    Bitset subset_key(relation_->GetNumColumns());
-    set_trie_.CollectSubsetKeys(vertical.GetColumnIndices(), 0, subset_key,
+    set_trie_.CollectSubsetKeys(vertical.GetColumnIndices(),
                                 [&entry, this, &condition](auto& indices, auto value) {
                                     auto kv = relation_->GetVertical(indices);
                                     if (condition(&kv, value)) {
@@ -283,8 +261,7 @@ template <class Value>
 std::vector<typename VerticalMap<Value>::Entry> VerticalMap<Value>::GetSupersetEntries(
         Vertical const& vertical) const {
     std::vector<typename VerticalMap<Value>::Entry> entries;
-    Bitset superset_key(relation_->GetNumColumns());
-    set_trie_.CollectSupersetKeys(vertical.GetColumnIndices(), 0, superset_key,
+    set_trie_.CollectSupersetKeys(vertical.GetColumnIndices(),
                                   [&entries, this](auto& indices, auto value) {
                                       entries.emplace_back(relation_->GetVertical(indices), value);
                                       return true;
@@ -296,8 +273,7 @@ template <class Value>
 typename VerticalMap<Value>::Entry VerticalMap<Value>::GetAnySupersetEntry(
         Vertical const& vertical) const {
     typename VerticalMap<Value>::Entry entry;
-    Bitset superset_key(relation_->GetNumColumns());
-    set_trie_.CollectSupersetKeys(vertical.GetColumnIndices(), 0, superset_key,
+    set_trie_.CollectSupersetKeys(vertical.GetColumnIndices(),
                                   [&entry, this](auto& indices, auto value) {
                                       entry = {relation_->GetVertical(indices), value};
                                       return false;
@@ -310,8 +286,7 @@ typename VerticalMap<Value>::Entry VerticalMap<Value>::GetAnySupersetEntry(
         Vertical const& vertical,
         std::function<bool(Vertical const*, std::shared_ptr<Value const>)> condition) const {
     typename VerticalMap<Value>::Entry entry;
-    Bitset superset_key(relation_->GetNumColumns());
-    set_trie_.CollectSupersetKeys(vertical.GetColumnIndices(), 0, superset_key,
+    set_trie_.CollectSupersetKeys(vertical.GetColumnIndices(),
                                   [&entry, this, &condition](auto& indices, auto value) {
                                       auto kv = relation_->GetVertical(indices);
                                       if (condition(&kv, value)) {
@@ -333,9 +308,8 @@ std::vector<typename VerticalMap<Value>::Entry> VerticalMap<Value>::GetRestricte
                 "restriction");
 
     std::vector<typename VerticalMap<Value>::Entry> entries;
-    Bitset superset_key(relation_->GetNumColumns());
     set_trie_.CollectRestrictedSupersetKeys(
-            vertical.GetColumnIndices(), exclusion.GetColumnIndices(), 0, superset_key,
+            vertical.GetColumnIndices(), exclusion.GetColumnIndices(),
             [&entries, this](auto& indices, auto value) {
                 entries.emplace_back(relation_->GetVertical(indices), value);
                 return true;
@@ -364,30 +338,30 @@ bool VerticalMap<Value>::RemoveSubsetEntries(Vertical const& key) {
 template <class Value>
 std::unordered_set<Vertical> VerticalMap<Value>::KeySet() {
     std::unordered_set<Vertical> key_set;
-    Bitset subset_key(relation_->GetNumColumns());
-    set_trie_.TraverseEntries(subset_key, [&key_set, this](auto& k, [[maybe_unused]] auto v) {
-        key_set.insert(relation_->GetVertical(k));
-    });
+    set_trie_.TraverseEntries(relation_->GetNumColumns(),
+                              [&key_set, this](auto& k, [[maybe_unused]] auto v) {
+                                  key_set.insert(relation_->GetVertical(k));
+                              });
     return key_set;
 }
 
 template <class Value>
 std::vector<std::shared_ptr<Value const>> VerticalMap<Value>::Values() {
     std::vector<std::shared_ptr<Value const>> values;
-    Bitset subset_key(relation_->GetNumColumns());
-    set_trie_.TraverseEntries(subset_key, [&values]([[maybe_unused]] auto& k, auto v) -> void {
-        values.push_back(v);
-    });
+    set_trie_.TraverseEntries(relation_->GetNumColumns(),
+                              [&values]([[maybe_unused]] auto& k, auto v) -> void {
+                                  values.push_back(v);
+                              });
     return values;
 }
 
 template <class Value>
 std::unordered_set<typename VerticalMap<Value>::Entry> VerticalMap<Value>::EntrySet() {
     std::unordered_set<typename VerticalMap<Value>::Entry> entry_set;
-    Bitset subset_key(relation_->GetNumColumns());
-    set_trie_.TraverseEntries(subset_key, [&entry_set, this](auto& k, auto v) -> void {
-        entry_set.emplace(relation_->GetVertical(k), v);
-    });
+    set_trie_.TraverseEntries(relation_->GetNumColumns(),
+                              [&entry_set, this](auto& k, auto v) -> void {
+                                  entry_set.emplace(relation_->GetVertical(k), v);
+                              });
     return entry_set;
 }
 
@@ -399,14 +373,14 @@ unsigned int VerticalMap<Value>::RemoveFromUsageCounter(
 
 template <class Value>
 std::shared_ptr<Value> VerticalMap<Value>::Remove(Vertical const& key) {
-    auto removed_value = set_trie_.Remove(key.GetColumnIndices(), 0);
+    auto removed_value = set_trie_.Remove(key.GetColumnIndices());
     if (removed_value != nullptr) size_--;
     return removed_value;
 }
 
 template <class Value>
 std::shared_ptr<Value> VerticalMap<Value>::Remove(VerticalMap::Bitset const& key) {
-    auto removed_value = set_trie_.Remove(key, 0);
+    auto removed_value = set_trie_.Remove(key);
     if (removed_value != nullptr) size_--;
     return removed_value;
 }
@@ -419,12 +393,13 @@ void VerticalMap<Value>::Shrink(double factor, std::function<bool(Entry, Entry)>
 
     std::priority_queue<Entry, std::vector<Entry>, std::function<bool(Entry, Entry)>> key_queue(
             compare, std::vector<Entry>(size_));
-    Bitset subset_key(relation_->GetNumColumns());
-    set_trie_.TraverseEntries(subset_key, [&key_queue, this, &can_remove](auto& k, auto v) {
-        if (Entry entry(relation_->GetVertical(k), v); can_remove(entry)) {
-            key_queue.push(entry);
-        }
-    });
+    set_trie_.TraverseEntries(relation_->GetNumColumns(),
+                              [&key_queue, this, &can_remove](auto& k, auto v) {
+                                  Entry entry(relation_->GetVertical(k), v);
+                                  if (can_remove(entry)) {
+                                      key_queue.push(entry);
+                                  }
+                              });
     unsigned int num_of_removed = 0;
     unsigned int target_size = size_ * factor;
     while (!key_queue.empty() && size_ > target_size) {
@@ -457,9 +432,8 @@ void VerticalMap<Value>::Shrink(std::unordered_map<Vertical, unsigned int>& usag
                                            : usage_counters[usage_counters.size() / 2];
 
     std::queue<Entry> key_queue;
-    Bitset subset_key(relation_->GetNumColumns());
     set_trie_.TraverseEntries(
-            subset_key,
+            relation_->GetNumColumns(),
             [&key_queue, this, &can_remove, &usage_counter, median_of_usage](auto& k,
                                                                              auto v) -> void {
                 if (Entry entry(relation_->GetVertical(k), v);
@@ -490,7 +464,7 @@ void VerticalMap<Value>::Shrink(std::unordered_map<Vertical, unsigned int>& usag
 
 template <class Value>
 std::shared_ptr<Value> VerticalMap<Value>::Put(Vertical const& key, std::shared_ptr<Value> value) {
-    auto old_value = set_trie_.Associate(key.GetColumnIndices(), 0, std::move(value));
+    auto old_value = set_trie_.Associate(key.GetColumnIndices(), std::move(value));
     if (old_value == nullptr) size_++;
 
     return old_value;
@@ -498,17 +472,17 @@ std::shared_ptr<Value> VerticalMap<Value>::Put(Vertical const& key, std::shared_
 
 template <class Value>
 std::shared_ptr<Value const> VerticalMap<Value>::Get(Vertical const& key) const {
-    return set_trie_.Get(key.GetColumnIndices(), 0);
+    return set_trie_.Get(key.GetColumnIndices());
 }
 
 template <class Value>
 std::shared_ptr<Value> VerticalMap<Value>::Get(Vertical const& key) {
-    return std::const_pointer_cast<Value>(set_trie_.Get(key.GetColumnIndices(), 0));
+    return std::const_pointer_cast<Value>(set_trie_.Get(key.GetColumnIndices()));
 }
 
 template <class Value>
 std::shared_ptr<Value const> VerticalMap<Value>::Get(Bitset const& key) const {
-    return set_trie_.Get(key, 0);
+    return set_trie_.Get(key);
 }
 
 // explicitly instantiate to solve template implementation linking issues
@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <shared_mutex>
 #include <unordered_map>
@@ -23,70 +25,78 @@ protected:
 
     // typename std::shared_ptr<Value> shared_ptr<Value>;
 
-    // Each node corresponds to a bit in a bitset. Each node also has a vector of the possible
-    // consequent set bits.
+    // A trie of the keys stored in a flat node pool. Each node corresponds to a set bit and
+    // refers to its first child and its next sibling, siblings are sorted by their bits, so only
+    // the existing branches are stored and are traversed in the ascending order of bits.
     class SetTrie {
-    private:
-        size_t offset_;
-        size_t dimension_;
-        std::vector<std::unique_ptr<SetTrie>> subtries_;  // unique_ptr?
-        std::shared_ptr<Value> value_;
-
-        bool IsEmpty() const;
-
     public:
-        explicit SetTrie(size_t dimension) : SetTrie(0, dimension) {}
+        using Collector = std::function<bool(Bitset const&, std::shared_ptr<Value const>)>;
 
-        SetTrie(size_t offset, size_t dimension) : offset_(offset), dimension_(dimension) {}
+    private:
+        using NodeId = std::uint32_t;
+        using ValueId = std::uint32_t;
+
+        static constexpr std::uint32_t kNone = std::numeric_limits<std::uint32_t>::max();
+
+        struct Node {
+            std::uint32_t bit;
+            NodeId first_child = kNone;
+            NodeId next_sibling = kNone;
+            ValueId value = kNone;
+        };
+
+        static constexpr NodeId kRoot = 0;
+
+        std::vector<Node> nodes_{Node{0}};
+        std::vector<std::shared_ptr<Value>> values_;
+        std::vector<NodeId> free_nodes_;
+        std::vector<ValueId> free_values_;
+
+        NodeId FindChild(NodeId node, size_t bit) const;
+        NodeId GetOrCreateChild(NodeId node, size_t bit);
+        void UnlinkChild(NodeId parent, NodeId child);
+
+        std::shared_ptr<Value const> GetValue(NodeId node) const {
+            return nodes_[node].value == kNone ? nullptr : values_[nodes_[node].value];
+        }
+
+        bool CollectSubsetKeys(NodeId node, Bitset const& key, Bitset& subset_key,
+                               Collector const& collector) const;
+        bool CollectSupersetKeys(NodeId node, Bitset const& key, size_t next_bit,
+                                 Bitset const* blacklist, Bitset& superset_key,
+                                 Collector const& collector) const;
+        void TraverseEntries(NodeId node, Bitset& subset_key,
+                             std::function<void(Bitset const&, std::shared_ptr<Value const>)> const&
+                                     collector) const;
 
+    public:
         // Sets given key to a given value
         // Returns the old value with ownership
-        // Not a const method as SetTrie gets changed
-        std::shared_ptr<Value> Associate(Bitset const& key, size_t next_bit,
-                                         std::shared_ptr<Value> value);
+        std::shared_ptr<Value> Associate(Bitset const& key, std::shared_ptr<Value> value);
 
         // Returns a pointer to the value mapped by the given key
-        std::shared_ptr<Value const> Get(Bitset const& key, size_t next_bit) const;
+        std::shared_ptr<Value const> Get(Bitset const& key) const;
 
-        // Erases an entry with the given key
+        // Erases an entry with the given key and the branches left without entries
         // Returns the old value with ownership
-        std::shared_ptr<Value> Remove(Bitset const& key, size_t next_bit);
-
-        // Gets the subtrie with the given index. If such a subtrie does not exist, creates one
-        // Not a const method as a SetTrie may be created
-        SetTrie* GetOrCreateSubTrie(size_t index);
-
-        // Gets the subtrie with the given index
-        // Non-const version of the method -- needed in getOrCreateSubtrie to manipulate SetTrie*
-        SetTrie* GetSubtrie(size_t index);
+        std::shared_ptr<Value> Remove(Bitset const& key);
 
-        // Gets the subtrie with the given index
-        // Const version of the method
-        SetTrie const* GetSubtrie(size_t index) const;
+        // Calls collector on every entry with a key that is a subset of the given key
+        bool CollectSubsetKeys(Bitset const& key, Collector const& collector) const;
 
-        // Calls collector on every trie that is a subset of the given subset_key
-        bool CollectSubsetKeys(
-                Bitset const& key, size_t next_bit, Bitset& subset_key,
-                std::function<bool(Bitset const&, std::shared_ptr<Value const>)> const& collector)
-                const;
+        // Calls collector on every entry with a key that is a superset of the given key
+        bool CollectSupersetKeys(Bitset const& key, Collector const& collector) const;
 
-        // Calls collector on every trie that is a superset of the given subsetKey
-        bool CollectSupersetKeys(
-                Bitset const& key, size_t next_bit, Bitset& superset_key,
-                std::function<bool(Bitset const&, std::shared_ptr<Value const>)> const& collector)
-                const;
-
-        // Calls collector on every trie that is a superset of the given subsetKey with no bits from
-        // the blacklist
-        bool CollectRestrictedSupersetKeys(
-                Bitset const& key, Bitset const& blacklist, size_t next_bit, Bitset& superset_key,
-                std::function<void(Bitset const&, std::shared_ptr<Value const>)> const& collector)
-                const;
+        // Calls collector on every entry with a key that is a superset of the given key and has no
+        // bits from the blacklist
+        void CollectRestrictedSupersetKeys(Bitset const& key, Bitset const& blacklist,
+                                           Collector const& collector) const;
 
         // Calls collector on every entry
         void TraverseEntries(
-                Bitset& subset_key,
-                std::function<void(Bitset const&, std::shared_ptr<Value const>)> collector) const;
+                size_t num_bits,
+                std::function<void(Bitset const&, std::shared_ptr<Value const>)> const& collector)
+                const;
     };
 
     RelationalSchema const* relation_;
@@ -101,8 +111,7 @@ protected:
 public:
     using Entry = std::pair<Vertical, std::shared_ptr<Value const>>;
 
-    explicit VerticalMap(RelationalSchema const* relation)
-        : relation_(relation), set_trie_(relation->GetNumColumns()) {}
+    explicit VerticalMap(RelationalSchema const* relation) : relation_(relation) {}
 
     virtual size_t GetSize() const {
         return size_;
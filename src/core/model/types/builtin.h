@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <string>
+#include <string_view>
 
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/serialization/strong_typedef.hpp>
@@ -16,13 +18,15 @@ namespace model {
 using Int = int64_t; /* Type of any integer value that fits into int64 */
 
 namespace details {
-BOOST_STRONG_TYPEDEF(std::string, Placeholder);
+BOOST_STRONG_TYPEDEF(std::string_view, Placeholder);
 }  // namespace details
 
 using BigInt = details::Placeholder; /* Type of an integer that don't fit into Int */
 using Double = double; /* Fixed-precision floating point value; also we need type for values
                         * with arbitrary precision analogous to BigInt */
-using String = std::string;
+/* Strings and big ints are views of characters stored with the value, or in the buffer of the
+ * column holding it */
+using String = std::string_view;
 using Date = boost::gregorian::date; /* Date in the range from 1400-Jan-01 to 9999-Dec-31 */
 
 static_assert(sizeof(Int) == sizeof(Double));
@@ -81,16 +85,6 @@ struct TypeConverter<Double> {
     inline static constexpr auto kConvert = [](std::string const& v) { return std::stold(v); };
 };
 
-template <>
-struct TypeConverter<BigInt> {
-    inline static constexpr auto kConvert = [](std::string& v) { return BigInt(std::move(v)); };
-};
-
-template <>
-struct TypeConverter<String> {
-    inline static constexpr auto kConvert = [](std::string& v) { return std::move(v); };
-};
-
 template <>
 struct TypeConverter<Null> {
     inline static constexpr auto kConvert = [](std::string const& v) {
@@ -60,17 +60,14 @@ public:
     }
 
     [[nodiscard]] CompareResult CompareAsStrings(std::byte const* l, std::byte const* r) const {
-        String l_str = this->ValueToString(l);
-        String r_str = this->ValueToString(r);
+        std::string const l_str = this->ValueToString(l);
+        std::string const r_str = this->ValueToString(r);
 
         return StringType::Compare(l_str, r_str);
     }
 
     void Free(std::byte const* value) const noexcept override {
         TypeId const type_id = RetrieveTypeId(value);
-        if (type_id == +TypeId::kString || type_id == +TypeId::kBigInt) {
-            StringType::Destruct(RetrieveValue(value));
-        }
         if (type_id == +TypeId::kDate) {
             DateType::Destruct(RetrieveValue(value));
         }
@@ -90,13 +87,14 @@ public:
     // Clone(std::byte const* value, std::byte const* new_value)
     [[nodiscard]] std::byte* Clone(std::byte const* value) const override {
         std::unique_ptr<Type> type = RetrieveType(value);
-        size_t size = GetMixedValueSize(type.get());
-        auto* new_value = new std::byte[size];
-        ValueFromStr(new_value, ValueToString(value), type.get());
+        std::string string = ValueToString(value);
+        auto* new_value = new std::byte[GetMixedValueSize(type.get(), string.size())];
+        ValueFromStr(new_value, std::move(string), type.get());
         return new_value;
     }
 
-    /* Note: first kTypeIdSize bytes of dest should contain type_id to cast to */
+    /* Note: first kTypeIdSize bytes of dest should contain type_id to cast to, strings and big
+     * ints need GetMixedValueSize(type, s.size()) bytes */
     void ValueFromStr(std::byte* dest, std::string s) const final {
         std::unique_ptr<Type> type = RetrieveType(dest);
         type->ValueFromStr(RetrieveValue(dest), s);
@@ -166,6 +164,16 @@ public:
     [[nodiscard]] static size_t GetMixedValueSize(Type const* type) noexcept {
         return GetTypeIdSizeWithPadding(type->GetTypeId()) + type->GetSize();
     }
+
+    /* Size of a value made from a string of the given length, strings and big ints keep their
+     * characters after the view */
+    [[nodiscard]] static size_t GetMixedValueSize(Type const* type, size_t length) noexcept {
+        TypeId const type_id = type->GetTypeId();
+        if (type_id == +TypeId::kString || type_id == +TypeId::kBigInt) {
+            return GetTypeIdSizeWithPadding(type_id) + StringType::GetValueSize(length);
+        }
+        return GetMixedValueSize(type);
+    }
 };
 
 }  // namespace model
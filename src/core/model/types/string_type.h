@@ -1,27 +1,28 @@
 #pragma once
 
+#include <cstring>
+#include <string>
+
 #include "imetrizable_type.h"
 #include "type.h"
 #include "util/levenshtein_distance.h"
 
 namespace model {
 
+/* A value is a String view of its characters. Values made by the type keep the characters right
+ * after the view, typed column data keeps the characters of all its values in its buffer.
+ */
 class StringType : public IMetrizableType {
 public:
     /* type_id parameter is temporary for BigIntType */
     explicit StringType(TypeId type_id = TypeId::kString) noexcept : IMetrizableType(type_id) {}
 
-    void Free(std::byte const* value) const noexcept override {
-        Destruct(value);
-        Type::Free(value);
-    }
-
     [[nodiscard]] std::string ValueToString(std::byte const* value) const override {
-        return GetValue<String>(value);
+        return std::string(GetValue<String>(value));
     }
 
     [[nodiscard]] std::byte* Clone(std::byte const* value) const override {
-        return MakeValue(ValueToString(value));
+        return MakeValue(GetValue<String>(value));
     }
 
     [[nodiscard]] std::unique_ptr<Type> CloneType() const override {
@@ -29,31 +30,44 @@ public:
     }
 
     [[nodiscard]] CompareResult Compare(std::byte const* l, std::byte const* r) const override {
-        auto const& l_val = GetValue<String>(l);
-        auto const& r_val = GetValue<String>(r);
-
-        return Compare(l_val, r_val);
+        return Compare(GetValue<String>(l), GetValue<String>(r));
     }
 
     [[nodiscard]] size_t Hash(std::byte const* value) const override {
         return std::hash<String>()(GetValue<String>(value));
     }
 
+    /* Size of the view only, see GetValueSize() */
     [[nodiscard]] size_t GetSize() const override {
         return sizeof(String);
     }
 
+    /* dest must have GetValueSize(s.size()) bytes */
     void ValueFromStr(std::byte* dest, std::string s) const override {
-        new (dest) String(std::move(s));
+        ValueFromChars(dest, s);
+    }
+
+    /* Size of a value that keeps length characters after the view */
+    [[nodiscard]] static size_t GetValueSize(size_t length) noexcept {
+        return sizeof(String) + length;
+    }
+
+    /* Copies the characters right after the view written to dest */
+    static void ValueFromChars(std::byte* dest, String chars) noexcept {
+        char* copy = reinterpret_cast<char*>(dest + sizeof(String));
+        if (!chars.empty()) {
+            std::memcpy(copy, chars.data(), chars.size());
+        }
+        new (dest) String(copy, chars.size());
     }
 
-    [[nodiscard]] std::byte* MakeValue(String v = "") const {
-        std::byte* buf = Allocate();
-        new (buf) String(std::move(v));
+    [[nodiscard]] std::byte* MakeValue(String v = {}) const {
+        auto* buf = new std::byte[GetValueSize(v.size())];
+        ValueFromChars(buf, v);
         return buf;
     }
 
-    static CompareResult Compare(String const& l_val, String const& r_val) {
+    static CompareResult Compare(String l_val, String r_val) {
         int const res = l_val.compare(r_val);
         if (res == 0) {
             return CompareResult::kEqual;
@@ -64,17 +78,10 @@ public:
         return CompareResult::kGreater;
     }
 
-    std::byte* Concat(std::byte* l, std::byte* r, std::byte* result) const {
-        String const& l_val = GetValue<String>(l);
-        String const& r_val = GetValue<String>(r);
-
-        GetValue<String>(result) = l_val + r_val;
-        return result;
-    }
-
-    std::byte* Concat(std::byte* l, std::byte* r) const {
-        std::byte* result = MakeValue();
-        return Concat(l, r, result);
+    std::byte* Concat(std::byte const* l, std::byte const* r) const {
+        std::string result(GetValue<String>(l));
+        result += GetValue<String>(r);
+        return MakeValue(result);
     }
 
     auto GetDeleter() const {
@@ -85,10 +92,6 @@ public:
     double Dist(std::byte const* l, std::byte const* r) const override {
         return util::LevenshteinDistance(GetValue<String>(l), GetValue<String>(r));
     }
-
-    static void Destruct(std::byte const* v) {
-        reinterpret_cast<String const*>(v)->~String();
-    }
 };
 
 using StringTypeDeleter = decltype(std::declval<StringType>().GetDeleter());
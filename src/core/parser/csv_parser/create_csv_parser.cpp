@@ -0,0 +1,10 @@
+#include "create_csv_parser.h"
+
+#include "parser/csv_parser/mmap_csv_parser.h"
+
+std::shared_ptr<model::IDatasetStream> CreateCSVParser(CSVConfig const& csv_config) {
+    if (csv_config.memory_mapped) {
+        return std::make_shared<MmapCSVParser>(csv_config);
+    }
+    return std::make_shared<CSVParser>(csv_config);
+}
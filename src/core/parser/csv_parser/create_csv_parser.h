@@ -0,0 +1,9 @@
+#pragma once
+
+#include <memory>
+
+#include "model/table/idataset_stream.h"
+#include "parser/csv_parser/csv_parser.h"
+
+/* Creates the CSV reader selected by csv_config */
+std::shared_ptr<model::IDatasetStream> CreateCSVParser(CSVConfig const& csv_config);
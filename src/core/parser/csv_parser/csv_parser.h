@@ -16,6 +16,8 @@ struct CSVConfig {
     std::filesystem::path path;
     char separator;
     bool has_header;
+    /* Read the file through MmapCSVParser instead of CSVParser */
+    bool memory_mapped = false;
 };
 
 class CSVParser : public model::IDatasetStream {
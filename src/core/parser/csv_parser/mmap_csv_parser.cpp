@@ -0,0 +1,328 @@
+#include "mmap_csv_parser.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr char kQuote = '"';
+
+/* Returns pointer to the first occurrence of either a or b in [first, last) or last */
+char const* FindEither(char const* first, char const* last, char a, char b) {
+#ifdef __AVX2__
+    __m256i const a_vect = _mm256_set1_epi8(a);
+    __m256i const b_vect = _mm256_set1_epi8(b);
+    int constexpr vect_reg_size = 32;
+    for (; last - first >= vect_reg_size; first += vect_reg_size) {
+        __m256i const chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first));
+        __m256i const matches = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, a_vect),
+                                                _mm256_cmpeq_epi8(chunk, b_vect));
+        unsigned int const mask = _mm256_movemask_epi8(matches);
+        if (mask != 0) {
+            return first + std::countr_zero(mask);
+        }
+    }
+#elif defined(__SSE2__)
+    __m128i const a_vect = _mm_set1_epi8(a);
+    __m128i const b_vect = _mm_set1_epi8(b);
+    int constexpr vect_reg_size = 16;
+    for (; last - first >= vect_reg_size; first += vect_reg_size) {
+        __m128i const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first));
+        __m128i const matches =
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, a_vect), _mm_cmpeq_epi8(chunk, b_vect));
+        unsigned int const mask = _mm_movemask_epi8(matches);
+        if (mask != 0) {
+            return first + std::countr_zero(mask);
+        }
+    }
+#endif
+    for (; first != last; ++first) {
+        if (*first == a || *first == b) {
+            return first;
+        }
+    }
+    return last;
+}
+
+/* Same set of characters boost::trim_right strips with the classic locale */
+bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+std::string_view Rtrim(std::string_view line) {
+    while (!line.empty() && IsSpace(line.back())) {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+/* Applies CSVParser's post-processing of a quoted token: quotes are dropped, and inside a
+ * field enclosed in quotes every inner "" becomes ". Writes the result to out and returns
+ * the number of written characters.
+ */
+size_t Unquote(std::string_view raw, char* out) {
+    size_t const length = raw.size();
+    bool const is_enclosed = length >= 2 && raw.front() == kQuote && raw.back() == kQuote;
+    size_t written = 0;
+    for (size_t index = 0; index < length; ++index) {
+        if (raw[index] == kQuote) {
+            if (is_enclosed && index > 0 && index + 2 < length && raw[index + 1] == kQuote) {
+                out[written++] = kQuote;
+                ++index;
+            }
+        } else {
+            out[written++] = raw[index];
+        }
+    }
+    return written;
+}
+
+/* Splits the line into fields by CSVParser's rules. Fields that had quotes stripped are written
+ * to unquoted, the views stay valid until the next call with the same buffers.
+ */
+void ParseLine(std::string_view line, char separator, size_t number_of_columns,
+               model::IDatasetStream::RowView& fields, std::string& unquoted) {
+    fields.clear();
+    if (line.empty()) {
+        if (number_of_columns == 1) {
+            fields.emplace_back();
+        }
+        return;
+    }
+    if (unquoted.size() < line.size()) {
+        unquoted.resize(line.size());
+    }
+
+    char* unquoted_out = unquoted.data();
+    char const* field_begin = line.data();
+    char const* const line_end = line.data() + line.size();
+    while (true) {
+        char const* cur = FindEither(field_begin, line_end, separator, kQuote);
+        if (cur != line_end && *cur == kQuote) {
+            // Slow path: the field contains quotes, separators inside them are not delimiters
+            bool in_quote = false;
+            for (; cur != line_end; cur = FindEither(cur + 1, line_end, separator, kQuote)) {
+                if (*cur == kQuote) {
+                    in_quote = !in_quote;
+                } else if (!in_quote) {
+                    break;
+                }
+            }
+            std::string_view const raw(field_begin, cur - field_begin);
+            size_t const length = Unquote(raw, unquoted_out);
+            fields.emplace_back(unquoted_out, length);
+            unquoted_out += length;
+        } else {
+            fields.emplace_back(field_begin, cur - field_begin);
+        }
+
+        if (cur == line_end) {
+            break;
+        }
+        // A separator at the end of the line is followed by one more empty field
+        field_begin = cur + 1;
+    }
+}
+
+/* Rows of a line-aligned range of the mapping, produced by MmapCSVParser::SplitRemainingRows() */
+class RowRange final : public model::IDatasetStream {
+private:
+    MmapCSVParser const& parser_;
+    char const* const begin_;
+    char const* const end_;
+    char const* pos_;
+    RowView fields_;
+    std::string unquoted_;
+
+public:
+    RowRange(MmapCSVParser const& parser, char const* begin, char const* end)
+        : parser_(parser), begin_(begin), end_(end), pos_(begin) {}
+
+    RowView const& GetNextRowView() override {
+        char const* newline = static_cast<char const*>(std::memchr(pos_, '\n', end_ - pos_));
+        char const* const line_end = newline == nullptr ? end_ : newline;
+        ParseLine(Rtrim(std::string_view(pos_, line_end - pos_)), parser_.GetSeparator(),
+                  parser_.GetNumberOfColumns(), fields_, unquoted_);
+        pos_ = newline == nullptr ? end_ : newline + 1;
+        return fields_;
+    }
+
+    Row GetNextRow() override {
+        RowView const& view = GetNextRowView();
+        return Row(view.begin(), view.end());
+    }
+
+    bool HasNextRow() const override {
+        return pos_ != end_;
+    }
+
+    size_t GetNumberOfColumns() const override {
+        return parser_.GetNumberOfColumns();
+    }
+
+    std::string GetColumnName(size_t index) const override {
+        return parser_.GetColumnName(index);
+    }
+
+    std::string GetRelationName() const override {
+        return parser_.GetRelationName();
+    }
+
+    void Reset() override {
+        pos_ = begin_;
+    }
+};
+
+}  // namespace
+
+MmapCSVParser::MmapCSVParser(std::filesystem::path const& path) : MmapCSVParser(path, ',', true) {}
+
+MmapCSVParser::MmapCSVParser(std::filesystem::path const& path, char separator, bool has_header)
+    : separator_(separator), has_header_(has_header), relation_name_(path.filename().string()) {
+    std::error_code ec;
+    std::uintmax_t const size = std::filesystem::file_size(path, ec);
+    // Wrong path
+    if (ec) {
+        throw std::runtime_error("Error: couldn't find file " + path.string());
+    }
+    if (separator == '\0') {
+        throw std::invalid_argument("Invalid separator");
+    }
+
+    namespace bip = boost::interprocess;
+    // Zero-sized files cannot be mapped, they are treated as an empty buffer
+    if (size != 0) {
+        file_ = bip::file_mapping(path.string().c_str(), bip::read_only);
+        region_ = bip::mapped_region(file_, bip::read_only);
+        region_.advise(bip::mapped_region::advice_sequential);
+        begin_ = static_cast<char const*>(region_.get_address());
+        end_ = begin_ + region_.get_size();
+    }
+    pos_ = begin_;
+
+    if (has_header) {
+        GetNext();
+    } else {
+        // Peek the first line to count columns
+        GetNext();
+        pos_ = begin_;
+        eof_ = false;
+    }
+
+    RowView const& first_row = GetNextRowView();
+    number_of_columns_ = first_row.size();
+    column_names_.reserve(number_of_columns_);
+    for (size_t i = 0; i < number_of_columns_; ++i) {
+        column_names_.emplace_back(has_header ? std::string(first_row[i]) : std::to_string(i));
+    }
+}
+
+MmapCSVParser::MmapCSVParser(CSVConfig const& csv_config)
+    : MmapCSVParser(csv_config.path, csv_config.separator, csv_config.has_header) {}
+
+void MmapCSVParser::GetNext() {
+    char const* newline =
+            static_cast<char const*>(pos_ == end_ ? nullptr : std::memchr(pos_, '\n', end_ - pos_));
+    if (newline == nullptr) {
+        next_line_ = Rtrim(std::string_view(pos_, end_ - pos_));
+        pos_ = end_;
+        eof_ = true;
+    } else {
+        next_line_ = Rtrim(std::string_view(pos_, newline - pos_));
+        pos_ = newline + 1;
+    }
+}
+
+void MmapCSVParser::SkipLine() {
+    char const* newline =
+            static_cast<char const*>(pos_ == end_ ? nullptr : std::memchr(pos_, '\n', end_ - pos_));
+    if (newline == nullptr) {
+        pos_ = end_;
+        eof_ = true;
+    } else {
+        pos_ = newline + 1;
+    }
+}
+
+void MmapCSVParser::GetNextIfHas() {
+    has_next_ = !eof_;
+
+    if (has_next_) {
+        if (pos_ == end_) {  // Check for the last newline
+            has_next_ = false;
+            return;
+        }
+        GetNext();
+    }
+}
+
+void MmapCSVParser::Reset() {
+    pos_ = begin_;
+    eof_ = false;
+    next_line_ = {};
+    has_next_ = true;
+
+    // Skip header
+    if (has_header_) {
+        SkipLine();
+    }
+
+    // For correctness of GetNextRow() after this method
+    GetNextIfHas();
+}
+
+MmapCSVParser::RowView const& MmapCSVParser::GetNextRowView() {
+    ParseLine(next_line_, separator_, number_of_columns_, fields_, unquoted_);
+
+    GetNextIfHas();
+
+    return fields_;
+}
+
+model::IDatasetStream::Row MmapCSVParser::GetNextRow() {
+    RowView const& view = GetNextRowView();
+    return Row(view.begin(), view.end());
+}
+
+std::vector<std::unique_ptr<model::IDatasetStream>> MmapCSVParser::SplitRemainingRows(
+        size_t parts) {
+    std::vector<std::unique_ptr<model::IDatasetStream>> ranges;
+    if (!has_next_ || parts == 0) {
+        return ranges;
+    }
+
+    // The rows left start at the line read ahead, ranges of about equal size are extended to
+    // the end of the line they end in
+    char const* const first = next_line_.data();
+    size_t const size = end_ - first;
+    char const* range_begin = first;
+    for (size_t part = 1; part <= parts && range_begin != end_; ++part) {
+        char const* range_end = std::max(range_begin, first + size * part / parts);
+        if (range_end != end_) {
+            char const* newline =
+                    static_cast<char const*>(std::memchr(range_end, '\n', end_ - range_end));
+            range_end = newline == nullptr ? end_ : newline + 1;
+        }
+        ranges.push_back(std::make_unique<RowRange>(*this, range_begin, range_end));
+        range_begin = range_end;
+    }
+
+    pos_ = end_;
+    eof_ = true;
+    next_line_ = {};
+    has_next_ = false;
+    return ranges;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "model/table/idataset_stream.h"
+#include "parser/csv_parser/csv_parser.h"
+
+/* CSV reader over a read-only memory mapping of the file. Lines, separators and quotes are
+ * located with vectorized scans and fields are handed out as views into the mapping, so no
+ * heap allocation is performed per row once the internal buffers have reached the size of
+ * the longest line. Quoting and escaping rules are exactly those of CSVParser.
+ */
+class MmapCSVParser : public model::IDatasetStream {
+private:
+    boost::interprocess::file_mapping file_;
+    boost::interprocess::mapped_region region_;
+    char const* begin_ = nullptr;
+    char const* end_ = nullptr;
+    /* Beginning of the unread part of the file */
+    char const* pos_ = nullptr;
+    /* Mirrors the eof state of the stream in CSVParser */
+    bool eof_ = false;
+    char separator_;
+    bool has_header_;
+    bool has_next_ = true;
+    std::string_view next_line_;
+    size_t number_of_columns_ = 0;
+    std::vector<std::string> column_names_;
+    std::string relation_name_;
+    RowView fields_;
+    /* Storage for fields that had their quotes stripped */
+    std::string unquoted_;
+
+    void GetNext();
+    void SkipLine();
+    void GetNextIfHas();
+
+public:
+    explicit MmapCSVParser(std::filesystem::path const& path);
+    MmapCSVParser(std::filesystem::path const& path, char separator, bool has_header);
+    explicit MmapCSVParser(CSVConfig const& csv_config);
+
+    RowView const& GetNextRowView() override;
+    Row GetNextRow() override;
+
+    /* Splits the rest of the mapping into line-aligned ranges that are parsed independently */
+    std::vector<std::unique_ptr<model::IDatasetStream>> SplitRemainingRows(size_t parts) override;
+
+    bool HasNextRow() const override {
+        return has_next_;
+    }
+
+    char GetSeparator() const {
+        return separator_;
+    }
+
+    size_t GetNumberOfColumns() const override {
+        return number_of_columns_;
+    }
+
+    std::string GetColumnName(size_t index) const override {
+        return column_names_[index];
+    }
+
+    std::string GetRelationName() const override {
+        return relation_name_;
+    }
+
+    void Reset() override;
+};
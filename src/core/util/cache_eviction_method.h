@@ -1,3 +0,0 @@
-#pragma once
-
-enum class CacheEvictionMethod { kDefault, kMedainUsage, kHottoRemain };
@@ -1,44 +1,119 @@
 #include "levenshtein_distance.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
-namespace util {
+namespace {
+
+constexpr size_t kWordBits = 64;
+
+/* Myers' bit-parallel algorithm as formulated by Hyyrö: the vertical deltas of a column of the
+ * dynamic programming matrix are stored in two bit vectors, so a column is computed with a few
+ * word operations. The pattern must fit into one word. */
+unsigned BitParallelDistance(std::string_view pattern, std::string_view text,
+                             unsigned max_distance) {
+    assert(!pattern.empty() && pattern.size() <= kWordBits);
+    // positions of every character in the pattern
+    std::array<uint64_t, 256> peq{};
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        peq[static_cast<unsigned char>(pattern[i])] |= uint64_t{1} << i;
+    }
+
+    uint64_t const last = uint64_t{1} << (pattern.size() - 1);
+    uint64_t pv = ~uint64_t{0};
+    uint64_t mv = 0;
+    size_t score = pattern.size();
+    size_t remaining = text.size();
+    for (char c : text) {
+        uint64_t const eq = peq[static_cast<unsigned char>(c)];
+        uint64_t const xv = eq | mv;
+        uint64_t const xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        if (ph & last) {
+            ++score;
+        } else if (mh & last) {
+            --score;
+        }
+        // the first row of the matrix grows by one in every column
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+
+        // the distance decreases by at most one per remaining character of the text
+        --remaining;
+        if (score > remaining && score - remaining > max_distance) {
+            return max_distance + 1;
+        }
+    }
+    return score > max_distance ? max_distance + 1 : score;
+}
 
 /* Levenshtein distance computation algorithm taken from
- * https://en.wikipedia.org/wiki/Levenshtein_distance
+ * https://en.wikipedia.org/wiki/Levenshtein_distance, the row is reused between calls and the
+ * computation stops when the whole row exceeds max_distance, since row minimums never decrease
  */
-unsigned LevenshteinDistance(std::string_view l, std::string_view r) {
-    size_t r_size = r.size();
-    std::vector<unsigned> v0(r_size + 1);
-    std::vector<unsigned> v1(r_size + 1);
+unsigned DynamicProgrammingDistance(std::string_view l, std::string_view r,
+                                    unsigned max_distance) {
+    thread_local std::vector<size_t> row;
+    row.resize(r.size() + 1);
+    for (size_t j = 0; j <= r.size(); ++j) {
+        row[j] = j;
+    }
 
-    for (unsigned i = 0; i != r_size + 1; ++i) {
-        v0[i] = i;
+    for (size_t i = 0; i != l.size(); ++i) {
+        size_t diagonal = row[0];
+        row[0] = i + 1;
+        size_t row_min = row[0];
+        for (size_t j = 0; j != r.size(); ++j) {
+            size_t const up = row[j + 1];
+            size_t const substitution_cost = diagonal + (l[i] == r[j] ? 0 : 1);
+            row[j + 1] = std::min({up + 1, row[j] + 1, substitution_cost});
+            diagonal = up;
+            row_min = std::min(row_min, row[j + 1]);
+        }
+        if (row_min > max_distance) {
+            return max_distance + 1;
+        }
     }
+    return row.back() > max_distance ? max_distance + 1 : row.back();
+}
 
-    for (unsigned i = 0; i != l.size(); ++i) {
-        v1[0] = i + 1;
+}  // namespace
 
-        for (unsigned j = 0; j != r.size(); ++j) {
-            assert(j + 1 < v0.size());
-            unsigned del_cost = v0[j + 1] + 1;
-            unsigned insert_cost = v1[j] + 1;
-            unsigned substition_cost;
-            if (l[i] == r[j]) {
-                substition_cost = v0[j];
-            } else {
-                substition_cost = v0[j] + 1;
-            }
+namespace util {
 
-            v1[j + 1] = std::min({del_cost, insert_cost, substition_cost});
-        }
+unsigned LevenshteinDistance(std::string_view l, std::string_view r) {
+    return LevenshteinDistance(l, r, std::numeric_limits<unsigned>::max());
+}
 
-        std::swap(v0, v1);
-    }
+unsigned LevenshteinDistance(std::string_view l, std::string_view r, unsigned max_distance) {
+    // common prefix and suffix don't change the distance
+    auto [l_mismatch, r_mismatch] = std::mismatch(l.begin(), l.end(), r.begin(), r.end());
+    l.remove_prefix(l_mismatch - l.begin());
+    r.remove_prefix(r_mismatch - r.begin());
+    auto [l_rmismatch, r_rmismatch] = std::mismatch(l.rbegin(), l.rend(), r.rbegin(), r.rend());
+    l.remove_suffix(l_rmismatch - l.rbegin());
+    r.remove_suffix(r_rmismatch - r.rbegin());
 
-    return v0.back();
+    if (l.size() > r.size()) {
+        std::swap(l, r);
+    }
+    if (r.size() - l.size() > max_distance) {
+        return max_distance + 1;
+    }
+    if (l.empty()) {
+        return r.size();
+    }
+    if (l.size() <= kWordBits) {
+        return BitParallelDistance(l, r, max_distance);
+    }
+    return DynamicProgrammingDistance(l, r, max_distance);
 }
 
 }  // namespace util
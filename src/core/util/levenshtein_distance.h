@@ -6,4 +6,8 @@ namespace util {
 
 unsigned LevenshteinDistance(std::string_view l, std::string_view r);
 
+/* Returns the Levenshtein distance if it doesn't exceed max_distance and max_distance + 1
+ * otherwise, the computation stops as soon as the distance is known to exceed max_distance */
+unsigned LevenshteinDistance(std::string_view l, std::string_view r, unsigned max_distance);
+
 }  // namespace util
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace util {
+
+namespace detail {
+inline std::atomic<std::uint64_t> next_buffers_id = 1;
+}  // namespace detail
+
+/* Gives every thread its own Buffer, so that threads may append to their buffers without any
+ * synchronization. Buffers are linked into a list with compare-and-swap when a thread first
+ * touches the object and are never freed before Clear() or destruction, so the buffer found
+ * through the thread local cache stays valid. A thread missing the cache looks its buffer up in
+ * the list, so there is at most one buffer per thread. Clear() and ForEach() must not run
+ * concurrently with Local().
+ */
+template <typename Buffer>
+class PerThreadBuffers {
+private:
+    struct Node {
+        Buffer buffer;
+        std::thread::id owner = std::this_thread::get_id();
+        Node* next = nullptr;
+    };
+
+    struct CacheEntry {
+        std::uint64_t id = 0;
+        Buffer* buffer = nullptr;
+    };
+
+    /* A thread usually appends to a few objects at once only */
+    static constexpr std::size_t kCacheSize = 4;
+
+    struct ThreadCache {
+        std::array<CacheEntry, kCacheSize> entries;
+        std::size_t next_victim = 0;
+    };
+
+    std::atomic<Node*> head_ = nullptr;
+    /* Unique among all objects and renewed by Clear(), so stale cache entries never match */
+    std::uint64_t id_ = detail::next_buffers_id.fetch_add(1, std::memory_order_relaxed);
+
+    static ThreadCache& GetThreadCache() {
+        thread_local ThreadCache cache;
+        return cache;
+    }
+
+    Buffer* FindBuffer() {
+        std::thread::id const owner = std::this_thread::get_id();
+        for (Node* node = head_.load(std::memory_order_acquire); node != nullptr;
+             node = node->next) {
+            if (node->owner == owner) return &node->buffer;
+        }
+        return nullptr;
+    }
+
+    Buffer& AddBuffer() {
+        Node* node = new Node();
+        node->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        }
+        return node->buffer;
+    }
+
+    /* Visits the nodes from node to the tail in reverse, so in the order they were created */
+    template <typename Visitor>
+    static void ForEachFrom(Node* node, Visitor& visitor) {
+        if (node == nullptr) return;
+        ForEachFrom(node->next, visitor);
+        visitor(node->buffer);
+    }
+
+    void DeleteBuffers() noexcept {
+        Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+        while (node != nullptr) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+public:
+    PerThreadBuffers() = default;
+    PerThreadBuffers(PerThreadBuffers const&) = delete;
+    PerThreadBuffers& operator=(PerThreadBuffers const&) = delete;
+
+    ~PerThreadBuffers() {
+        DeleteBuffers();
+    }
+
+    /* Returns the buffer of the calling thread */
+    Buffer& Local() {
+        ThreadCache& cache = GetThreadCache();
+        for (CacheEntry const& entry : cache.entries) {
+            if (entry.id == id_) return *entry.buffer;
+        }
+        Buffer* buffer = FindBuffer();
+        if (buffer == nullptr) buffer = &AddBuffer();
+        cache.entries[cache.next_victim] = {id_, buffer};
+        cache.next_victim = (cache.next_victim + 1) % kCacheSize;
+        return *buffer;
+    }
+
+    /* Visits the buffers in the order they were created, the recursion depth is the number of
+     * threads that touched the object */
+    template <typename Visitor>
+    void ForEach(Visitor visitor) const {
+        ForEachFrom(head_.load(std::memory_order_acquire), visitor);
+    }
+
+    void Clear() noexcept {
+        DeleteBuffers();
+        id_ = detail::next_buffers_id.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+}  // namespace util
@@ -1,39 +1,65 @@
 #pragma once
 
+#include <atomic>
 #include <list>
-#include <mutex>
+#include <vector>
+
+#include "util/per_thread_buffers.h"
 
 namespace util {
 
 /* Represents the collection of the primitive instances, guarantees the thread safety of adding
- * new instances
+ * new instances. Every thread appends to its own buffer without locking, the buffers are moved
+ * to the list when it is requested.
  */
 template <typename T>
 class PrimitiveCollection {
 private:
-    std::list<T> collection_;
-    std::mutex mutable mutex_;
+    struct Buffer {
+        std::vector<T> primitives;
+        /* Written by the owning thread only, read by Size() */
+        std::atomic<size_t> size = 0;
+
+        template <typename... Args>
+        void Emplace(Args&&... args) {
+            primitives.emplace_back(std::forward<Args>(args)...);
+            size.store(primitives.size(), std::memory_order_release);
+        }
+    };
+
+    PerThreadBuffers<Buffer> mutable buffers_;
+    std::list<T> mutable collection_;
+
+    void Gather() const {
+        buffers_.ForEach([this](Buffer& buffer) {
+            for (T& primitive : buffer.primitives) collection_.push_back(std::move(primitive));
+            buffer.primitives.clear();
+            buffer.size.store(0, std::memory_order_relaxed);
+        });
+    }
 
 public:
     void Register(T primitive) {
-        std::scoped_lock lock(mutex_);
-        collection_.push_back(std::move(primitive));
+        buffers_.Local().Emplace(std::move(primitive));
     }
 
     template <typename... Args>
     void Register(Args&&... args) {
-        std::scoped_lock lock(mutex_);
-        collection_.emplace_back(std::forward<Args>(args)...);
+        buffers_.Local().Emplace(std::forward<Args>(args)...);
     }
 
     void Clear() noexcept {
-        std::scoped_lock lock(mutex_);
+        buffers_.Clear();
         collection_.clear();
     }
 
-    size_t Size() const noexcept {
-        std::scoped_lock lock(mutex_);
-        return collection_.size();
+    /* Must not be called concurrently with AsList() */
+    size_t Size() const {
+        size_t size = collection_.size();
+        buffers_.ForEach([&size](Buffer const& buffer) {
+            size += buffer.size.load(std::memory_order_acquire);
+        });
+        return size;
     }
 
     /* Calling code MUST guarantee that methods below won't interfere with the registering of
@@ -41,11 +67,13 @@ public:
      * Practically this means that these methods should be called only after algorithm is finished
      * its execution.
      */
-    std::list<T> const& AsList() const noexcept {
+    std::list<T> const& AsList() const {
+        Gather();
         return collection_;
     }
 
-    std::list<T>& AsList() noexcept {
+    std::list<T>& AsList() {
+        Gather();
         return collection_;
     }
 };
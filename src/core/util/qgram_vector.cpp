@@ -5,33 +5,90 @@
 #include <cmath>
 #include <numeric>
 
+namespace {
+
+uint64_t QGramKey(std::string_view q_gram) {
+    assert(q_gram.size() <= sizeof(uint64_t));
+    uint64_t key = 0;
+    for (char c : q_gram) {
+        key = (key << 8) | static_cast<unsigned char>(c);
+    }
+    return key;
+}
+
+/* Counts equal neighbouring keys of the sorted keys */
+template <typename Key>
+void CountSorted(std::vector<Key> const& keys, std::vector<std::pair<Key, unsigned>>& q_grams) {
+    for (Key const& key : keys) {
+        if (!q_grams.empty() && q_grams.back().first == key) {
+            ++q_grams.back().second;
+        } else {
+            q_grams.emplace_back(key, 1);
+        }
+    }
+}
+
+template <typename Key>
+double SortedInnerProduct(std::vector<std::pair<Key, unsigned>> const& lhs,
+                          std::vector<std::pair<Key, unsigned>> const& rhs) {
+    double result = 0.0;
+    auto l = lhs.cbegin();
+    auto r = rhs.cbegin();
+    while (l != lhs.cend() && r != rhs.cend()) {
+        if (l->first < r->first) {
+            ++l;
+        } else if (r->first < l->first) {
+            ++r;
+        } else {
+            result += l->second * r->second;
+            ++l;
+            ++r;
+        }
+    }
+    return result;
+}
+
+template <typename Key>
+double SquaredLength(std::vector<std::pair<Key, unsigned>> const& q_grams) {
+    return std::accumulate(q_grams.cbegin(), q_grams.cend(), 0.0, [](double a, auto const& pair) {
+        return a + pair.second * pair.second;
+    });
+}
+
+}  // namespace
+
 namespace util {
 
 QGramVector::QGramVector(std::string_view string, unsigned q) {
     assert(string.size() >= q);
-    for (size_t i = 0; i < string.size() - q + 1; ++i) {
-        q_grams_[std::string(string.substr(i, q))]++;
+    size_t const count = string.size() - q + 1;
+    if (q <= sizeof(uint64_t)) {
+        std::vector<uint64_t> keys;
+        keys.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            keys.push_back(QGramKey(string.substr(i, q)));
+        }
+        std::sort(keys.begin(), keys.end());
+        CountSorted(keys, q_grams_);
+    } else {
+        std::vector<std::string_view> keys;
+        keys.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            keys.push_back(string.substr(i, q));
+        }
+        std::sort(keys.begin(), keys.end());
+        CountSorted(keys, long_q_grams_);
     }
     CalculateLength();
 }
 
 long double QGramVector::InnerProduct(QGramVector const& other) const {
-    auto const& q_grams_pair =
-            std::minmax(q_grams_, other.q_grams_,
-                        [](auto const& a, auto const& b) { return a.size() < b.size(); });
-    auto const& l = q_grams_pair.first;
-    auto const& r = q_grams_pair.second;
-    return std::accumulate(l.cbegin(), l.cend(), 0.0, [&r](double a, auto const& b) {
-        auto r_pair = r.find(b.first);
-        if (r_pair == r.end()) return a;
-        return a + b.second * r_pair->second;
-    });
+    return SortedInnerProduct(q_grams_, other.q_grams_) +
+           SortedInnerProduct(long_q_grams_, other.long_q_grams_);
 }
 
 void QGramVector::CalculateLength() {
-    length_ = std::sqrt(std::accumulate(
-            q_grams_.cbegin(), q_grams_.cend(), 0.0,
-            [](double a, auto const& pair) { return a + pair.second * pair.second; }));
+    length_ = std::sqrt(SquaredLength(q_grams_) + SquaredLength(long_q_grams_));
 }
 
 }  // namespace util
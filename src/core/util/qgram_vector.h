@@ -1,7 +1,9 @@
 #pragma once
 
-#include <string>
-#include <unordered_map>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace util {
 
@@ -14,11 +16,17 @@ namespace util {
  * has 1 occurrence of "ab" and "bc" and 0 occurrences of "cd". Second string has 0 occurrences of
  * "ab" and 1 occurrence of "bc" and "cd". Cosine similarity between "abc" and "bcd" is equal to
  * (1*0 + 1*1 + 0*1) / (sqrt(1^2 + 1^2 + 0^2) * sqrt(1^2 + 1^2 + 0^2)) = 0.5.
- * Cosine distance between "abc" and "bcd" is equal to 1 - 0.5 = 0.5. */
+ * Cosine distance between "abc" and "bcd" is equal to 1 - 0.5 = 0.5.
+ * Q-grams are stored sorted, so the inner product is a merge of two sorted vectors. If q <= 8 the
+ * bytes of a q-gram are packed into a 64-bit key, otherwise the q-gram is kept as a view of the
+ * string, so the string must outlive the vector. */
 class QGramVector {
 private:
     long double length_ = -1;
-    std::unordered_map<std::string, unsigned> q_grams_;
+    /* q-gram keys with their numbers of occurrences, sorted by key, used if q <= 8 */
+    std::vector<std::pair<uint64_t, unsigned>> q_grams_;
+    /* q-grams with their numbers of occurrences, sorted, used if q > 8 */
+    std::vector<std::pair<std::string_view, unsigned>> long_q_grams_;
 
     void CalculateLength();
 
@@ -46,14 +46,20 @@ void BindMainClasses(py::module_& main_module) {
     "\nThis option is only expected to be used by Python scripts in which it is\n" \
     "easier to set all options one by one. For normal use, you may set the\n"      \
     "algorithms' options using keyword arguments of the load_data and execute\nmethods."
+#define CONCURRENT_USE                                                                 \
+    "\nThe GIL is released while the data is processed, so different algorithm\n"     \
+    "objects may run in parallel from different Python threads. An object must not\n" \
+    "be used by several threads at once, except for calling get_progress."
     py::class_<Algorithm>(main_module, "Algorithm")
             .def(
                     "load_data",
                     [](Algorithm& algo, py::kwargs const& kwargs) {
                         ConfigureAlgo(algo, kwargs);
+                        // Readers of Python objects acquire the GIL themselves
+                        py::gil_scoped_release release;
                         algo.LoadData();
                     },
-                    "Load data for execution")
+                    "Load data for execution." CONCURRENT_USE)
             .def("get_possible_options", &Algorithm::GetPossibleOptions,
                  "Get names of options the algorithm may request.")
             .def("get_description", &Algorithm::GetDescription, "option_name"_a,
@@ -106,9 +112,17 @@ void BindMainClasses(py::module_& main_module) {
                     "execute",
                     [](Algorithm& algo, py::kwargs const& kwargs) {
                         ConfigureAlgo(algo, kwargs);
+                        py::gil_scoped_release release;
                         algo.Execute();
                     },
-                    "Process data.");
+                    "Process data." CONCURRENT_USE)
+            .def("get_progress", &Algorithm::GetProgress,
+                 "Get the progress of the execution as a pair of the current phase index and the "
+                 "percentage of the phase done. May be called from another thread while the "
+                 "algorithm is running.")
+            .def("get_phase_names", &Algorithm::GetPhaseNames,
+                 "Get names of the execution phases.");
+#undef CONCURRENT_USE
 #undef CERTAIN_SCRIPTS_ONLY
 }
 }  // namespace python_bindings
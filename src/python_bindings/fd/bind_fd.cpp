@@ -56,10 +56,11 @@ void BindFd(py::module_& main_module) {
     static constexpr auto kPFDTaneName = "PFDTane";
     auto fd_algos_module =
             BindPrimitive<hyfd::HyFD, Aid, Depminer, DFD, FastFDs, FDep, FdMine, FUN, Pyro, Tane,
-                          PFDTane>(fd_module, py::overload_cast<>(&FDAlgorithm::FdList, py::const_),
-                                   "FdAlgorithm", "get_fds",
-                                   {"HyFD", "Aid", "Depminer", "DFD", "FastFDs", "FDep", "FdMine",
-                                    "FUN", kPyroName, kTaneName, kPFDTaneName});
+                          PFDTane, dynfd::DynFD>(
+                    fd_module, py::overload_cast<>(&FDAlgorithm::FdList, py::const_),
+                    "FdAlgorithm", "get_fds",
+                    {"HyFD", "Aid", "Depminer", "DFD", "FastFDs", "FDep", "FdMine", "FUN",
+                     kPyroName, kTaneName, kPFDTaneName, "DynFD"});
 
     auto define_submodule = [&fd_algos_module, &main_module](char const* name,
                                                              std::vector<char const*> algorithms) {
@@ -3,6 +3,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include "algorithms/fd/fd_verifier/batch_verifier.h"
 #include "algorithms/fd/fd_verifier/fd_verifier.h"
 #include "algorithms/fd/fd_verifier/highlight.h"
 #include "algorithms/fd/verification_algorithms.h"
@@ -23,13 +24,30 @@ void BindFdVerification(pybind11::module_& main_module) {
             .def_property_readonly("num_distinct_rhs_values", &Highlight::GetNumDistinctRhsValues)
             .def_property_readonly("most_frequent_rhs_value_proportion",
                                    &Highlight::GetMostFrequentRhsValueProportion);
+    py::class_<StatsCalculator>(fd_verification_module, "FDVerificationResult")
+            .def("fd_holds", &StatsCalculator::FDHolds)
+            .def("get_error", &StatsCalculator::GetError)
+            .def("get_num_error_clusters", &StatsCalculator::GetNumErrorClusters)
+            .def("get_num_error_rows", &StatsCalculator::GetNumErrorRows)
+            .def("get_highlights", &StatsCalculator::GetHighlights);
+    py::class_<UCCStatsCalculator>(fd_verification_module, "UCCVerificationResult")
+            .def("ucc_holds", &UCCStatsCalculator::UCCHolds)
+            .def("get_num_clusters_violating_ucc", &UCCStatsCalculator::GetNumClustersViolatingUCC)
+            .def("get_num_rows_violating_ucc", &UCCStatsCalculator::GetNumRowsViolatingUCC)
+            .def("get_clusters_violating_ucc", &UCCStatsCalculator::GetClustersViolatingUCC)
+            .def("get_error", &UCCStatsCalculator::GetAUCCError);
+    // bound before FDVerifier, which stays the default algorithm of the module
+    BindPrimitiveNoBase<BatchVerifier>(fd_verification_module, "BatchVerifier")
+            .def("get_fd_results", &BatchVerifier::GetFdResults)
+            .def("get_afd_results", &BatchVerifier::GetAfdResults)
+            .def("afd_holds", &BatchVerifier::AfdHolds)
+            .def("get_ucc_results", &BatchVerifier::GetUccResults);
     BindPrimitiveNoBase<FDVerifier>(fd_verification_module, "FDVerifier")
             .def("fd_holds", &FDVerifier::FDHolds)
             .def("get_error", &FDVerifier::GetError)
             .def("get_num_error_clusters", &FDVerifier::GetNumErrorClusters)
             .def("get_num_error_rows", &FDVerifier::GetNumErrorRows)
             .def("get_highlights", &FDVerifier::GetHighlights);
-
     main_module.attr("afd_verification") = fd_verification_module;
 }
 }  // namespace python_bindings
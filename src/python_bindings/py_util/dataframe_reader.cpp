@@ -1,10 +1,16 @@
 #include "dataframe_reader.h"
 
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <Python.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/pytypes.h>
 #include <pybind11/stl.h>
@@ -24,13 +30,45 @@ static std::vector<std::string> GetColumnNames(py::handle dataframe) {
     return names;
 }
 
+// Encodes the values of a one-dimensional buffer by their bits, returns the
+// index of the first row of every distinct value.
+template <typename Bits, typename Code, typename IsNull>
+static std::vector<size_t> EncodeBuffer(py::array const& values, std::vector<Code>& codes,
+                                        Code null_code, IsNull is_null) {
+    size_t const num_rows = values.shape(0);
+    auto const* data = static_cast<std::byte const*>(values.data());
+    py::ssize_t const stride = values.strides(0);
+    std::unordered_map<Bits, Code> value_codes;
+    std::vector<size_t> first_rows;
+    codes.reserve(num_rows);
+    for (size_t row = 0; row < num_rows; ++row) {
+        Bits value;
+        std::memcpy(&value, data + static_cast<py::ssize_t>(row) * stride, sizeof(Bits));
+        if (is_null(value)) {
+            codes.push_back(null_code);
+            continue;
+        }
+        auto [it, inserted] = value_codes.try_emplace(value, first_rows.size());
+        if (inserted) first_rows.push_back(row);
+        codes.push_back(it->second);
+    }
+    return first_rows;
+}
+
 DataframeReaderBase::DataframeReaderBase(py::handle dataframe, std::string name)
     : dataframe_(py::reinterpret_borrow<py::object>(dataframe)),
       df_iter_(dataframe_.attr("itertuples")(false, py::none{})),
       name_(std::move(name)),
       column_names_(GetColumnNames(dataframe_)) {}
 
+DataframeReaderBase::~DataframeReaderBase() {
+    py::gil_scoped_acquire gil;
+    df_iter_ = {};
+    dataframe_ = {};
+}
+
 void DataframeReaderBase::Reset() {
+    py::gil_scoped_acquire gil;
     df_iter_ = dataframe_.attr("itertuples")(false, py::none{});
 }
 
@@ -47,14 +85,148 @@ size_t DataframeReaderBase::GetNumberOfColumns() const {
 }
 
 bool DataframeReaderBase::HasNextRow() const {
+    py::gil_scoped_acquire gil;
     return df_iter_ != py::iterator::sentinel();
 }
 
-std::vector<std::string> StringDataframeReader::GetNextRow() {
-    return py::cast<std::vector<std::string>>(*df_iter_++);
+bool ColumnarDataframeReader::TryEncodeNumeric(py::array const& values, EncodedColumn& column) {
+    auto never_null = [](auto) { return false; };
+    std::vector<size_t> first_rows;
+    switch (values.dtype().kind()) {
+        case 'b':
+        case 'i':
+        case 'u':
+            switch (values.itemsize()) {
+                case 1:
+                    first_rows = EncodeBuffer<uint8_t>(values, column.codes, kNullCode, never_null);
+                    break;
+                case 2:
+                    first_rows =
+                            EncodeBuffer<uint16_t>(values, column.codes, kNullCode, never_null);
+                    break;
+                case 4:
+                    first_rows =
+                            EncodeBuffer<uint32_t>(values, column.codes, kNullCode, never_null);
+                    break;
+                case 8:
+                    first_rows =
+                            EncodeBuffer<uint64_t>(values, column.codes, kNullCode, never_null);
+                    break;
+                default:
+                    return false;
+            }
+            break;
+        case 'f':
+            // NaN is the null value of float columns in pandas. Values are
+            // compared by their bits, so 0.0 and -0.0 stay distinct like
+            // their string representations.
+            switch (values.itemsize()) {
+                case 4:
+                    first_rows = EncodeBuffer<uint32_t>(
+                            values, column.codes, kNullCode,
+                            [](uint32_t bits) { return std::isnan(std::bit_cast<float>(bits)); });
+                    break;
+                case 8:
+                    first_rows = EncodeBuffer<uint64_t>(
+                            values, column.codes, kNullCode,
+                            [](uint64_t bits) { return std::isnan(std::bit_cast<double>(bits)); });
+                    break;
+                default:
+                    return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    // `item` returns the same Python scalar as the iteration over a Series
+    py::object item = values.attr("item");
+    column.dictionary.reserve(first_rows.size());
+    for (size_t row : first_rows) {
+        column.dictionary.emplace_back(py::str(item(row)));
+    }
+    return true;
+}
+
+void ColumnarDataframeReader::EncodeFactorized(py::handle series, EncodedColumn& column) {
+    // pandas.factorize groups values by Python equality, which would merge 1, 1.0 and True, so
+    // the values are factorized by their string representations, like the ones rows are made
+    // of. Nulls of every kind pandas recognizes are left as is and get the code -1.
+    py::object strings = series.attr("map")(py::module_::import("builtins").attr("str"),
+                                            py::arg("na_action") = "ignore");
+    py::tuple factorized = py::module_::import("pandas").attr("factorize")(strings);
+    auto codes = py::array_t<int64_t, py::array::c_style | py::array::forcecast>::ensure(
+            factorized[0]);
+    if (!codes) throw py::error_already_set();
+    std::span<int64_t const> const codes_span(codes.data(), static_cast<size_t>(codes.size()));
+    column.codes.reserve(codes_span.size());
+    for (int64_t code : codes_span) {
+        column.codes.push_back(code < 0 ? kNullCode : static_cast<Code>(code));
+    }
+    for (py::handle unique : factorized[1]) {
+        column.dictionary.push_back(unique.cast<std::string>());
+    }
+}
+
+ColumnarDataframeReader::ColumnarDataframeReader(py::handle dataframe, std::string name)
+    : name_(std::move(name)),
+      column_names_(GetColumnNames(dataframe)),
+      num_rows_(py::len(dataframe)) {
+    columns_.reserve(column_names_.size());
+    for (py::handle name_and_series : dataframe.attr("items")()) {
+        py::object series = py::reinterpret_borrow<py::tuple>(name_and_series)[1];
+        EncodedColumn& column = columns_.emplace_back();
+        bool encoded = false;
+        if (py::isinstance<py::dtype>(series.attr("dtype"))) {
+            // A view of the column data, NumPy dtypes are stored in NumPy arrays
+            auto values = py::reinterpret_borrow<py::array>(series.attr("to_numpy")());
+            encoded = TryEncodeNumeric(values, column);
+        }
+        if (!encoded) {
+            EncodeFactorized(series, column);
+        }
+    }
+}
+
+std::vector<std::string> ColumnarDataframeReader::GetNextRow() {
+    std::vector<std::string> row;
+    row.reserve(columns_.size());
+    for (EncodedColumn const& column : columns_) {
+        Code const code = column.codes[next_row_];
+        row.push_back(code == kNullCode ? model::Null::kValue : column.dictionary[code]);
+    }
+    ++next_row_;
+    return row;
+}
+
+model::IDatasetStream::RowView const& ColumnarDataframeReader::GetNextRowView() {
+    row_view_.clear();
+    for (EncodedColumn const& column : columns_) {
+        Code const code = column.codes[next_row_];
+        row_view_.push_back(code == kNullCode ? model::Null::kValue : column.dictionary[code]);
+    }
+    ++next_row_;
+    return row_view_;
+}
+
+std::string ColumnarDataframeReader::GetRelationName() const {
+    return name_;
+}
+
+std::string ColumnarDataframeReader::GetColumnName(size_t index) const {
+    return column_names_.at(index);
+}
+
+size_t ColumnarDataframeReader::GetNumberOfColumns() const {
+    return column_names_.size();
+}
+
+ArbitraryDataframeReader::~ArbitraryDataframeReader() {
+    py::gil_scoped_acquire gil;
+    is_null_ = nullptr;
 }
 
 std::vector<std::string> ArbitraryDataframeReader::GetNextRow() {
+    py::gil_scoped_acquire gil;
     std::vector<std::string> strings{};
     auto tuple_row = py::reinterpret_borrow<py::object>(*df_iter_);
     ++df_iter_;
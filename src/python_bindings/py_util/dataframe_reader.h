@@ -1,11 +1,18 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 #include "model/table/idataset_stream.h"
 
 namespace python_bindings {
 
+// Data is loaded with the GIL released, so the methods that touch Python
+// objects acquire it themselves.
 class DataframeReaderBase : public model::IDatasetStream {
 protected:
     pybind11::object dataframe_;
@@ -15,6 +22,7 @@ protected:
 
 public:
     explicit DataframeReaderBase(pybind11::handle dataframe, std::string name = "Pandas dataframe");
+    ~DataframeReaderBase() override;
 
     void Reset() final;
     [[nodiscard]] std::string GetRelationName() const final;
@@ -23,21 +31,59 @@ public:
     [[nodiscard]] bool HasNextRow() const final;
 };
 
-// If a DataFrame only consists of Python strings, then there is no need to get
-// string representations of every value, and we can get away with the normal
-// pybind11's conversions, which speeds up the reading process.
-class StringDataframeReader final : public DataframeReaderBase {
+// Reads the whole DataFrame column by column when it is created, so rows are
+// then assembled without any Python calls. Every column is dictionary encoded:
+// the buffers of NumPy numeric columns are encoded in C++ directly, without
+// copying, other columns are encoded with `pandas.factorize`. Only the distinct
+// values are converted to Python strings.
+class ColumnarDataframeReader final : public model::IDatasetStream {
+private:
+    using Code = uint32_t;
+    static constexpr Code kNullCode = -1;
+
+    struct EncodedColumn {
+        std::vector<std::string> dictionary;
+        std::vector<Code> codes;
+    };
+
+    std::string name_;
+    std::vector<std::string> column_names_;
+    std::vector<EncodedColumn> columns_;
+    size_t num_rows_;
+    size_t next_row_ = 0;
+    RowView row_view_;
+
+    static bool TryEncodeNumeric(pybind11::array const& values, EncodedColumn& column);
+    static void EncodeFactorized(pybind11::handle series, EncodedColumn& column);
+
 public:
-    using DataframeReaderBase::DataframeReaderBase;
+    // Throws pybind11::error_already_set if pandas fails to convert the values
+    // of a column to strings.
+    explicit ColumnarDataframeReader(pybind11::handle dataframe,
+                                     std::string name = "Pandas dataframe");
+
+    void Reset() final {
+        next_row_ = 0;
+    }
+
+    [[nodiscard]] std::vector<std::string> GetNextRow() final;
+    // Views point into the column dictionaries and stay valid as long as the reader
+    RowView const& GetNextRowView() final;
+    [[nodiscard]] std::string GetRelationName() const final;
+    [[nodiscard]] std::string GetColumnName(size_t index) const final;
+    [[nodiscard]] size_t GetNumberOfColumns() const final;
 
-    std::vector<std::string> GetNextRow() final;
+    [[nodiscard]] bool HasNextRow() const final {
+        return next_row_ < num_rows_;
+    }
 };
 
 // If a dataframe consists of arbitrary Python objects, we have to first check
 // for nullity and switch it out for Desbordante's null value if it is null.
 // Pandas uses several Python objects for its null value representation, so the
 // most robust way to check for a DataFrame's value nullity is to use the
-// `pandas.isna` function.
+// `pandas.isna` function. Only used for the DataFrames that can't be read by
+// ColumnarDataframeReader.
 // If the value is not null, then we have to convert it to std::string, which
 // involves converting it to a Python str first.
 class ArbitraryDataframeReader final : public DataframeReaderBase {
@@ -53,6 +99,7 @@ private:
 
 public:
     using DataframeReaderBase::DataframeReaderBase;
+    ~ArbitraryDataframeReader() final;
 
     [[nodiscard]] std::vector<std::string> GetNextRow() final;
 };
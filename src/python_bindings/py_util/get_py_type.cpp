@@ -9,6 +9,7 @@
 #include <pybind11/stl/filesystem.h>
 
 #include "algorithms/cfd/enums.h"
+#include "algorithms/fd/fd_verifier/batch_verifier.h"
 #include "algorithms/metric/enums.h"
 #include "association_rules/ar_algorithm_enums.h"
 #include "config/error_measure/type.h"
@@ -86,6 +87,12 @@ py::tuple GetPyType(std::type_index type_index) {
             PyTypePair<std::filesystem::path, kPyStr>,
             PyTypePair<std::vector<std::filesystem::path>, kPyList, kPyStr>,
             PyTypePair<std::unordered_set<size_t>, kPySet, kPyInt>,
+            PyTypePair<std::vector<algos::fd_verifier::BatchVerifier::FdStatement>, kPyList,
+                       kPyTuple>,
+            PyTypePair<std::vector<algos::fd_verifier::BatchVerifier::AfdStatement>, kPyList,
+                       kPyTuple>,
+            PyTypePair<std::vector<algos::fd_verifier::BatchVerifier::UccStatement>, kPyList,
+                       kPyList>,
     };
     return type_map.at(type_index)();
 }
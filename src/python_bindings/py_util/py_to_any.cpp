@@ -9,12 +9,14 @@
 
 #include "algorithms/algebraic_constraints/bin_operation_enum.h"
 #include "algorithms/cfd/enums.h"
+#include "algorithms/fd/fd_verifier/batch_verifier.h"
 #include "algorithms/metric/enums.h"
 #include "association_rules/ar_algorithm_enums.h"
 #include "config/error_measure/type.h"
 #include "config/exceptions.h"
 #include "config/tabular_data/input_table_type.h"
 #include "config/tabular_data/input_tables_type.h"
+#include "parser/csv_parser/create_csv_parser.h"
 #include "parser/csv_parser/csv_parser.h"
 #include "py_util/create_dataframe_reader.h"
 #include "util/enum_to_available_values.h"
@@ -36,14 +38,18 @@ T CastAndReplaceCastError(std::string_view option_name, py::handle value) {
 }
 
 config::InputTable CreateCsvParser(std::string_view option_name, py::tuple const& arguments) {
-    if (py::len(arguments) != 3) {
+    std::size_t const length = py::len(arguments);
+    if (length != 3 && length != 4) {
         throw config::ConfigurationError("Cannot create a CSV parser from passed tuple.");
     }
 
-    return std::make_shared<CSVParser>(
-            CastAndReplaceCastError<std::string>(option_name, arguments[0]),
-            CastAndReplaceCastError<char>(option_name, arguments[1]),
-            CastAndReplaceCastError<bool>(option_name, arguments[2]));
+    CSVConfig csv_config{CastAndReplaceCastError<std::string>(option_name, arguments[0]),
+                         CastAndReplaceCastError<char>(option_name, arguments[1]),
+                         CastAndReplaceCastError<bool>(option_name, arguments[2])};
+    if (length == 4) {
+        csv_config.memory_mapped = CastAndReplaceCastError<bool>(option_name, arguments[3]);
+    }
+    return CreateCSVParser(csv_config);
 }
 
 config::InputTable PythonObjToInputTable(std::string_view option_name, py::handle obj) {
@@ -129,6 +135,9 @@ std::unordered_map<std::type_index, ConvFunc> const kConverters{
         kNormalConvPair<std::filesystem::path>,
         kNormalConvPair<std::vector<std::filesystem::path>>,
         kNormalConvPair<std::unordered_set<size_t>>,
+        kNormalConvPair<std::vector<algos::fd_verifier::BatchVerifier::FdStatement>>,
+        kNormalConvPair<std::vector<algos::fd_verifier::BatchVerifier::AfdStatement>>,
+        kNormalConvPair<std::vector<algos::fd_verifier::BatchVerifier::UccStatement>>,
 };
 
 }  // namespace
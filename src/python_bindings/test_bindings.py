@@ -1,8 +1,10 @@
 import unittest
 from collections import namedtuple
+from concurrent.futures import ThreadPoolExecutor
 from itertools import chain
 
 import desbordante as desb
+import pandas as pd
 
 OptionContainer = namedtuple("OptionContainer", ['path', 'load_options', 'execute_options'])
 FailureCaseContainer = namedtuple("FailureCaseContainer", ['path', 'options'])
@@ -34,6 +36,7 @@ ALGO_CORRECT_OPTIONS_INFO = [
     (desb.fd.algorithms.FUN, [ONLY_NULL_EQUAL_NULL_OPTION_CONTAINER]),
     (desb.fd.algorithms.FdMine, [ONLY_NULL_EQUAL_NULL_OPTION_CONTAINER]),
     (desb.fd.algorithms.HyFD, [ONLY_NULL_EQUAL_NULL_OPTION_CONTAINER]),
+    (desb.fd.algorithms.DynFD, [ONLY_NULL_EQUAL_NULL_OPTION_CONTAINER]),
     (desb.afd.algorithms.Pyro, [
         get_common_option_container(
             {"seed": 1, "max_lhs": 12, "threads": 5, "error": 0.015}
@@ -63,6 +66,14 @@ ALGO_CORRECT_OPTIONS_INFO = [
             {"lhs_indices": [1, 2, 3], "rhs_indices": [1, 2, 3]}
         ),
     ]),
+    (desb.fd_verification.algorithms.BatchVerifier, [
+        get_common_option_container({
+            "fds": [([1, 2], [3]), ([0], [1, 2])],
+            "afds": [([1], [3], 0.1)],
+            "uccs": [[0, 1], [2]],
+            "threads": 4,
+        }),
+    ]),
     (desb.ar.algorithms.Apriori, [
         get_apriori_load_container({"input_format": "tabular", "has_tid": True}),
         get_apriori_load_container({"input_format": "tabular", "has_tid": False}),
@@ -79,6 +90,18 @@ ALGO_CORRECT_OPTIONS_INFO = [
             {"minconf": 0.00312, "minsup": 0.2321},
         ),
     ]),
+    (desb.ar.algorithms.Eclat, [
+        get_apriori_load_container({"input_format": "tabular", "has_tid": True}),
+        OptionContainer(
+            "rules-kaggle-rows.csv",
+            {
+                "input_format": "singular",
+                "tid_column_index": 0,
+                "item_column_index": 1,
+            },
+            {"minconf": 0.00312, "minsup": 0.2321, "threads": 4},
+        ),
+    ]),
     (desb.mfd_verification.algorithms.MetricVerifier, [
         OptionContainer(
             "TestLong.csv",
@@ -191,7 +214,30 @@ class TestPythonBindings(unittest.TestCase):
             with self.subTest(msg=f"metric_verifier_load: {load}"):
                 with self.assertRaises(desb.ConfigurationError):
                     check_metric_verifier_failure(load.path, load.options)
-                
+
+    def test_concurrent_execution(self):
+        def mine_fds():
+            algo = desb.fd.algorithms.HyFD()
+            algo.load_data(table=("WDC_satellites.csv", ",", True))
+            algo.execute()
+            return sorted(map(str, algo.get_fds()))
+
+        expected = mine_fds()
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            futures = [executor.submit(mine_fds) for _ in range(4)]
+            for future in futures:
+                self.assertEqual(expected, future.result())
+
+    def test_mixed_object_column_values_are_compared_as_strings(self):
+        # pandas considers 1, 1.0 and True equal, while their string forms differ
+        table = pd.DataFrame({
+            "mixed": pd.Series([1, 1.0, True, 0, 0.0, False], dtype=object),
+            "constant": [0] * 6,
+        })
+        algo = desb.ucc.algorithms.HyUCC()
+        algo.load_data(table=table)
+        algo.execute()
+        self.assertEqual([[0]], sorted(ucc.indices for ucc in algo.get_uccs()))
 
 
 if __name__ == "__main__":
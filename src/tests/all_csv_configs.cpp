@@ -109,6 +109,8 @@ CSVConfig const kTestDynamicFDInsertBad1 =
         CreateCsvConfig("dynamic_fd/TestDynamicInsertBad1.csv", ',', true);
 CSVConfig const kTestDynamicFDInsertBad2 =
         CreateCsvConfig("dynamic_fd/TestDynamicInsertBad2.csv", ',', true);
+CSVConfig const kTestDynamicFDInsertWide =
+        CreateCsvConfig("dynamic_fd/TestDynamicInsertWide.csv", ',', true);
 CSVConfig const kTestDynamicFDUpdate =
         CreateCsvConfig("dynamic_fd/TestDynamicUpdate.csv", ',', true);
 CSVConfig const kTestDynamicFDUpdateBad1 =
@@ -94,6 +94,7 @@ extern CSVConfig const kTestDynamicFDEmpty;
 extern CSVConfig const kTestDynamicFDInsert;
 extern CSVConfig const kTestDynamicFDInsertBad1;
 extern CSVConfig const kTestDynamicFDInsertBad2;
+extern CSVConfig const kTestDynamicFDInsertWide;
 extern CSVConfig const kTestDynamicFDUpdate;
 extern CSVConfig const kTestDynamicFDUpdateBad1;
 extern CSVConfig const kTestDynamicFDUpdateBad2;
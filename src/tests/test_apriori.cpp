@@ -2,6 +2,7 @@
 
 #include "algorithms/algo_factory.h"
 #include "algorithms/association_rules/apriori.h"
+#include "algorithms/association_rules/eclat.h"
 #include "all_csv_configs.h"
 #include "config/names.h"
 
@@ -49,6 +50,7 @@ static std::set<std::pair<std::set<std::string>, std::set<std::string>>> ToSet(
     return set;
 }
 
+template <typename Algorithm>
 class ARAlgorithmTest : public ::testing::Test {
 protected:
     static algos::StdParamsMap GetParamMap(CSVConfig const& csv_config, double minsup,
@@ -72,13 +74,16 @@ protected:
 
     template <typename... Args>
     static std::unique_ptr<algos::ARAlgorithm> CreateAlgorithmInstance(Args&&... args) {
-        return algos::CreateAndLoadAlgorithm<algos::Apriori>(
+        return algos::CreateAndLoadAlgorithm<Algorithm>(
                 GetParamMap(std::forward<Args>(args)...));
     }
 };
 
-TEST_F(ARAlgorithmTest, BookDataset) {
-    auto algorithm = CreateAlgorithmInstance(kRulesBook, 0.3, 0.5, 0, 1);
+using ARAlgorithms = ::testing::Types<algos::Apriori, algos::Eclat>;
+TYPED_TEST_SUITE(ARAlgorithmTest, ARAlgorithms);
+
+TYPED_TEST(ARAlgorithmTest, BookDataset) {
+    auto algorithm = TestFixture::CreateAlgorithmInstance(kRulesBook, 0.3, 0.5, 0, 1);
     algorithm->Execute();
     auto const actual_frequent = algorithm->GetFrequentList();
     std::set<std::set<std::string>> const expected_frequent = {{"Bread"},
@@ -108,8 +113,8 @@ TEST_F(ARAlgorithmTest, BookDataset) {
     CheckAssociationRulesListsEquality(actual_rules, expected_rules);
 }
 
-TEST_F(ARAlgorithmTest, PresentationExtendedDataset) {
-    auto algorithm = CreateAlgorithmInstance(kRulesPresentationExtended, 0.6, 0, 0, 1);
+TYPED_TEST(ARAlgorithmTest, PresentationExtendedDataset) {
+    auto algorithm = TestFixture::CreateAlgorithmInstance(kRulesPresentationExtended, 0.6, 0, 0, 1);
     algorithm->Execute();
     auto const actual = algorithm->GetFrequentList();
     std::set<std::set<std::string>> const expected = {{"Bread"},
@@ -127,8 +132,8 @@ TEST_F(ARAlgorithmTest, PresentationExtendedDataset) {
     CheckFrequentListsEquality(actual, expected);
 }
 
-TEST_F(ARAlgorithmTest, PresentationDataset) {
-    auto algorithm = CreateAlgorithmInstance(kRulesPresentation, 0.6, 0, 0, 1);
+TYPED_TEST(ARAlgorithmTest, PresentationDataset) {
+    auto algorithm = TestFixture::CreateAlgorithmInstance(kRulesPresentation, 0.6, 0, 0, 1);
     algorithm->Execute();
 
     auto const actual = algorithm->GetFrequentList();
@@ -147,8 +152,8 @@ TEST_F(ARAlgorithmTest, PresentationDataset) {
     CheckAssociationRulesListsEquality(actual_rules, expected_rules);
 }
 
-TEST_F(ARAlgorithmTest, SynteticDatasetWithPruning) {
-    auto algorithm = CreateAlgorithmInstance(kRulesSynthetic2, 0.13, 1.00001, 0, 1);
+TYPED_TEST(ARAlgorithmTest, SynteticDatasetWithPruning) {
+    auto algorithm = TestFixture::CreateAlgorithmInstance(kRulesSynthetic2, 0.13, 1.00001, 0, 1);
     algorithm->Execute();
 
     auto const actual = algorithm->GetFrequentList();
@@ -180,8 +185,8 @@ TEST_F(ARAlgorithmTest, SynteticDatasetWithPruning) {
     CheckAssociationRulesListsEquality(actual_rules, expected_rules);
 }
 
-TEST_F(ARAlgorithmTest, KaggleDatasetWithTIDandHeader) {
-    auto algorithm = CreateAlgorithmInstance(kRulesKaggleRows, 0.1, 0.5, true);
+TYPED_TEST(ARAlgorithmTest, KaggleDatasetWithTIDandHeader) {
+    auto algorithm = TestFixture::CreateAlgorithmInstance(kRulesKaggleRows, 0.1, 0.5, true);
     algorithm->Execute();
 
     auto const actual_frequent = algorithm->GetFrequentList();
@@ -307,15 +312,37 @@ TEST_F(ARAlgorithmTest, KaggleDatasetWithTIDandHeader) {
     CheckAssociationRulesListsEquality(actual_rules, expected_rules);
 }
 
-TEST_F(ARAlgorithmTest, RepeatedExecutionConsistentResult) {
-    auto algorithm = CreateAlgorithmInstance(kRulesKaggleRows, 0.1, 0.5, true);
+TYPED_TEST(ARAlgorithmTest, RepeatedExecutionConsistentResult) {
+    auto algorithm = TestFixture::CreateAlgorithmInstance(kRulesKaggleRows, 0.1, 0.5, true);
     algorithm->Execute();
     auto first_result = ToSet(algorithm->GetArStringsList());
     for (int i = 0; i < 5; ++i) {
-        algos::ConfigureFromMap(*algorithm, GetParamMap(kRulesKaggleRows, 0.1, 0.5, true));
+        algos::ConfigureFromMap(*algorithm,
+                                TestFixture::GetParamMap(kRulesKaggleRows, 0.1, 0.5, true));
         algorithm->Execute();
         CheckAssociationRulesListsEquality(algorithm->GetArStringsList(), first_result);
     }
 }
 
+TEST(EclatTest, ParallelMiningMatchesApriori) {
+    using namespace config::names;
+    algos::StdParamsMap params{{kCsvConfig, kRulesKaggleRows},
+                               {kInputFormat, +algos::InputFormat::tabular},
+                               {kMinimumSupport, 0.05},
+                               {kMinimumConfidence, 0.3},
+                               {kFirstColumnTId, true}};
+    auto apriori = algos::CreateAndLoadAlgorithm<algos::Apriori>(params);
+    apriori->Execute();
+    auto const apriori_frequent = apriori->GetFrequentList();
+    std::set<std::set<std::string>> const expected_frequent(apriori_frequent.begin(),
+                                                            apriori_frequent.end());
+    auto const expected_rules = ToSet(apriori->GetArStringsList());
+
+    params.emplace(kThreads, static_cast<config::ThreadNumType>(4));
+    auto eclat = algos::CreateAndLoadAlgorithm<algos::Eclat>(params);
+    eclat->Execute();
+    CheckFrequentListsEquality(eclat->GetFrequentList(), expected_frequent);
+    CheckAssociationRulesListsEquality(eclat->GetArStringsList(), expected_rules);
+}
+
 }  // namespace tests
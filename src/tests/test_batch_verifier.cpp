@@ -0,0 +1,141 @@
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "algorithms/algo_factory.h"
+#include "algorithms/fd/fd_verifier/batch_verifier.h"
+#include "algorithms/fd/fd_verifier/fd_verifier.h"
+#include "algorithms/ucc/ucc_verifier/ucc_verifier.h"
+#include "all_csv_configs.h"
+#include "config/exceptions.h"
+#include "config/indices/type.h"
+#include "config/names.h"
+
+namespace tests {
+namespace onam = config::names;
+
+namespace {
+using algos::fd_verifier::BatchVerifier;
+
+/* All column sets of one and two columns */
+std::vector<config::IndicesType> SmallColumnSets(unsigned num_columns) {
+    std::vector<config::IndicesType> column_sets;
+    for (unsigned i = 0; i < num_columns; ++i) {
+        column_sets.push_back({i});
+        for (unsigned j = i + 1; j < num_columns; ++j) {
+            column_sets.push_back({i, j});
+        }
+    }
+    return column_sets;
+}
+
+std::vector<BatchVerifier::FdStatement> MakeFds(unsigned num_columns) {
+    std::vector<BatchVerifier::FdStatement> fds;
+    for (auto const& lhs : SmallColumnSets(num_columns)) {
+        for (unsigned rhs = 0; rhs < num_columns; ++rhs) {
+            fds.emplace_back(lhs, config::IndicesType{rhs});
+        }
+        fds.emplace_back(lhs, config::IndicesType{0, num_columns - 1});
+    }
+    return fds;
+}
+
+/* Verifies the dependencies over the first num_columns columns both in one batch and one by one */
+void CheckAgainstSingleVerifiers(CSVConfig const& csv_config, unsigned num_columns,
+                                 config::ThreadNumType threads) {
+    std::vector<BatchVerifier::FdStatement> const fds = MakeFds(num_columns);
+    std::vector<BatchVerifier::AfdStatement> afds;
+    for (auto const& [lhs, rhs] : fds) {
+        afds.emplace_back(lhs, rhs, 0.01);
+    }
+    std::vector<BatchVerifier::UccStatement> const uccs = SmallColumnSets(num_columns);
+    auto batch = algos::CreateAndLoadAlgorithm<BatchVerifier>({{onam::kCsvConfig, csv_config},
+                                                               {onam::kEqualNulls, true},
+                                                               {onam::kFds, fds},
+                                                               {onam::kAfds, afds},
+                                                               {onam::kUccs, uccs},
+                                                               {onam::kThreads, threads}});
+    batch->Execute();
+    ASSERT_EQ(batch->GetFdResults().size(), fds.size());
+    ASSERT_EQ(batch->GetAfdResults().size(), afds.size());
+    ASSERT_EQ(batch->GetUccResults().size(), uccs.size());
+
+    for (size_t i = 0; i < fds.size(); ++i) {
+        auto verifier = algos::CreateAndLoadAlgorithm<algos::fd_verifier::FDVerifier>(
+                {{onam::kCsvConfig, csv_config},
+                 {onam::kEqualNulls, true},
+                 {onam::kLhsIndices, fds[i].first},
+                 {onam::kRhsIndices, fds[i].second}});
+        verifier->Execute();
+        for (auto const* result : {&batch->GetFdResults()[i], &batch->GetAfdResults()[i]}) {
+            EXPECT_EQ(result->FDHolds(), verifier->FDHolds());
+            EXPECT_DOUBLE_EQ(result->GetError(), verifier->GetError());
+            EXPECT_EQ(result->GetNumErrorClusters(), verifier->GetNumErrorClusters());
+            EXPECT_EQ(result->GetNumErrorRows(), verifier->GetNumErrorRows());
+            ASSERT_EQ(result->GetHighlights().size(), verifier->GetHighlights().size());
+            for (size_t j = 0; j < verifier->GetHighlights().size(); ++j) {
+                EXPECT_EQ(result->GetHighlights()[j].GetCluster(),
+                          verifier->GetHighlights()[j].GetCluster());
+            }
+        }
+        EXPECT_EQ(batch->AfdHolds(i), verifier->GetError() <= 0.01);
+    }
+
+    for (size_t i = 0; i < uccs.size(); ++i) {
+        auto verifier = algos::CreateAndLoadAlgorithm<algos::UCCVerifier>(
+                {{onam::kCsvConfig, csv_config},
+                 {onam::kEqualNulls, true},
+                 {onam::kUCCIndices, uccs[i]}});
+        verifier->Execute();
+        auto const& result = batch->GetUccResults()[i];
+        EXPECT_EQ(result.UCCHolds(), verifier->UCCHolds());
+        EXPECT_DOUBLE_EQ(result.GetAUCCError(), verifier->GetError());
+        EXPECT_EQ(result.GetNumRowsViolatingUCC(), verifier->GetNumRowsViolatingUCC());
+        EXPECT_EQ(result.GetClustersViolatingUCC(), verifier->GetClustersViolatingUCC());
+    }
+}
+}  // namespace
+
+TEST(BatchVerifierTest, MatchesSingleVerifiers) {
+    CheckAgainstSingleVerifiers(kTestFD, 6, 1);
+    CheckAgainstSingleVerifiers(kWdcSatellites, 8, 1);
+}
+
+TEST(BatchVerifierTest, MatchesSingleVerifiersInParallel) {
+    CheckAgainstSingleVerifiers(kWdcSatellites, 8, 4);
+    CheckAgainstSingleVerifiers(kCIPublicHighway700, 6, 4);
+}
+
+TEST(BatchVerifierTest, NormalizesIndices) {
+    auto batch = algos::CreateAndLoadAlgorithm<BatchVerifier>(
+            {{onam::kCsvConfig, kTestFD},
+             {onam::kEqualNulls, true},
+             {onam::kFds, std::vector<BatchVerifier::FdStatement>{{{4, 1, 4}, {3}}}}});
+    batch->Execute();
+    ASSERT_EQ(batch->GetFdResults().size(), 1);
+    auto verifier = algos::CreateAndLoadAlgorithm<algos::fd_verifier::FDVerifier>(
+            {{onam::kCsvConfig, kTestFD},
+             {onam::kEqualNulls, true},
+             {onam::kLhsIndices, config::IndicesType{1, 4}},
+             {onam::kRhsIndices, config::IndicesType{3}}});
+    verifier->Execute();
+    EXPECT_EQ(batch->GetFdResults()[0].FDHolds(), verifier->FDHolds());
+    EXPECT_DOUBLE_EQ(batch->GetFdResults()[0].GetError(), verifier->GetError());
+}
+
+TEST(BatchVerifierTest, ThrowsOnWrongStatements) {
+    std::vector<algos::StdParamsMap> const wrong_params = {
+            {{onam::kFds, std::vector<BatchVerifier::FdStatement>{{{}, {1}}}}},
+            {{onam::kFds, std::vector<BatchVerifier::FdStatement>{{{0}, {6}}}}},
+            {{onam::kAfds, std::vector<BatchVerifier::AfdStatement>{{{0}, {1}, 1.5}}}},
+            {{onam::kUccs, std::vector<BatchVerifier::UccStatement>{{0, 10}}}},
+    };
+    for (auto params : wrong_params) {
+        params[onam::kCsvConfig] = kTestFD;
+        EXPECT_THROW(algos::CreateAndLoadAlgorithm<BatchVerifier>(params),
+                     config::ConfigurationError);
+    }
+}
+
+}  // namespace tests
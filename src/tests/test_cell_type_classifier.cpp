@@ -0,0 +1,197 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+#include <gtest/gtest.h>
+
+#include "model/table/cell_type_classifier.h"
+
+namespace tests {
+
+namespace mo = model;
+
+namespace {
+
+/* Checkers TypedColumnDataFactory used before the classifier, kept as the reference */
+bool IsIntByRegex(std::string const& val) {
+    static std::regex const kIntRegex(R"(^(\+|-)?\d{1,19}$)");
+    return std::regex_match(val, kIntRegex);
+}
+
+bool IsBigIntByRegex(std::string const& val) {
+    static std::regex const kBigIntRegex(R"(^(\+|-)?\d{20,}$)");
+    return std::regex_match(val, kBigIntRegex);
+}
+
+bool IsDoubleByStod(std::string const& val) {
+    try {
+        size_t pos = 0;
+        std::stod(val, &pos);
+        return pos == val.size();
+    } catch (...) {
+        return false;
+    }
+}
+
+bool IsDelimitedDateByBoost(std::string const& val) {
+    try {
+        boost::gregorian::from_simple_string(val);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool IsUndelimitedDateByBoost(std::string const& val) {
+    try {
+        boost::gregorian::from_undelimited_string(val);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+void CheckAgainstReference(std::string const& val) {
+    mo::CellTypes const types = mo::ClassifyCell(val);
+    EXPECT_EQ(types.is_empty, val.empty()) << '"' << val << '"';
+    EXPECT_EQ(types.is_null, val == mo::Null::kValue) << '"' << val << '"';
+    if (types.is_empty || types.is_null) {
+        return;
+    }
+    EXPECT_EQ(types.is_int, IsIntByRegex(val)) << '"' << val << '"';
+    EXPECT_EQ(types.is_big_int, IsBigIntByRegex(val)) << '"' << val << '"';
+    EXPECT_EQ(types.is_double, IsDoubleByStod(val)) << '"' << val << '"';
+    EXPECT_EQ(types.is_delimited_date, IsDelimitedDateByBoost(val)) << '"' << val << '"';
+    EXPECT_EQ(types.is_undelimited_date, IsUndelimitedDateByBoost(val)) << '"' << val << '"';
+}
+
+std::vector<std::string> GenerateCells(size_t count, std::string const& alphabet,
+                                       size_t max_length) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> length_dist(0, max_length);
+    std::uniform_int_distribution<size_t> char_dist(0, alphabet.size() - 1);
+    std::vector<std::string> cells(count);
+    for (std::string& cell : cells) {
+        size_t const length = length_dist(gen);
+        for (size_t i = 0; i < length; ++i) {
+            cell.push_back(alphabet[char_dist(gen)]);
+        }
+    }
+    return cells;
+}
+
+}  // namespace
+
+TEST(CellTypeClassifier, KnownValues) {
+    std::vector<std::string> const values = {
+            "",
+            "NULL",
+            "null",
+            "0",
+            "-0",
+            "+15",
+            "1234567890123456789",
+            "12345678901234567890",
+            "-99999999999999999999999",
+            "+",
+            "-",
+            ".",
+            "1.",
+            ".5",
+            "-.5e-3",
+            " 12",
+            "12 ",
+            "1e400",
+            "1e-400",
+            "0x1A",
+            "inf",
+            "-Infinity",
+            "nan",
+            "NaN(123)",
+            "2020-01-31",
+            "2020-02-30",
+            "2024-02-29",
+            "1900-02-29",
+            "2000-Feb-29",
+            "2000-february-1",
+            "2000/DEC/01",
+            "1399-12-31",
+            "9999.12.31",
+            "2020,1,1,extra",
+            "  2020 - 1 - 1",
+            "+2020-+1-+1",
+            "2020-+1-1",
+            "02020-01-01",
+            "65536-01-01",
+            "20200131",
+            "20200230",
+            "2020013112345",
+            "2020+1+1",
+            "2020-1-1",
+            "1400010",
+            "abc",
+            "Apple Inc.",
+            "3.14",
+            "1-2-3",
+    };
+    for (std::string const& val : values) {
+        CheckAgainstReference(val);
+    }
+}
+
+TEST(CellTypeClassifier, RandomValues) {
+    for (std::string const& val : GenerateCells(20000, "0123456789+-. /,", 12)) {
+        CheckAgainstReference(val);
+    }
+    for (std::string const& val : GenerateCells(20000, "0129+-.eEinfatyJjUuNnLl ", 10)) {
+        CheckAgainstReference(val);
+    }
+}
+
+TEST(CellTypeClassifier, FirstMatch) {
+    EXPECT_EQ(mo::ClassifyCell("20200101").GetFirstMatch(), +mo::TypeId::kDate);
+    EXPECT_EQ(mo::ClassifyCell("-12").GetFirstMatch(), +mo::TypeId::kInt);
+    EXPECT_EQ(mo::ClassifyCell("123456789012345678901").GetFirstMatch(), +mo::TypeId::kBigInt);
+    EXPECT_EQ(mo::ClassifyCell("1.5").GetFirstMatch(), +mo::TypeId::kDouble);
+    EXPECT_EQ(mo::ClassifyCell("1.5.6").GetFirstMatch(), +mo::TypeId::kString);
+}
+
+/* Micro-benchmark, run with --gtest_also_run_disabled_tests */
+TEST(CellTypeClassifier, DISABLED_Benchmark) {
+    std::vector<std::string> cells = GenerateCells(200000, "0123456789", 8);
+    std::vector<std::string> const doubles = GenerateCells(200000, "0123456789.", 8);
+    std::vector<std::string> const strings = GenerateCells(200000, "abcdefgh ", 8);
+    cells.insert(cells.end(), doubles.begin(), doubles.end());
+    cells.insert(cells.end(), strings.begin(), strings.end());
+
+    auto measure = [&cells](auto classify) {
+        auto const start = std::chrono::system_clock::now();
+        size_t matched = 0;
+        for (std::string const& cell : cells) {
+            matched += classify(cell);
+        }
+        auto const elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now() - start);
+        return std::make_pair(elapsed.count(), matched);
+    };
+
+    auto const [reference_ms, reference_matched] = measure([](std::string const& cell) {
+        return IsDelimitedDateByBoost(cell) + IsUndelimitedDateByBoost(cell) +
+               IsIntByRegex(cell) + IsBigIntByRegex(cell) + IsDoubleByStod(cell);
+    });
+    auto const [classifier_ms, classifier_matched] = measure([](std::string const& cell) {
+        mo::CellTypes const types = mo::ClassifyCell(cell);
+        return types.is_delimited_date + types.is_undelimited_date + types.is_int +
+               types.is_big_int + types.is_double;
+    });
+
+    std::cout << "Cells: " << cells.size() << ", regex/boost checkers: " << reference_ms
+              << " ms, classifier: " << classifier_ms << " ms" << std::endl;
+    EXPECT_EQ(reference_matched, classifier_matched);
+}
+
+}  // namespace tests
@@ -9,6 +9,7 @@
 #include "all_csv_configs.h"
 #include "csv_config_util.h"
 #include "parser/csv_parser/csv_parser.h"
+#include "parser/csv_parser/mmap_csv_parser.h"
 
 namespace tests {
 
@@ -98,4 +99,104 @@ TEST(TestCSVParser, TestReset) {
     CheckReset(kTest1, 20);
 }
 
+static void CheckMmapParser(CSVConfig const& table) {
+    CSVParser expected_parser(table);
+    MmapCSVParser actual_parser(table);
+
+    ASSERT_EQ(actual_parser.GetNumberOfColumns(), expected_parser.GetNumberOfColumns())
+            << "Fail on " << table.path;
+    for (std::size_t index = 0; index < expected_parser.GetNumberOfColumns(); index++) {
+        ASSERT_EQ(actual_parser.GetColumnName(index), expected_parser.GetColumnName(index))
+                << "Fail on " << table.path;
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        while (expected_parser.HasNextRow()) {
+            ASSERT_TRUE(actual_parser.HasNextRow()) << "Fail on " << table.path;
+            ASSERT_THAT(actual_parser.GetNextRow(), ContainerEq(expected_parser.GetNextRow()))
+                    << "Fail on " << table.path;
+        }
+        ASSERT_FALSE(actual_parser.HasNextRow()) << "Fail on " << table.path;
+
+        expected_parser.Reset();
+        actual_parser.Reset();
+    }
+}
+
+TEST(TestCSVParser, TestMmapParser) {
+    CheckMmapParser(kTestParse);
+    CheckMmapParser(kNullEmpty);
+    CheckMmapParser(kTestSingleColumn);
+    CheckMmapParser(kTestWide);
+    CheckMmapParser(kTestEmpty);
+    CheckMmapParser(kTest1);
+    CheckMmapParser(kACShippingDates);
+    CheckMmapParser(kTestDataStats);
+    CheckMmapParser(kWdcSatellites);
+    CheckMmapParser(kCIPublicHighway700);
+}
+
+static void CheckMmapParserSplit(CSVConfig const& table, size_t rows_to_skip, size_t parts) {
+    CSVParser expected_parser(table);
+    MmapCSVParser actual_parser(table);
+    for (size_t row = 0; row < rows_to_skip && expected_parser.HasNextRow(); ++row) {
+        expected_parser.GetNextRow();
+        actual_parser.GetNextRow();
+    }
+
+    auto ranges = actual_parser.SplitRemainingRows(parts);
+    ASSERT_FALSE(actual_parser.HasNextRow()) << "Fail on " << table.path;
+    ASSERT_LE(ranges.size(), parts) << "Fail on " << table.path;
+    for (auto const& range : ranges) {
+        ASSERT_EQ(range->GetNumberOfColumns(), expected_parser.GetNumberOfColumns())
+                << "Fail on " << table.path;
+        ASSERT_TRUE(range->HasNextRow()) << "Fail on " << table.path;
+        while (range->HasNextRow()) {
+            ASSERT_TRUE(expected_parser.HasNextRow()) << "Fail on " << table.path;
+            ASSERT_THAT(range->GetNextRow(), ContainerEq(expected_parser.GetNextRow()))
+                    << "Fail on " << table.path;
+        }
+    }
+    ASSERT_FALSE(expected_parser.HasNextRow()) << "Fail on " << table.path;
+
+    // The parser can still be read again from the start
+    expected_parser.Reset();
+    actual_parser.Reset();
+    while (expected_parser.HasNextRow()) {
+        ASSERT_TRUE(actual_parser.HasNextRow()) << "Fail on " << table.path;
+        ASSERT_THAT(actual_parser.GetNextRow(), ContainerEq(expected_parser.GetNextRow()))
+                << "Fail on " << table.path;
+    }
+    ASSERT_FALSE(actual_parser.HasNextRow()) << "Fail on " << table.path;
+}
+
+TEST(TestCSVParser, TestMmapParserSplit) {
+    for (CSVConfig const& table : {kTestParse, kNullEmpty, kTestSingleColumn, kTestWide,
+                                   kTestEmpty, kTest1, kWdcSatellites, kCIPublicHighway700}) {
+        for (size_t parts : {1, 2, 7, 1000}) {
+            CheckMmapParserSplit(table, 0, parts);
+            CheckMmapParserSplit(table, 3, parts);
+        }
+    }
+}
+
+TEST(TestCSVParser, TestMmapParserRowView) {
+    MmapCSVParser parser(kTestParse);
+    MmapCSVParser::RowView row = parser.GetNextRowView();
+    std::vector<std::string> actual(row.begin(), row.end());
+    ASSERT_THAT(actual, ContainerEq(std::vector<std::string>{"", "\\\\\\\"", "b\"b\\\\ b"}));
+}
+
+TEST(TestCSVParser, TestDefaultRowView) {
+    CSVParser expected_parser(kTestParse);
+    CSVParser actual_parser(kTestParse);
+    while (expected_parser.HasNextRow()) {
+        ASSERT_TRUE(actual_parser.HasNextRow());
+        model::IDatasetStream::RowView const& row = actual_parser.GetNextRowView();
+        std::vector<std::string> actual(row.begin(), row.end());
+        ASSERT_THAT(actual, ContainerEq(expected_parser.GetNextRow()));
+    }
+    ASSERT_FALSE(actual_parser.HasNextRow());
+}
+
 }  // namespace tests
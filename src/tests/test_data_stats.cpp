@@ -196,7 +196,7 @@ TEST(TestDataStats, TestGetVocab) {
     std::unique_ptr<algos::DataStats> stats_ptr = MakeStatAlgorithm(kTestDataStats);
     algos::DataStats &stats = *stats_ptr;
     algos::Statistic vocab_stat = stats.GetVocab(1);
-    std::string str = mo::Type::GetValue<mo::String>(vocab_stat.GetData());
+    std::string str(mo::Type::GetValue<mo::String>(vocab_stat.GetData()));
     EXPECT_EQ(str, "abd");
 }
 
@@ -438,6 +438,57 @@ TEST(TestDataStats, CorrectExecutionEmpty) {
     EXPECT_EQ(stats.GetAllStats().size(), 0);
 }
 
+TEST(TestDataStats, ExecuteMatchesGetters) {
+    auto executed_ptr = MakeStatAlgorithm(kTestDataStats, true, 4);
+    executed_ptr->Execute();
+    auto stats_ptr = MakeStatAlgorithm(kTestDataStats);
+    algos::DataStats &stats = *stats_ptr;
+
+    auto expect_eq = [](algos::Statistic const &actual, algos::Statistic const &expected) {
+        ASSERT_EQ(actual.HasValue(), expected.HasValue());
+        if (expected.HasValue()) {
+            EXPECT_EQ(actual.ToString(), expected.ToString());
+        }
+    };
+    for (size_t i = 0; i < stats.GetNumberOfColumns(); ++i) {
+        SCOPED_TRACE(i);
+        algos::ColumnStats const &all = executed_ptr->GetAllStats(i);
+        EXPECT_EQ(all.distinct, stats.Distinct(i));
+        if (stats.GetData()[i].GetTypeId() == +mo::TypeId::kMixed) continue;
+        expect_eq(all.avg, stats.GetAvg(i));
+        expect_eq(all.STD, stats.GetCorrectedSTD(i));
+        expect_eq(all.skewness, stats.GetSkewness(i));
+        expect_eq(all.kurtosis, stats.GetKurtosis(i));
+        expect_eq(all.min, stats.GetMin(i));
+        expect_eq(all.max, stats.GetMax(i));
+        expect_eq(all.sum, stats.GetSum(i));
+        expect_eq(all.quantile25, stats.GetQuantile(0.25, i));
+        expect_eq(all.quantile50, stats.GetQuantile(0.5, i));
+        expect_eq(all.quantile75, stats.GetQuantile(0.75, i));
+        expect_eq(all.num_zeros, stats.GetNumberOfZeros(i));
+        expect_eq(all.num_negatives, stats.GetNumberOfNegatives(i));
+        expect_eq(all.sum_of_squares, stats.GetSumOfSquares(i));
+        expect_eq(all.geometric_mean, stats.GetGeometricMean(i));
+        expect_eq(all.mean_ad, stats.GetMeanAD(i));
+        expect_eq(all.median, stats.GetMedian(i));
+        expect_eq(all.median_ad, stats.GetMedianAD(i));
+        expect_eq(all.vocab, stats.GetVocab(i));
+        expect_eq(all.num_non_letter_chars, stats.GetNumberOfNonLetterChars(i));
+        expect_eq(all.num_digit_chars, stats.GetNumberOfDigitChars(i));
+        expect_eq(all.num_lowercase_chars, stats.GetNumberOfLowercaseChars(i));
+        expect_eq(all.num_uppercase_chars, stats.GetNumberOfUppercaseChars(i));
+        expect_eq(all.num_chars, stats.GetNumberOfChars(i));
+        expect_eq(all.num_avg_chars, stats.GetAvgNumberOfChars(i));
+        expect_eq(all.min_num_chars, stats.GetMinNumberOfChars(i));
+        expect_eq(all.max_num_chars, stats.GetMaxNumberOfChars(i));
+        expect_eq(all.min_num_words, stats.GetMinNumberOfWords(i));
+        expect_eq(all.max_num_words, stats.GetMaxNumberOfWords(i));
+        expect_eq(all.num_words, stats.GetNumberOfWords(i));
+        expect_eq(all.num_entirely_uppercase, stats.GetNumberOfEntirelyUppercaseWords(i));
+        expect_eq(all.num_entirely_lowercase, stats.GetNumberOfEntirelyLowercaseWords(i));
+    }
+}
+
 // To measure performace of mining statistics in multiple threads.
 #if 0
 TEST(TestCsvStats, TestDiffThreadNum) {
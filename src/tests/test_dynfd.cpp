@@ -0,0 +1,133 @@
+#include <list>
+#include <memory>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "algorithms/algo_factory.h"
+#include "algorithms/fd/dynfd/dynfd.h"
+#include "algorithms/fd/hyfd/hyfd.h"
+#include "all_csv_configs.h"
+#include "config/exceptions.h"
+#include "config/names.h"
+#include "csv_config_util.h"
+
+namespace tests {
+namespace onam = config::names;
+
+namespace {
+using FdSet = std::set<std::pair<std::vector<size_t>, size_t>>;
+
+FdSet ToFdSet(std::list<FD> const& fds) {
+    FdSet set;
+    for (auto const& fd : fds) {
+        auto const& raw_fd = fd.ToRawFD();
+        std::vector<size_t> lhs;
+        for (size_t i = raw_fd.lhs_.find_first(); i != boost::dynamic_bitset<>::npos;
+             i = raw_fd.lhs_.find_next(i)) {
+            lhs.push_back(i);
+        }
+        set.emplace(std::move(lhs), raw_fd.rhs_);
+    }
+    return set;
+}
+
+FdSet MineStatic(CSVConfig const& csv_config) {
+    auto algorithm = algos::CreateAndLoadAlgorithm<algos::hyfd::HyFD>(
+            {{onam::kCsvConfig, csv_config}, {onam::kEqualNulls, true}});
+    algorithm->Execute();
+    return ToFdSet(algorithm->FdList());
+}
+
+/* Batches can be set only after the first execution */
+std::unique_ptr<algos::dynfd::DynFD> LoadAndExecute(CSVConfig const& csv_config) {
+    auto algorithm = algos::CreateAndLoadAlgorithm<algos::dynfd::DynFD>(
+            {{onam::kCsvConfig, csv_config}, {onam::kEqualNulls, true}});
+    algorithm->Execute();
+    return algorithm;
+}
+
+void ExecuteBatch(algos::dynfd::DynFD& algorithm, algos::StdParamsMap const& params) {
+    algos::ConfigureFromMap(algorithm, params);
+    algorithm.Execute();
+}
+
+std::unordered_set<size_t> RowRange(size_t begin, size_t end) {
+    std::unordered_set<size_t> rows;
+    for (size_t row = begin; row < end; ++row) {
+        rows.insert(row);
+    }
+    return rows;
+}
+}  // namespace
+
+TEST(DynFDTest, InitialExecutionMatchesStatic) {
+    auto algorithm = LoadAndExecute(kTestDynamicFDInit);
+    EXPECT_EQ(ToFdSet(algorithm->FdList()), MineStatic(kTestDynamicFDInit));
+}
+
+TEST(DynFDTest, InsertIntoEmptyTable) {
+    auto algorithm = LoadAndExecute(kTestDynamicFDEmpty);
+    ExecuteBatch(*algorithm, {{onam::kInsertStatements, MakeInputTable(kTestDynamicFDInit)}});
+    EXPECT_EQ(ToFdSet(algorithm->FdList()), MineStatic(kTestDynamicFDInit));
+}
+
+TEST(DynFDTest, DeleteInsertedRows) {
+    auto algorithm = LoadAndExecute(kTestDynamicFDInit);
+    ExecuteBatch(*algorithm, {{onam::kInsertStatements, MakeInputTable(kTestDynamicFDInsert)}});
+    ExecuteBatch(*algorithm, {{onam::kDeleteStatements, RowRange(12, 15)}});
+    EXPECT_EQ(ToFdSet(algorithm->FdList()), MineStatic(kTestDynamicFDInit));
+}
+
+TEST(DynFDTest, MixedBatch) {
+    auto algorithm = LoadAndExecute(kTestDynamicFDInit);
+    ExecuteBatch(*algorithm, {{onam::kInsertStatements, MakeInputTable(kTestDynamicFDInsert)},
+                              {onam::kUpdateStatements, MakeInputTable(kTestDynamicFDUpdate)},
+                              {onam::kDeleteStatements, std::unordered_set<size_t>{1, 6, 3}}});
+    FdSet const expected = {{{0, 4}, 1}, {{0, 5}, 1}, {{1, 3}, 0}, {{1, 3}, 4}, {{1, 4}, 0},
+                            {{1, 5}, 0}, {{2}, 0},    {{2}, 1},    {{2}, 3},    {{2}, 4},
+                            {{3, 5}, 0}, {{3, 5}, 1}, {{3, 5}, 4}, {{4}, 3},    {{4, 5}, 0},
+                            {{4, 5}, 1}};
+    EXPECT_EQ(ToFdSet(algorithm->FdList()), expected);
+}
+
+/* The inserted row breaks FDs of most columns, deleting it makes the positive covers generalize
+ * back to the FDs of the original table */
+TEST(DynFDTest, DeleteRowOfWideTable) {
+    auto algorithm = LoadAndExecute(kCIPublicHighway700);
+    FdSet const expected = MineStatic(kCIPublicHighway700);
+    ExecuteBatch(*algorithm, {{onam::kInsertStatements, MakeInputTable(kTestDynamicFDInsertWide)}});
+    ASSERT_NE(ToFdSet(algorithm->FdList()), expected);
+    ExecuteBatch(*algorithm, {{onam::kDeleteStatements, std::unordered_set<size_t>{769}}});
+    EXPECT_EQ(ToFdSet(algorithm->FdList()), expected);
+}
+
+/* Deleting a prefix of the table and inserting the whole table again only duplicates rows, so the
+ * FDs are the ones of the original table */
+TEST(DynFDTest, ReinsertDeletedRows) {
+    for (auto const& csv_config : {kWdcSatellites, kWdcSymbols, kCIPublicHighway700}) {
+        auto algorithm = LoadAndExecute(csv_config);
+        ExecuteBatch(*algorithm, {{onam::kDeleteStatements, RowRange(0, 50)}});
+        ExecuteBatch(*algorithm, {{onam::kInsertStatements, MakeInputTable(csv_config)}});
+        EXPECT_EQ(ToFdSet(algorithm->FdList()), MineStatic(csv_config));
+    }
+}
+
+TEST(DynFDTest, ThrowsOnWrongBatches) {
+    std::vector<algos::StdParamsMap> const batches = {
+            {{onam::kInsertStatements, MakeInputTable(kTestDynamicFDInsertBad1)}},
+            {{onam::kInsertStatements, MakeInputTable(kTestDynamicFDInsertBad2)}},
+            {{onam::kUpdateStatements, MakeInputTable(kTestDynamicFDUpdateBad1)}},
+            {{onam::kUpdateStatements, MakeInputTable(kTestDynamicFDUpdateBad4)}},
+            {{onam::kDeleteStatements, std::unordered_set<size_t>{100000}}},
+    };
+    for (auto const& batch : batches) {
+        auto algorithm = LoadAndExecute(kTestDynamicFDInit);
+        EXPECT_THROW(ExecuteBatch(*algorithm, batch), config::ConfigurationError);
+    }
+}
+
+}  // namespace tests
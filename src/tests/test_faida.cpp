@@ -1,7 +1,11 @@
+#include <random>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "algorithms/algo_factory.h"
 #include "algorithms/ind/faida/faida.h"
+#include "algorithms/ind/faida/inclusion_testing/packed_hll.h"
 #include "all_csv_configs.h"
 #include "config/names.h"
 #include "test_ind_util.h"
@@ -25,7 +29,7 @@ protected:
     static std::unique_ptr<algos::INDAlgorithm> CreateFaidaInstance(CSVConfigs const& csv_configs,
                                                                     Config const& config) {
         using namespace config::names;
-        return algos::CreateAndLoadAlgorithm<algos::Mind>(algos::StdParamsMap{
+        return algos::CreateAndLoadAlgorithm<algos::Faida>(algos::StdParamsMap{
                 {kCsvConfigs, csv_configs},
                 {kSampleSize, config.sample_size},
                 {kHllAccuracy, config.hll_accuracy},
@@ -58,4 +62,29 @@ TEST_F(FaidaINDAlgorithmTest, TestTwoTables) {
             expected_inds_subset, 47);
 }
 
+TEST(PackedHLLTest, MergeInclusionAndEstimate) {
+    std::mt19937_64 gen(0);
+    std::vector<size_t> hashes(20000);
+    for (size_t& hash : hashes) hash = gen();
+
+    algos::faida::PackedHLL first(12), second(12), all(12);
+    first.AddHashes({hashes.data(), hashes.size() / 2});
+    second.AddHashes({hashes.data() + hashes.size() / 2, hashes.size() / 2});
+    for (size_t hash : hashes) all.AddHash(hash);
+
+    EXPECT_TRUE(first.IsIncludedIn(all));
+    EXPECT_TRUE(second.IsIncludedIn(all));
+    EXPECT_FALSE(all.IsIncludedIn(first));
+
+    first.Merge(second);
+    EXPECT_TRUE(first.IsIncludedIn(all));
+    EXPECT_TRUE(all.IsIncludedIn(first));
+    // the standard error is 1.04 / sqrt(2^12), about 1.6%
+    EXPECT_NEAR(all.Estimate(), hashes.size(), hashes.size() * 0.05);
+    EXPECT_NEAR(algos::faida::PackedHLL(4).Estimate(), 0, 1e-9);
+
+    EXPECT_THROW(first.Merge(algos::faida::PackedHLL(10)), std::invalid_argument);
+    EXPECT_THROW(algos::faida::PackedHLL(31), std::invalid_argument);
+}
+
 }  // namespace tests
@@ -5,6 +5,7 @@
 
 #include "algorithms/fd/depminer/depminer.h"
 #include "algorithms/fd/dfd/dfd.h"
+#include "algorithms/fd/dynfd/dynfd.h"
 #include "algorithms/fd/fastfds/fastfds.h"
 #include "algorithms/fd/fdep/fdep.h"
 #include "algorithms/fd/fun/fun.h"
@@ -158,7 +159,38 @@ REGISTER_TYPED_TEST_SUITE_P(AlgorithmTest, ThrowsOnEmpty, ReturnsEmptyOnSingleNo
 
 using Algorithms =
         ::testing::Types<algos::Tane, algos::Pyro, algos::FastFDs, algos::DFD, algos::Depminer,
-                         algos::FDep, algos::FUN, algos::hyfd::HyFD, algos::PFDTane>;
+                         algos::FDep, algos::FUN, algos::hyfd::HyFD, algos::PFDTane,
+                         algos::dynfd::DynFD>;
 INSTANTIATE_TYPED_TEST_SUITE_P(AlgorithmTest, AlgorithmTest, Algorithms);
 
+TEST(TaneTest, ParallelLevelsMatchSerial) {
+    using namespace config::names;
+    for (CSVConfig const& csv_config : {kWdcAstronomical, kCIPublicHighway700, kTestFD}) {
+        for (config::ErrorType error : {0.0, 0.1}) {
+            auto mine = [&csv_config, error](config::ThreadNumType threads) {
+                auto algorithm = algos::CreateAndLoadAlgorithm<algos::Tane>(
+                        {{kCsvConfig, csv_config}, {kError, error}, {kThreads, threads}});
+                algorithm->Execute();
+                return FDsToSet(algorithm->FdList());
+            };
+            EXPECT_EQ(mine(1), mine(4)) << "FDs differ on " << csv_config.path.filename()
+                                        << " with error " << error;
+        }
+    }
+}
+
+TEST(HyFDTest, ParallelValidationMatchesSerial) {
+    using namespace config::names;
+    for (CSVConfig const& csv_config :
+         {kWdcAstronomical, kWdcSatellites, kCIPublicHighway700, kTestFD}) {
+        auto mine = [&csv_config](config::ThreadNumType threads) {
+            auto algorithm = algos::CreateAndLoadAlgorithm<algos::hyfd::HyFD>(
+                    {{kCsvConfig, csv_config}, {kThreads, threads}});
+            algorithm->Execute();
+            return FDsToSet(algorithm->FdList());
+        };
+        EXPECT_EQ(mine(1), mine(4)) << "FDs differ on " << csv_config.path.filename();
+    }
+}
+
 }  // namespace tests
@@ -51,13 +51,115 @@ TYPED_TEST_P(GfdValidationTest, TestExistingMatches) {
     ASSERT_EQ(expected_size, gfd_list.size());
 }
 
-REGISTER_TYPED_TEST_SUITE_P(GfdValidationTest, TestTrivially, TestExistingMatches);
+TYPED_TEST_P(GfdValidationTest, TestLiteralOfTwoVertices) {
+    auto graph_path = current_path / "cinema.dot";
+    auto gfd_path = current_path / "cinema_name_gfd.dot";
+    std::vector<std::filesystem::path> gfd_paths = {gfd_path};
+    auto algorithm = TestFixture::CreateGfdValidationInstance(graph_path, gfd_paths);
+    int expected_size = 0;
+    algorithm->Execute();
+    std::vector<Gfd> gfd_list = algorithm->GfdList();
+    ASSERT_EQ(expected_size, gfd_list.size());
+}
+
+TYPED_TEST_P(GfdValidationTest, TestBallsOfEqualWeight) {
+    auto graph_path = current_path / "cinema.dot";
+    auto gfd_path = current_path / "cinema_gfd.dot";
+    std::vector<std::filesystem::path> gfd_paths = {gfd_path};
+    auto algorithm = TestFixture::CreateGfdValidationInstance(graph_path, gfd_paths);
+    int expected_size = 0;
+    algorithm->Execute();
+    std::vector<Gfd> gfd_list = algorithm->GfdList();
+    ASSERT_EQ(expected_size, gfd_list.size());
+}
+
+TYPED_TEST_P(GfdValidationTest, TestNoMatches) {
+    auto graph_path = current_path / "directors.dot";
+    auto gfd_path = current_path / "directors_absent_gfd.dot";
+    std::vector<std::filesystem::path> gfd_paths = {gfd_path};
+    auto algorithm = TestFixture::CreateGfdValidationInstance(graph_path, gfd_paths);
+    int expected_size = 1;
+    algorithm->Execute();
+    std::vector<Gfd> gfd_list = algorithm->GfdList();
+    ASSERT_EQ(expected_size, gfd_list.size());
+}
+
+TYPED_TEST_P(GfdValidationTest, TestEdgeLabels) {
+    auto graph_path = current_path / "edge_labels.dot";
+    auto gfd_path = current_path / "edge_labels_gfd.dot";
+    std::vector<std::filesystem::path> gfd_paths = {gfd_path};
+    auto algorithm = TestFixture::CreateGfdValidationInstance(graph_path, gfd_paths);
+    int expected_size = 0;
+    algorithm->Execute();
+    std::vector<Gfd> gfd_list = algorithm->GfdList();
+    ASSERT_EQ(expected_size, gfd_list.size());
+}
+
+TYPED_TEST_P(GfdValidationTest, TestBacktracking) {
+    auto graph_path = current_path / "triangles.dot";
+    auto gfd_path = current_path / "triangles_gfd.dot";
+    std::vector<std::filesystem::path> gfd_paths = {gfd_path};
+    auto algorithm = TestFixture::CreateGfdValidationInstance(graph_path, gfd_paths);
+    int expected_size = 0;
+    algorithm->Execute();
+    std::vector<Gfd> gfd_list = algorithm->GfdList();
+    ASSERT_EQ(expected_size, gfd_list.size());
+}
+
+TYPED_TEST_P(GfdValidationTest, TestRefinedCandidates) {
+    auto graph_path = current_path / "cycle.dot";
+    auto gfd_path = current_path / "cycle_gfd.dot";
+    std::vector<std::filesystem::path> gfd_paths = {gfd_path};
+    auto algorithm = TestFixture::CreateGfdValidationInstance(graph_path, gfd_paths);
+    int expected_size = 0;
+    algorithm->Execute();
+    std::vector<Gfd> gfd_list = algorithm->GfdList();
+    ASSERT_EQ(expected_size, gfd_list.size());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(GfdValidationTest, TestTrivially, TestExistingMatches,
+                            TestLiteralOfTwoVertices, TestBallsOfEqualWeight, TestNoMatches,
+                            TestEdgeLabels, TestBacktracking, TestRefinedCandidates);
 
 using GfdAlgorithms =
         ::testing::Types<algos::NaiveGfdValidation, algos::GfdValidation, algos::EGfdValidation>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(GfdValidationTest, GfdValidationTest, GfdAlgorithms);
 
+TEST(EGfdValidationTest, TestExistingMatchesParallel) {
+    auto graph_path = current_path / "directors.dot";
+    auto gfd_path = current_path / "directors_gfd.dot";
+    std::vector<std::filesystem::path> gfd_paths = {gfd_path};
+    StdParamsMap option_map = {{config::names::kGraphData, graph_path},
+                               {config::names::kGfdData, gfd_paths},
+                               {config::names::kThreads, static_cast<config::ThreadNumType>(4)}};
+    auto algorithm = algos::CreateAndLoadAlgorithm<algos::EGfdValidation>(option_map);
+    algorithm->Execute();
+    ASSERT_EQ(0, algorithm->GfdList().size());
+}
+
+TEST(EGfdValidationTest, TestParallelMatchesSequential) {
+    auto graph_path = current_path / "directors.dot";
+    std::vector<std::filesystem::path> gfd_paths = {
+            current_path / "directors_gfd.dot", current_path / "directors_low_celebrity_gfd.dot"};
+    auto validate = [&](config::ThreadNumType threads) {
+        StdParamsMap option_map = {{config::names::kGraphData, graph_path},
+                                   {config::names::kGfdData, gfd_paths},
+                                   {config::names::kThreads, threads}};
+        auto algorithm = algos::CreateAndLoadAlgorithm<algos::EGfdValidation>(option_map);
+        algorithm->Execute();
+        return algorithm->GfdList();
+    };
+    std::vector<Gfd> sequential = validate(1);
+    std::vector<Gfd> parallel = validate(4);
+    ASSERT_EQ(1, sequential.size());
+    ASSERT_EQ(sequential.size(), parallel.size());
+    for (std::size_t i = 0; i < sequential.size(); ++i) {
+        EXPECT_EQ(sequential[i].GetPremises(), parallel[i].GetPremises());
+        EXPECT_EQ(sequential[i].GetConclusion(), parallel[i].GetConclusion());
+    }
+}
+
 }  // namespace
 
 }  // namespace tests
@@ -10,6 +10,7 @@
 #include "algorithms/metric/metric_verifier.h"
 #include "all_csv_configs.h"
 #include "config/names.h"
+#include "config/thread_number/type.h"
 
 namespace tests {
 namespace onam = config::names;
@@ -107,6 +108,13 @@ TEST_P(TestMetricVerifying, ConsistentRepeatedExecution) {
     }
 }
 
+TEST_P(TestMetricVerifying, ParallelVerification) {
+    auto params = GetParam().params;
+    params[onam::kThreads] = static_cast<config::ThreadNumType>(4);
+    auto verifier = CreateMetricVerifier(params);
+    ASSERT_EQ(GetResult(*verifier), GetParam().expected);
+}
+
 TEST_P(TestHighlights, DefaultTest) {  // Assumes that highlights are sorted by distance in reverse
     auto const& params = GetParam().params;
     auto const& highlight_distances = GetParam().highlight_distances;
@@ -124,6 +132,23 @@ TEST_P(TestHighlights, DefaultTest) {  // Assumes that highlights are sorted by
     }
 }
 
+TEST_P(TestHighlights, ParallelVerification) {
+    auto params = GetParam().params;
+    auto const& expected = GetHighlights(*CreateMetricVerifier(params));
+    params[onam::kThreads] = static_cast<config::ThreadNumType>(4);
+    auto verifier = CreateMetricVerifier(params);
+    auto const& highlights = GetHighlights(*verifier);
+
+    ASSERT_EQ(highlights.size(), expected.size());
+    for (size_t i = 0; i < highlights.size(); ++i) {
+        ASSERT_EQ(highlights[i].size(), expected[i].size());
+        for (size_t j = 0; j < highlights[i].size(); ++j) {
+            EXPECT_EQ(highlights[i][j].data_index, expected[i][j].data_index);
+            EXPECT_EQ(highlights[i][j].max_distance, expected[i][j].max_distance);
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
         MetricVerifierTestSuite, TestMetricVerifying,
         ::testing::Values(
@@ -22,10 +22,12 @@ struct PFDTaneMiningParams {
     unsigned int result_hash;
 
     PFDTaneMiningParams(unsigned int result_hash, config::ErrorType error,
-                        algos::ErrorMeasure error_measure, CSVConfig const& csv_config)
+                        algos::ErrorMeasure error_measure, CSVConfig const& csv_config,
+                        config::ThreadNumType threads = 1)
         : params({{onam::kCsvConfig, csv_config},
                   {onam::kError, error},
-                  {onam::kErrorMeasure, error_measure}}),
+                  {onam::kErrorMeasure, error_measure},
+                  {onam::kThreads, threads}}),
           result_hash(result_hash) {}
 };
 
@@ -64,7 +66,8 @@ TEST_P(TestPFDTaneValidation, ErrorCalculationTest) {
 INSTANTIATE_TEST_SUITE_P(
         PFDTaneTestMiningSuite, TestPFDTaneMining,
         ::testing::Values(
-            PFDTaneMiningParams(44381, 0.3, +algos::ErrorMeasure::per_value, kTestFD)
+            PFDTaneMiningParams(44381, 0.3, +algos::ErrorMeasure::per_value, kTestFD),
+            PFDTaneMiningParams(44381, 0.3, +algos::ErrorMeasure::per_value, kTestFD, 4)
         ));
 
 INSTANTIATE_TEST_SUITE_P(
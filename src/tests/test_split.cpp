@@ -30,20 +30,23 @@ void CompareDDStringLists(std::set<std::pair<std::set<model::DFStringConstraint>
 class SplitAlgorithmTest : public ::testing::Test {
 public:
     static algos::StdParamsMap GetParamMap(CSVConfig const& csv_config,
-                                           std::optional<CSVConfig> const& dif_table_csv_config) {
+                                           std::optional<CSVConfig> const& dif_table_csv_config,
+                                           config::ThreadNumType threads) {
         using namespace config::names;
         if (dif_table_csv_config == std::nullopt) {
-            return {{kCsvConfig, csv_config}};
+            return {{kCsvConfig, csv_config}, {kThreads, threads}};
         }
         return {{kCsvConfig, csv_config},
-                {kDifferenceTable, MakeInputTable(dif_table_csv_config.value())}};
+                {kDifferenceTable, MakeInputTable(dif_table_csv_config.value())},
+                {kThreads, threads}};
     }
 
     static std::unique_ptr<algos::dd::Split> CreateSplitAlgorithmInstance(
             CSVConfig const& csv_config,
-            std::optional<CSVConfig> const& dif_table_csv_config = std::nullopt) {
+            std::optional<CSVConfig> const& dif_table_csv_config = std::nullopt,
+            config::ThreadNumType threads = 1) {
         return algos::CreateAndLoadAlgorithm<algos::dd::Split>(
-                GetParamMap(csv_config, dif_table_csv_config));
+                GetParamMap(csv_config, dif_table_csv_config, threads));
     }
 };
 
@@ -140,4 +143,20 @@ TEST_F(SplitAlgorithmTest, Test4) {
     CompareDDStringLists(expected_results, actual_results);
 }
 
+TEST_F(SplitAlgorithmTest, ParallelDistancesMatchSerial) {
+    auto serial_algo = CreateSplitAlgorithmInstance(kTestDD2, kTestDif2);
+    serial_algo->Execute();
+    auto parallel_algo = CreateSplitAlgorithmInstance(kTestDD2, kTestDif2, 4);
+    parallel_algo->Execute();
+
+    std::set<std::pair<std::set<model::DFStringConstraint>, std::set<model::DFStringConstraint>>>
+            expected_results;
+    for (auto const& dd : serial_algo->GetDDStringList()) {
+        expected_results.emplace(std::set(dd.left.begin(), dd.left.end()),
+                                 std::set(dd.right.begin(), dd.right.end()));
+    }
+    CompareDDStringLists(expected_results, parallel_algo->GetDDStringList());
+    ASSERT_EQ(serial_algo->GetMinMaxDif(), parallel_algo->GetMinMaxDif());
+}
+
 }  // namespace tests
@@ -1,4 +1,6 @@
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -92,4 +94,78 @@ TEST(TypeSystem, SumColumnDoubles) {
     EXPECT_DOUBLE_EQ(type.GetValue<mo::Double>(sum.get()), expected);
 }
 
+TEST(TypeSystem, NullsAndEmpties) {
+    auto input_table = MakeInputTable(kSimpleTypes);
+    std::vector<mo::TypedColumnData> col_data{mo::CreateTypedColumnData(*input_table, true)};
+    ASSERT_EQ(col_data.size(), 11);
+
+    mo::TypedColumnData const& undefined = col_data[0];
+    ASSERT_EQ(undefined.GetTypeId(), +TypeId::kUndefined);
+    EXPECT_EQ(undefined.GetNumNulls(), 5);
+    EXPECT_EQ(undefined.GetNumEmpties(), 4);
+    for (size_t row : {0, 1, 3, 6, 7}) {
+        EXPECT_TRUE(undefined.IsNull(row)) << "Row: " << row;
+        EXPECT_EQ(undefined.GetValueTypeId(row), +TypeId::kNull);
+    }
+    for (size_t row : {2, 4, 5, 8}) {
+        EXPECT_TRUE(undefined.IsEmpty(row)) << "Row: " << row;
+        EXPECT_EQ(undefined.GetValueTypeId(row), +TypeId::kEmpty);
+    }
+
+    mo::TypedColumnData const& ints = col_data[10];
+    ASSERT_EQ(ints.GetTypeId(), +TypeId::kInt);
+    EXPECT_EQ(ints.GetNumNulls(), 3);
+    EXPECT_EQ(ints.GetNumEmpties(), 1);
+    std::vector<mo::Int> values;
+    std::byte const* prev_value = nullptr;
+    for (size_t row = 0; row != ints.GetNumRows(); ++row) {
+        if (ints.IsNullOrEmpty(row)) {
+            continue;
+        }
+        // Values are stored in row order
+        EXPECT_LT(prev_value, ints.GetValue(row));
+        prev_value = ints.GetValue(row);
+        values.push_back(mo::Type::GetValue<mo::Int>(ints.GetValue(row)));
+    }
+    EXPECT_EQ(values, std::vector<mo::Int>({3123, 2, 3, 3, -11}));
+}
+
+TEST(TypeSystem, StringsInColumnBuffer) {
+    auto input_table = MakeInputTable(kSimpleTypes);
+    std::vector<mo::TypedColumnData> col_data{mo::CreateTypedColumnData(*input_table, true)};
+    ASSERT_EQ(col_data.size(), 11);
+
+    std::vector<std::string> expected;
+    input_table->Reset();
+    while (input_table->HasNextRow()) {
+        expected.push_back(input_table->GetNextRow()[4]);
+    }
+
+    mo::TypedColumnData const& strings = col_data[4];
+    ASSERT_EQ(strings.GetTypeId(), +TypeId::kString);
+    std::vector<std::string> values;
+    char const* next_chars = nullptr;
+    for (size_t row = 0; row != strings.GetNumRows(); ++row) {
+        mo::String const value = mo::Type::GetValue<mo::String>(strings.GetValue(row));
+        // Characters of the values are stored one after another in row order
+        if (next_chars != nullptr) {
+            EXPECT_EQ(value.data(), next_chars) << "Row: " << row;
+        }
+        next_chars = value.data() + value.size();
+        values.emplace_back(value);
+    }
+    EXPECT_EQ(values, expected);
+
+    mo::TypedColumnData const& mixed = col_data[9];
+    ASSERT_EQ(mixed.GetTypeId(), +TypeId::kMixed);
+    mo::MixedType const& mixed_type = *mixed.GetIfMixed();
+    for (size_t row : {5, 6, 7}) {
+        ASSERT_EQ(mixed.GetValueTypeId(row), +TypeId::kString) << "Row: " << row;
+        std::unique_ptr<std::byte[]> clone(mixed_type.Clone(mixed.GetValue(row)));
+        EXPECT_EQ(mixed_type.Compare(clone.get(), mixed.GetValue(row)), mo::CompareResult::kEqual);
+        EXPECT_EQ(mixed_type.ValueToString(clone.get()), mixed.GetDataAsString(row));
+    }
+    EXPECT_EQ(mixed.GetDataAsString(5), "suddenly");
+}
+
 }  // namespace tests
@@ -1,35 +1,57 @@
+#include <array>
+#include <cmath>
 #include <iostream>
+#include <random>
+#include <set>
 #include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "algorithms/fd/fd_collection.h"
 #include "all_csv_configs.h"
 #include "csv_config_util.h"
 #include "fd/pyrocommon/model/list_agree_set_sample.h"
 #include "levenshtein_distance.h"
 #include "model/table/agree_set_factory.h"
+#include "model/table/column_domain_iterator.h"
 #include "model/table/column_layout_relation_data.h"
 #include "model/table/identifier_set.h"
+#include "model/table/pli_cache.h"
+#include "model/table/vertical_map.h"
+#include "qgram_vector.h"
+#include "util/per_thread_buffers.h"
 
 namespace tests {
 
-using std::deque, std::vector, std::cout, std::endl, std::unique_ptr, model::AgreeSetFactory,
+using std::vector, std::cout, std::endl, std::unique_ptr, model::AgreeSetFactory,
         model::MCGenMethod, model::AgreeSetsGenMethod;
 using ::testing::ContainerEq, ::testing::Eq;
 
 namespace fs = std::filesystem;
 
+namespace {
+
+vector<vector<int>> ToVectors(model::ClusterList const& clusters) {
+    vector<vector<int>> result;
+    for (model::ClusterList::View cluster : clusters) {
+        result.emplace_back(cluster.begin(), cluster.end());
+    }
+    return result;
+}
+
+}  // namespace
+
 TEST(pliChecker, first) {
-    deque<vector<int>> ans = {
+    vector<vector<int>> ans = {
             {0, 2, 8, 11}, {1, 5, 9}, {4, 14}, {6, 7, 18}, {10, 17}  // null
     };
-    deque<vector<int>> index;
+    vector<vector<int>> index;
     try {
         auto input_table = MakeInputTable(kTest1);
         auto test = ColumnLayoutRelationData::CreateFrom(*input_table, true);
         auto column_data = test->GetColumnData(0);
-        index = column_data.GetPositionListIndex()->GetIndex();
+        index = ToVectors(column_data.GetPositionListIndex()->GetIndex());
     } catch (std::runtime_error& e) {
         cout << "Exception raised in test: " << e.what() << endl;
         FAIL();
@@ -38,18 +60,18 @@ TEST(pliChecker, first) {
 }
 
 TEST(pliChecker, second) {
-    deque<vector<int>> ans = {
+    vector<vector<int>> ans = {
             {0, 2, 8, 11},
             {1, 5, 9},
             {4, 14},
             {6, 7, 18},
     };
-    deque<vector<int>> index;
+    vector<vector<int>> index;
     try {
         auto input_table = MakeInputTable(kTest1);
         auto test = ColumnLayoutRelationData::CreateFrom(*input_table, false);
         auto column_data = test->GetColumnData(0);
-        index = column_data.GetPositionListIndex()->GetIndex();
+        index = ToVectors(column_data.GetPositionListIndex()->GetIndex());
     } catch (std::runtime_error& e) {
         cout << "Exception raised in test: " << e.what() << endl;
         FAIL();
@@ -57,8 +79,33 @@ TEST(pliChecker, second) {
     ASSERT_THAT(index, ContainerEq(ans));
 }
 
+/* Memory-mapped tables are split into ranges read on the pool, the others are read on one
+ * thread */
+TEST(pliChecker, parallelLoading) {
+    for (CSVConfig csv_config : {kTest1, kNullEmpty, kWdcSatellites, kCIPublicHighway700}) {
+        for (bool memory_mapped : {false, true}) {
+            csv_config.memory_mapped = memory_mapped;
+            for (bool is_null_eq_null : {true, false}) {
+                auto sequential_table = MakeInputTable(csv_config);
+                auto parallel_table = MakeInputTable(csv_config);
+                auto sequential = ColumnLayoutRelationData::CreateFrom(*sequential_table,
+                                                                       is_null_eq_null, 1);
+                auto parallel = ColumnLayoutRelationData::CreateFrom(*parallel_table,
+                                                                     is_null_eq_null, 4);
+                ASSERT_EQ(sequential->GetNumRows(), parallel->GetNumRows());
+                ASSERT_EQ(sequential->GetNumColumns(), parallel->GetNumColumns());
+                for (size_t i = 0; i < sequential->GetNumColumns(); ++i) {
+                    ASSERT_THAT(parallel->GetColumnData(i).GetProbingTable(),
+                                ContainerEq(sequential->GetColumnData(i).GetProbingTable()))
+                            << "Fail on " << csv_config.path;
+                }
+            }
+        }
+    }
+}
+
 TEST(pliIntersectChecker, first) {
-    deque<vector<int>> ans = {{2, 5}};
+    vector<vector<int>> ans = {{2, 5}};
     std::shared_ptr<model::PositionListIndex> intersection;
 
     try {
@@ -75,7 +122,187 @@ TEST(pliIntersectChecker, first) {
         cout << "Exception raised in test: " << e.what() << endl;
         FAIL();
     }
-    ASSERT_THAT(intersection->GetIndex(), ContainerEq(ans));
+    ASSERT_THAT(ToVectors(intersection->GetIndex()), ContainerEq(ans));
+}
+
+TEST(pliCacheChecker, evictsWithinMemoryLimit) {
+    auto input_table = MakeInputTable(kCIPublicHighway700);
+    auto relation = ColumnLayoutRelationData::CreateFrom(*input_table, false);
+    RelationalSchema const* schema = relation->GetSchema();
+    std::size_t const memory_limit = 32 << 10;
+    model::PLICache cache(relation.get(), memory_limit);
+    std::size_t const num_columns = schema->GetNumColumns();
+
+    std::size_t requests = 0;
+    for (std::size_t first = 0; first < num_columns; ++first) {
+        for (std::size_t second = first + 1; second < num_columns; ++second) {
+            Vertical first_column(*schema->GetColumn(first));
+            Vertical pair = first_column.Union(Vertical(*schema->GetColumn(second)));
+            auto expected = relation->GetColumnData(first).GetPositionListIndex()->Intersect(
+                    relation->GetColumnData(second).GetPositionListIndex());
+            auto actual = cache.GetOrCreateFor(pair);
+            ++requests;
+            ASSERT_THAT(ToVectors(actual->GetIndex()),
+                        ContainerEq(ToVectors(expected->GetIndex())));
+            ASSERT_LE(cache.GetMemoryUsage(), memory_limit);
+            // the PLI was just cached unless it alone exceeds the limit
+            if (cache.Get(pair) != nullptr) {
+                EXPECT_EQ(cache.GetOrCreateFor(pair), actual);
+                ++requests;
+            }
+        }
+    }
+    EXPECT_EQ(cache.GetHits() + cache.GetMisses(), requests);
+    EXPECT_EQ(cache.GetMisses(), num_columns * (num_columns - 1) / 2);
+    EXPECT_GT(cache.GetEvictions(), 0u);
+}
+
+TEST(verticalMapChecker, subsetAndSupersetQueries) {
+    auto input_table = MakeInputTable(kCIPublicHighway700);
+    auto relation = ColumnLayoutRelationData::CreateFrom(*input_table, false);
+    RelationalSchema const* schema = relation->GetSchema();
+    std::size_t const num_columns = schema->GetNumColumns();
+    std::mt19937 gen(0);
+    std::bernoulli_distribution take_column(0.3);
+    auto random_vertical = [&]() {
+        boost::dynamic_bitset<> indices(num_columns);
+        for (std::size_t i = 0; i < num_columns; ++i) indices[i] = take_column(gen);
+        return schema->GetVertical(std::move(indices));
+    };
+
+    model::VerticalMap<Vertical> map(schema);
+    std::set<Vertical> keys;
+    for (int i = 0; i < 500; ++i) {
+        Vertical key = random_vertical();
+        map.Put(key, std::make_shared<Vertical>(key));
+        keys.insert(key);
+    }
+    for (int i = 0; i < 200; ++i) {
+        Vertical key = random_vertical();
+        EXPECT_EQ(map.Remove(key) != nullptr, keys.erase(key) == 1);
+    }
+    ASSERT_EQ(map.GetSize(), keys.size());
+
+    for (int i = 0; i < 100; ++i) {
+        Vertical query = random_vertical();
+        std::set<Vertical> expected_subsets, expected_supersets, actual_subsets, actual_supersets;
+        for (Vertical const& key : keys) {
+            if (query.Contains(key)) expected_subsets.insert(key);
+            if (key.Contains(query)) expected_supersets.insert(key);
+        }
+        for (auto const& [key, value] : map.GetSubsetEntries(query)) {
+            EXPECT_EQ(key, *value);
+            actual_subsets.insert(key);
+        }
+        for (auto const& [key, value] : map.GetSupersetEntries(query)) {
+            EXPECT_EQ(key, *value);
+            actual_supersets.insert(key);
+        }
+        EXPECT_EQ(actual_subsets, expected_subsets);
+        EXPECT_EQ(actual_supersets, expected_supersets);
+        EXPECT_EQ(map.Get(query) != nullptr, keys.count(query) == 1);
+    }
+}
+
+TEST(fdCollectionChecker, concurrentRegistration) {
+    RelationalSchema schema("wide");
+    std::size_t const num_columns = 70;
+    for (std::size_t i = 0; i < num_columns; ++i) schema.AppendColumn(std::to_string(i));
+    schema.Init();
+
+    unsigned const threads_num = 4;
+    unsigned const fds_per_thread = 1000;
+    std::vector<std::vector<std::string>> expected(threads_num);
+    for (unsigned t = 0; t < threads_num; ++t) {
+        std::mt19937 gen(t);
+        std::bernoulli_distribution take_column(0.2);
+        for (unsigned i = 0; i < fds_per_thread; ++i) {
+            boost::dynamic_bitset<> indices(num_columns);
+            for (std::size_t j = 0; j < num_columns; ++j) indices[j] = take_column(gen);
+            expected[t].push_back(
+                    FD(schema.GetVertical(std::move(indices)), *schema.GetColumn(i % num_columns))
+                            .ToJSONString());
+        }
+    }
+
+    algos::FDCollection collection;
+    collection.Register(Vertical(), *schema.GetColumn(0));
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < threads_num; ++t) {
+        threads.emplace_back([&collection, &schema, t]() {
+            std::mt19937 gen(t);
+            std::bernoulli_distribution take_column(0.2);
+            for (unsigned i = 0; i < fds_per_thread; ++i) {
+                boost::dynamic_bitset<> indices(num_columns);
+                for (std::size_t j = 0; j < num_columns; ++j) indices[j] = take_column(gen);
+                collection.Register(schema.GetVertical(std::move(indices)),
+                                    *schema.GetColumn(i % num_columns));
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    ASSERT_EQ(collection.Size(), threads_num * fds_per_thread + 1);
+
+    std::multiset<std::string> expected_fds{"{\"lhs\": [], \"rhs\": 0}"};
+    for (auto const& thread_fds : expected) {
+        expected_fds.insert(thread_fds.begin(), thread_fds.end());
+    }
+    std::multiset<std::string> actual_fds;
+    for (FD const& fd : collection.AsList()) actual_fds.insert(fd.ToJSONString());
+    EXPECT_EQ(actual_fds, expected_fds);
+    EXPECT_EQ(collection.Size(), threads_num * fds_per_thread + 1);
+
+    collection.Clear();
+    EXPECT_EQ(collection.Size(), 0);
+    collection.Register(Vertical(*schema.GetColumn(1)), *schema.GetColumn(2));
+    ASSERT_EQ(collection.AsList().size(), 1);
+    EXPECT_EQ(collection.AsList().front().ToShortString(), "[ 1 ] -> 2");
+}
+
+TEST(perThreadBuffersChecker, oneBufferPerThreadBeyondCache) {
+    // more objects than the thread local cache holds, touched alternately
+    std::array<util::PerThreadBuffers<std::vector<int>>, 7> objects;
+    auto fill = [&objects]() {
+        for (int i = 0; i < 100; ++i) {
+            for (auto& object : objects) object.Local().push_back(i);
+        }
+    };
+    fill();
+    std::thread other(fill);
+    other.join();
+    for (auto const& object : objects) {
+        std::size_t buffers = 0;
+        object.ForEach([&buffers](std::vector<int> const& buffer) {
+            ++buffers;
+            EXPECT_EQ(buffer.size(), 100);
+        });
+        EXPECT_EQ(buffers, 2);
+    }
+}
+
+TEST(columnDomainChecker, mergesMemoryAndSwappedPartitions) {
+    std::string const long_value(3 * model::ColumnDomain::kMinReadBufferSize, 'x');
+    model::ColumnDomain::RawData raw_data;
+    raw_data.emplace_back(0, 0, 0);
+    for (char const* value : {"b", "a", "", "d", "a", "b"}) {
+        raw_data.back().Insert(value);
+    }
+    raw_data.back().Insert(long_value);
+    ASSERT_TRUE(raw_data.back().TrySwap());
+    EXPECT_EQ(raw_data.back().GetMemoryUsage(), 0);
+
+    raw_data.emplace_back(0, 0, 1);
+    for (char const* value : {"c", "a", "e", "c"}) {
+        raw_data.back().Insert(value);
+    }
+    raw_data.back().Compact();
+
+    model::ColumnDomain domain(std::move(raw_data));
+    domain.SetReadBufferSize(model::ColumnDomain::kMinReadBufferSize);
+    model::ColumnDomainIterator it(domain);
+    std::vector<std::string> values{it.GetValue()};
+    while (it.TryMove()) values.push_back(it.GetValue());
+    EXPECT_EQ(values, (std::vector<std::string>{"", "a", "b", "c", "d", "e", long_value}));
 }
 
 TEST(testingBitsetToLonglong, first) {
@@ -195,6 +422,22 @@ TEST(AgreeSetFactoryTest, UsingHandlePartition) {
     TestAgreeSetFactory(c);
 }
 
+TEST(AgreeSetFactoryTest, UsingTupleBlocks) {
+    AgreeSetFactory::Configuration c(AgreeSetsGenMethod::kUsingTupleBlocks);
+    TestAgreeSetFactory(c);
+}
+
+TEST(AgreeSetFactoryTest, TupleBlocksParallelMatchesIdSets) {
+    auto input_table = MakeInputTable(kCIPublicHighway700);
+    auto relation = ColumnLayoutRelationData::CreateFrom(*input_table, false);
+    AgreeSetFactory::Configuration id_sets_config(AgreeSetsGenMethod::kUsingMapOfIDSets);
+    AgreeSetFactory::Configuration blocks_config(AgreeSetsGenMethod::kUsingTupleBlocks,
+                                                 MCGenMethod::kUsingCalculateSupersets, 4);
+    auto expected = AgreeSetFactory(relation.get(), id_sets_config).GenAgreeSets();
+    auto actual = AgreeSetFactory(relation.get(), blocks_config).GenAgreeSets();
+    EXPECT_EQ(actual, expected);
+}
+
 #if 0
 TEST(AgreeSetFactoryTest, MCGenParallel) {
     AgreeSetFactory::Configuration c(AgreeSetsGenMethod::kUsingVectorOfIDSets,
@@ -228,6 +471,44 @@ INSTANTIATE_TEST_SUITE_P(TestLevenshteinSuite, TestLevenshtein,
                                            TestLevenshteinParam("book", "back", 2),
                                            TestLevenshteinParam("book", "", 4),
                                            TestLevenshteinParam("", "book", 4),
-                                           TestLevenshteinParam("randomstring", "juststring", 6)));
+                                           TestLevenshteinParam("randomstring", "juststring", 6),
+                                           TestLevenshteinParam("kitten", "sitting", 3),
+                                           TestLevenshteinParam(std::string(70, 'a'),
+                                                                std::string(65, 'a') + "bbbbb",
+                                                                5),
+                                           TestLevenshteinParam(std::string(100, 'a') + "xyz",
+                                                                "yz" + std::string(90, 'a'),
+                                                                13)));
+
+TEST(TestLevenshteinBounded, StopsAtBound) {
+    EXPECT_EQ(util::LevenshteinDistance("book", "back", 2), 2);
+    EXPECT_EQ(util::LevenshteinDistance("book", "back", 1), 2);
+    EXPECT_EQ(util::LevenshteinDistance("randomstring", "juststring", 3), 4);
+    EXPECT_EQ(util::LevenshteinDistance("", "book", 0), 1);
+    EXPECT_EQ(util::LevenshteinDistance("book", "book", 0), 0);
+    std::string const long_string = std::string(80, 'a') + std::string(80, 'b');
+    EXPECT_EQ(util::LevenshteinDistance(long_string, std::string(160, 'c'), 10), 11);
+    EXPECT_EQ(util::LevenshteinDistance(long_string, std::string(80, 'b') + std::string(80, 'a'),
+                                        200),
+              160);
+}
+
+TEST(TestQGramVector, LongQGramsAreExact) {
+    // q-grams longer than 8 bytes share no packed key, only the equal ones may match
+    std::string const lhs = "abcdefghijk";
+    std::string const rhs = "bcdefghijkl";
+    util::QGramVector const lhs_vector(lhs, 9);
+    util::QGramVector const rhs_vector(rhs, 9);
+    EXPECT_DOUBLE_EQ(lhs_vector.InnerProduct(rhs_vector), 2);
+    EXPECT_NEAR(lhs_vector.CosineDistance(rhs_vector), 1.0 / 3, 1e-9);
+    EXPECT_NEAR(lhs_vector.CosineDistance(lhs_vector), 0, 1e-9);
+
+    std::string const repeated = "aaaaaaaaaaa";
+    std::string const shifted = "aaaaaaaaaab";
+    util::QGramVector const repeated_vector(repeated, 10);
+    util::QGramVector const shifted_vector(shifted, 10);
+    EXPECT_DOUBLE_EQ(repeated_vector.GetLength(), 2);
+    EXPECT_NEAR(repeated_vector.CosineDistance(shifted_vector), 1 - 1 / std::sqrt(2.0), 1e-9);
+}
 
 }  // namespace tests